@@ -0,0 +1,222 @@
+// Standalone benchmark of draw call recording and SVG serialization.
+// Built without R, see Makefile.
+
+#include "DrawData.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <sys/resource.h>
+
+using namespace httpgd;
+
+namespace
+{
+    using clock = std::chrono::steady_clock;
+
+    constexpr vertex<double> PAGE_SIZE{720, 576};
+
+    struct Workload
+    {
+        const char *description;
+        // returns the number of draw calls
+        std::size_t (*record)(dc::Page &page, std::mt19937 &rng);
+    };
+
+    dc::LineInfo line_info(color_t t_col, double t_lwd)
+    {
+        return {t_col, t_lwd, 0, dc::LineInfo::GC_ROUND_CAP, dc::LineInfo::GC_ROUND_JOIN, 10.0};
+    }
+
+    std::vector<vertex<double>> random_walk(std::mt19937 &rng, std::size_t n)
+    {
+        std::normal_distribution<double> step(0.0, 2.0);
+        std::vector<vertex<double>> points;
+        points.reserve(n);
+        vertex<double> p{PAGE_SIZE.x / 2, PAGE_SIZE.y / 2};
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            p.x += step(rng);
+            p.y += step(rng);
+            points.push_back(p);
+        }
+        return points;
+    }
+
+    // 1e6 scatter plot points
+    std::size_t record_circles(dc::Page &page, std::mt19937 &rng)
+    {
+        std::uniform_real_distribution<double> ux(0, PAGE_SIZE.x), uy(0, PAGE_SIZE.y);
+        for (int i = 0; i < 1000000; ++i)
+        {
+            page.put(std::make_shared<dc::Circle>(line_info(color::rgb(0, 0, 0), 1.0), color::rgba(255, 0, 0, 128), vertex<double>{ux(rng), uy(rng)}, 2.7));
+        }
+        return 1000000;
+    }
+
+    // 10 time series with 1e5 points each
+    std::size_t record_polylines(dc::Page &page, std::mt19937 &rng)
+    {
+        for (int i = 0; i < 10; ++i)
+        {
+            page.put(std::make_shared<dc::Polyline>(line_info(color::rgb(i * 20, 0, 255 - i * 20), 1.5), random_walk(rng, 100000)));
+        }
+        return 10;
+    }
+
+    // Map like paths: 2000 features with 20 rings of 50 points each
+    std::size_t record_paths(dc::Page &page, std::mt19937 &rng)
+    {
+        std::uniform_real_distribution<double> ux(0, PAGE_SIZE.x), uy(0, PAGE_SIZE.y), ur(1, 20);
+        for (int f = 0; f < 2000; ++f)
+        {
+            std::vector<vertex<double>> points;
+            std::vector<int> nper;
+            for (int r = 0; r < 20; ++r)
+            {
+                const vertex<double> c{ux(rng), uy(rng)};
+                const double radius = ur(rng);
+                for (int k = 0; k < 50; ++k)
+                {
+                    const double a = k * 2 * M_PI / 50;
+                    points.push_back({c.x + radius * std::cos(a), c.y + radius * std::sin(a)});
+                }
+                nper.push_back(50);
+            }
+            page.put(std::make_shared<dc::Path>(line_info(color::rgb(50, 50, 50), 0.5), color::rgba(200, 220, 180, 255), std::move(points), std::move(nper), f % 2 == 0));
+        }
+        return 2000;
+    }
+
+    // 1e5 labels, some of which need escaping
+    std::size_t record_text(dc::Page &page, std::mt19937 &rng)
+    {
+        std::uniform_real_distribution<double> ux(0, PAGE_SIZE.x), uy(0, PAGE_SIZE.y);
+        for (int i = 0; i < 100000; ++i)
+        {
+            std::string str = (i % 10 == 0) ? fmt::format("a < b & \"label\" {}", i) : fmt::format("label {}", i);
+            dc::TextInfo info{400, "", "Liberation Sans", 12.0, i % 7 == 0, 0.0};
+            page.put(std::make_shared<dc::Text>(color::rgb(0, 0, 0), vertex<double>{ux(rng), uy(rng)}, std::move(str), (i % 4) * 45.0, 0.5, std::move(info)));
+        }
+        return 100000;
+    }
+
+    // 10 noisy 1000x1000 images
+    std::size_t record_rasters(dc::Page &page, std::mt19937 &rng)
+    {
+        std::uniform_int_distribution<unsigned int> upx(0, 0xFFFFFF);
+        for (int i = 0; i < 10; ++i)
+        {
+            std::vector<unsigned int> raster(1000 * 1000);
+            for (auto &px : raster)
+            {
+                px = upx(rng) | 0xFF000000;
+            }
+            page.put(std::make_shared<dc::Raster>(std::move(raster), vertex<int>{1000, 1000}, rect<double>{10.0 * i, 10.0 * i, 500, 400}, 0, true));
+        }
+        return 10;
+    }
+
+    const std::map<std::string, Workload> WORKLOADS{
+        {"circles", {"1e6 circles", record_circles}},
+        {"polylines", {"10 polylines, 1e5 points each", record_polylines}},
+        {"paths", {"2000 paths, 20 rings each", record_paths}},
+        {"text", {"1e5 text labels", record_text}},
+        {"rasters", {"10 rasters, 1000x1000 px", record_rasters}}};
+
+    double peak_rss_mb()
+    {
+        struct rusage usage;
+        getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+        return usage.ru_maxrss / (1024.0 * 1024.0); // bytes
+#else
+        return usage.ru_maxrss / 1024.0; // kilobytes
+#endif
+    }
+
+    double seconds(clock::duration t_duration)
+    {
+        return std::chrono::duration<double>(t_duration).count();
+    }
+
+    void run(const std::string &t_name, const Workload &t_workload, int t_reps)
+    {
+        std::mt19937 rng(1234);
+        dc::Page page(0, PAGE_SIZE);
+
+        const auto rec_start = clock::now();
+        const std::size_t draws = t_workload.record(page, rng);
+        const double rec_secs = seconds(clock::now() - rec_start);
+
+        std::size_t bytes = 0;
+        double ser_secs = 0;
+        for (int i = 0; i < t_reps; ++i)
+        {
+            const auto ser_start = clock::now();
+            const std::string svg = page.svg(boost::none);
+            ser_secs += seconds(clock::now() - ser_start);
+            bytes = svg.size();
+        }
+        ser_secs /= t_reps;
+
+        fmt::print("{:<10} {:<30} | record {:8.1f} ms {:10.0f} draws/s | serialize {:8.1f} ms {:10.0f} draws/s {:7.1f} MB/s | svg {:7.1f} MB | peak rss {:7.1f} MB\n",
+                   t_name, t_workload.description,
+                   rec_secs * 1e3, draws / rec_secs,
+                   ser_secs * 1e3, draws / ser_secs, bytes / ser_secs / 1e6,
+                   bytes / 1e6,
+                   peak_rss_mb());
+    }
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    int reps = 3;
+    std::vector<std::string> names;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--reps") == 0 && i + 1 < argc)
+        {
+            reps = std::max(1, std::atoi(argv[++i]));
+        }
+        else if (std::strcmp(argv[i], "--list") == 0)
+        {
+            for (const auto &w : WORKLOADS)
+            {
+                fmt::print("{:<10} {}\n", w.first, w.second.description);
+            }
+            return 0;
+        }
+        else
+        {
+            names.emplace_back(argv[i]);
+        }
+    }
+    if (names.empty())
+    {
+        for (const auto &w : WORKLOADS)
+        {
+            names.push_back(w.first);
+        }
+    }
+
+    for (const auto &name : names)
+    {
+        auto it = WORKLOADS.find(name);
+        if (it == WORKLOADS.end())
+        {
+            fmt::print(stderr, "Unknown workload: {} (see --list)\n", name);
+            return 1;
+        }
+        run(name, it->second, reps);
+    }
+    return 0;
+}
@@ -0,0 +1,344 @@
+// HTTP / WebSocket load generator for the httpgd web server.
+// Built without R, see Makefile and loadtest.R.
+
+#include <boost/asio/connect.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/beast/core.hpp>
+#include <boost/beast/http.hpp>
+#include <boost/beast/websocket.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace beast = boost::beast;
+namespace http = beast::http;
+namespace websocket = beast::websocket;
+namespace net = boost::asio;
+using tcp = net::ip::tcp;
+
+namespace
+{
+    using clock = std::chrono::steady_clock;
+
+    struct Options
+    {
+        std::string host = "127.0.0.1";
+        std::string port = "8080";
+        std::string token;
+        std::string scenario = "state";
+        int clients = 8;
+        int ws_clients = 0;
+        double duration = 10.0;
+    };
+
+    struct ClientStats
+    {
+        std::vector<double> latencies_ms;
+        std::size_t errors = 0;
+        std::size_t bytes = 0;
+    };
+
+    struct WsStats
+    {
+        std::atomic<std::size_t> connected{0};
+        std::atomic<std::size_t> messages{0};
+        std::atomic<std::size_t> errors{0};
+    };
+
+    std::string with_token(const Options &t_opt, std::string t_target)
+    {
+        if (t_opt.token.empty())
+        {
+            return t_target;
+        }
+        t_target += (t_target.find('?') == std::string::npos) ? '?' : '&';
+        return t_target + "token=" + t_opt.token;
+    }
+
+    // Picks the next request target of a scenario.
+    class Traffic
+    {
+    public:
+        Traffic(const std::string &t_scenario, unsigned t_seed)
+            : m_scenario(t_scenario), m_rng(t_seed)
+        {
+        }
+
+        std::string next()
+        {
+            if (m_scenario == "state")
+            {
+                return "/state";
+            }
+            if (m_scenario == "svg")
+            {
+                return random_svg();
+            }
+            // mixed: mostly polling, some plot lists and renders
+            const int r = std::uniform_int_distribution<int>(0, 99)(m_rng);
+            if (r < 70)
+            {
+                return "/state";
+            }
+            if (r < 80)
+            {
+                return "/plots";
+            }
+            return random_svg();
+        }
+
+    private:
+        std::string m_scenario;
+        std::mt19937 m_rng;
+
+        std::string random_svg()
+        {
+            std::uniform_int_distribution<int> w(200, 1600), h(200, 1200);
+            return fmt::format("/svg?width={}&height={}", w(m_rng), h(m_rng));
+        }
+    };
+
+    void http_client(const Options &t_opt, unsigned t_seed, clock::time_point t_end, ClientStats &t_stats)
+    {
+        Traffic traffic(t_opt.scenario, t_seed);
+        net::io_context ioc;
+        tcp::resolver resolver(ioc);
+        const auto endpoints = resolver.resolve(t_opt.host, t_opt.port);
+        std::unique_ptr<beast::tcp_stream> stream;
+        beast::flat_buffer buffer;
+
+        while (clock::now() < t_end)
+        {
+            try
+            {
+                if (!stream)
+                {
+                    stream = std::make_unique<beast::tcp_stream>(ioc);
+                    stream->connect(endpoints);
+                }
+
+                http::request<http::empty_body> req{http::verb::get, with_token(t_opt, traffic.next()), 11};
+                req.set(http::field::host, t_opt.host);
+                req.keep_alive(true);
+
+                http::response<http::string_body> res;
+                const auto start = clock::now();
+                http::write(*stream, req);
+                http::read(*stream, buffer, res);
+                const double ms = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+
+                t_stats.latencies_ms.push_back(ms);
+                t_stats.bytes += res.body().size();
+                if (res.result() != http::status::ok)
+                {
+                    t_stats.errors++;
+                }
+                if (res.need_eof())
+                {
+                    stream.reset();
+                }
+            }
+            catch (const std::exception &e)
+            {
+                t_stats.errors++;
+                stream.reset();
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+        }
+    }
+
+    // Websocket subscriber: reads broadcasts until the io_context is stopped.
+    class WsClient : public std::enable_shared_from_this<WsClient>
+    {
+    public:
+        WsClient(net::io_context &t_ioc, const Options &t_opt, WsStats &t_stats)
+            : m_ws(t_ioc), m_opt(t_opt), m_stats(t_stats)
+        {
+        }
+
+        void start(const tcp::resolver::results_type &t_endpoints)
+        {
+            beast::get_lowest_layer(m_ws).async_connect(t_endpoints, [self = shared_from_this()](beast::error_code ec, auto) {
+                if (ec)
+                {
+                    self->m_stats.errors++;
+                    return;
+                }
+                self->m_ws.async_handshake(self->m_opt.host, with_token(self->m_opt, "/"), [self](beast::error_code ec) {
+                    if (ec)
+                    {
+                        self->m_stats.errors++;
+                        return;
+                    }
+                    self->m_stats.connected++;
+                    self->read();
+                });
+            });
+        }
+
+    private:
+        websocket::stream<beast::tcp_stream> m_ws;
+        const Options &m_opt;
+        WsStats &m_stats;
+        beast::flat_buffer m_buffer;
+
+        void read()
+        {
+            m_ws.async_read(m_buffer, [self = shared_from_this()](beast::error_code ec, std::size_t) {
+                if (ec)
+                {
+                    if (ec != net::error::operation_aborted)
+                    {
+                        self->m_stats.errors++;
+                    }
+                    return;
+                }
+                self->m_stats.messages++;
+                self->m_buffer.consume(self->m_buffer.size());
+                self->read();
+            });
+        }
+    };
+
+    double percentile(const std::vector<double> &t_sorted, double t_p)
+    {
+        if (t_sorted.empty())
+        {
+            return 0;
+        }
+        const auto i = static_cast<std::size_t>(t_p * (t_sorted.size() - 1) + 0.5);
+        return t_sorted[std::min(i, t_sorted.size() - 1)];
+    }
+
+    void usage()
+    {
+        fmt::print(stderr,
+                   "Usage: loadgen [options]\n"
+                   "  --host <host>        (default 127.0.0.1)\n"
+                   "  --port <port>        (default 8080)\n"
+                   "  --token <token>      security token\n"
+                   "  --scenario <name>    state | svg | ws | mixed (default state)\n"
+                   "  --clients <n>        concurrent HTTP clients (default 8)\n"
+                   "  --ws-clients <n>     websocket subscribers (default 0, 'ws' scenario: clients)\n"
+                   "  --duration <secs>    (default 10)\n");
+    }
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Options opt;
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        if (i + 1 >= argc)
+        {
+            usage();
+            return 1;
+        }
+        const char *val = argv[++i];
+        if (arg == "--host")
+            opt.host = val;
+        else if (arg == "--port")
+            opt.port = val;
+        else if (arg == "--token")
+            opt.token = val;
+        else if (arg == "--scenario")
+            opt.scenario = val;
+        else if (arg == "--clients")
+            opt.clients = std::max(0, std::atoi(val));
+        else if (arg == "--ws-clients")
+            opt.ws_clients = std::max(0, std::atoi(val));
+        else if (arg == "--duration")
+            opt.duration = std::max(0.1, std::atof(val));
+        else
+        {
+            usage();
+            return 1;
+        }
+    }
+    if (opt.scenario != "state" && opt.scenario != "svg" && opt.scenario != "ws" && opt.scenario != "mixed")
+    {
+        usage();
+        return 1;
+    }
+    int http_clients = opt.clients;
+    if (opt.scenario == "ws")
+    {
+        opt.ws_clients = std::max(opt.ws_clients, opt.clients);
+        http_clients = 0;
+    }
+
+    const auto start = clock::now();
+    const auto end = start + std::chrono::duration_cast<clock::duration>(std::chrono::duration<double>(opt.duration));
+
+    // websocket subscribers share one io_context
+    net::io_context ws_ioc;
+    WsStats ws_stats;
+    std::thread ws_thread;
+    if (opt.ws_clients > 0)
+    {
+        tcp::resolver resolver(ws_ioc);
+        const auto endpoints = resolver.resolve(opt.host, opt.port);
+        for (int i = 0; i < opt.ws_clients; ++i)
+        {
+            std::make_shared<WsClient>(ws_ioc, opt, ws_stats)->start(endpoints);
+        }
+        ws_thread = std::thread([&]() {
+            ws_ioc.run_until(end);
+            ws_ioc.stop();
+        });
+    }
+
+    std::vector<ClientStats> stats(http_clients);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < http_clients; ++i)
+    {
+        threads.emplace_back(http_client, std::cref(opt), 1234 + i, end, std::ref(stats[i]));
+    }
+    for (auto &t : threads)
+    {
+        t.join();
+    }
+    if (ws_thread.joinable())
+    {
+        ws_thread.join();
+    }
+    const double secs = std::chrono::duration<double>(clock::now() - start).count();
+
+    std::vector<double> latencies;
+    std::size_t errors = 0, bytes = 0;
+    for (const auto &s : stats)
+    {
+        latencies.insert(latencies.end(), s.latencies_ms.begin(), s.latencies_ms.end());
+        errors += s.errors;
+        bytes += s.bytes;
+    }
+    std::sort(latencies.begin(), latencies.end());
+
+    fmt::print("scenario   {} ({} http clients, {} ws clients, {:.1f} s)\n", opt.scenario, http_clients, opt.ws_clients, secs);
+    if (http_clients > 0)
+    {
+        fmt::print("requests   {} ({} errors)\n", latencies.size(), errors);
+        fmt::print("throughput {:.1f} req/s, {:.2f} MB/s\n", latencies.size() / secs, bytes / secs / 1e6);
+        fmt::print("latency    p50 {:.2f} ms, p99 {:.2f} ms, max {:.2f} ms\n",
+                   percentile(latencies, 0.5), percentile(latencies, 0.99), latencies.empty() ? 0.0 : latencies.back());
+    }
+    if (opt.ws_clients > 0)
+    {
+        fmt::print("websocket  {} connected, {} messages ({:.1f} msg/s), {} errors\n",
+                   ws_stats.connected.load(), ws_stats.messages.load(), ws_stats.messages.load() / secs, ws_stats.errors.load());
+    }
+    return 0;
+}
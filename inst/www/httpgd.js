@@ -11,6 +11,10 @@ var __awaiter = (this && this.__awaiter) || function (thisArg, _arguments, P, ge
 class HttpgdApi {
     constructor(host, token) {
         this.httpHeaders = new Headers();
+        // Plot view renders are tagged with a client ID and increasing generation,
+        // the server drops queued renders that got superseded.
+        this.client = Math.random().toString(36).substring(2, 10);
+        this.generation = 0;
         this.http = 'http://' + host;
         this.ws = 'ws://' + host;
         this.httpSVG = this.http + '/svg';
@@ -38,6 +42,12 @@ class HttpgdApi {
         url.searchParams.append('id', id);
         return url;
     }
+    svg_view(id, width, height, c) {
+        const url = this.svg_id(id, width, height, c);
+        url.searchParams.append('client', this.client);
+        url.searchParams.append('gen', (++this.generation).toString());
+        return url;
+    }
     svg_ext(width, height, c) {
         const url = new URL(this.httpSVG);
         if (width)
@@ -84,6 +94,16 @@ class HttpgdApi {
             return yield res.json();
         });
     }
+    get_plots_since(upid) {
+        return __awaiter(this, void 0, void 0, function* () {
+            const url = new URL(this.httpPlots);
+            url.searchParams.append('since', upid.toString());
+            const res = yield fetch(url.href, {
+                headers: this.httpHeaders
+            });
+            return yield res.json();
+        });
+    }
     get_clear() {
         return __awaiter(this, void 0, void 0, function* () {
             const res = yield fetch(this.httpClear, {
@@ -273,7 +293,7 @@ class HttpgdNavigator {
         if ((this.last_id !== this.data.plots[this.index].id) ||
             (Math.abs(this.last_width - this.width) > 0.1) ||
             (Math.abs(this.last_height - this.height) > 0.1))
-            return api.svg_id(this.data.plots[this.index].id, this.width, this.height, c).href;
+            return api.svg_view(this.data.plots[this.index].id, this.width, this.height, c).href;
         return undefined;
     }
     update(data) {
@@ -291,15 +311,212 @@ class HttpgdNavigator {
         return Math.max(0, this.index + 1) + '/' + this.data.plots.length;
     }
 }
+class HttpgdCanvasRenderer {
+    static rgba(col) {
+        return 'rgba(' + (col & 255) + ',' + ((col >>> 8) & 255) + ',' + ((col >>> 16) & 255) + ',' + (((col >>> 24) & 255) / 255) + ')';
+    }
+    static render(buffer, pixelRatio) {
+        return __awaiter(this, void 0, void 0, function* () {
+            const view = new DataView(buffer);
+            const magic = String.fromCharCode(view.getUint8(0), view.getUint8(1), view.getUint8(2), view.getUint8(3));
+            if (magic !== 'HGDB' || view.getUint32(4, true) !== 1) {
+                throw new Error('Unsupported plot format.');
+            }
+            const pageWidth = view.getFloat32(8, true);
+            const pageHeight = view.getFloat32(12, true);
+            const viewWidth = view.getFloat32(16, true);
+            const viewHeight = view.getFloat32(20, true);
+            const pageFill = view.getUint32(24, true);
+            const nClips = view.getUint32(28, true);
+            const nStyles = view.getUint32(32, true);
+            const nCalls = view.getUint32(36, true);
+            const nCoords = view.getUint32(40, true);
+            const nInts = view.getUint32(44, true);
+            const nStrings = view.getUint32(48, true);
+            let offset = 52;
+            const clipsAt = offset;
+            offset += nClips * 16;
+            const stylesAt = offset;
+            offset += nStyles * 20;
+            const callsAt = offset;
+            offset += nCalls * HttpgdCanvasRenderer.CALL_SIZE;
+            const coords = new Float32Array(buffer, offset, nCoords);
+            offset += nCoords * 4;
+            const ints = new Int32Array(buffer, offset, nInts);
+            offset += nInts * 4;
+            const strings = new Uint8Array(buffer, offset, nStrings);
+            const decoder = new TextDecoder();
+            const str = (i) => decoder.decode(strings.subarray(ints[i], ints[i] + ints[i + 1]));
+            const images = new Map();
+            const loading = [];
+            for (let i = 0; i < nCalls; i++) {
+                const at = callsAt + i * HttpgdCanvasRenderer.CALL_SIZE;
+                if (view.getUint8(at) === HttpgdCanvasRenderer.RASTER) {
+                    const img = new Image();
+                    img.src = 'data:image/png;base64,' + str(view.getUint32(at + 20, true));
+                    images.set(i, img);
+                    loading.push(img.decode().catch(() => undefined));
+                }
+            }
+            yield Promise.all(loading);
+            const canvas = document.createElement('canvas');
+            canvas.width = Math.max(1, Math.round(viewWidth * pixelRatio));
+            canvas.height = Math.max(1, Math.round(viewHeight * pixelRatio));
+            const ctx = canvas.getContext('2d');
+            if (!ctx)
+                return canvas;
+            ctx.scale(canvas.width / pageWidth, canvas.height / pageHeight);
+            ctx.fillStyle = HttpgdCanvasRenderer.rgba(pageFill | 0xFF000000);
+            ctx.fillRect(0, 0, pageWidth, pageHeight);
+            const stroke = (style) => {
+                const at = stylesAt + style * 20;
+                const col = view.getUint32(at, true);
+                const lty = view.getInt32(at + 8, true);
+                if (((col >>> 24) & 255) === 0 || lty === -1)
+                    return;
+                const lwd = view.getFloat32(at + 4, true);
+                ctx.strokeStyle = HttpgdCanvasRenderer.rgba(col);
+                ctx.lineWidth = lwd / 96 * 72;
+                ctx.lineCap = HttpgdCanvasRenderer.LINE_CAPS[view.getUint8(at + 12)] || 'round';
+                ctx.lineJoin = HttpgdCanvasRenderer.LINE_JOINS[view.getUint8(at + 13)] || 'round';
+                ctx.miterLimit = view.getFloat32(at + 16, true);
+                const dash = [];
+                for (let l = lty, k = 0; k < 8 && (l & 15); k++, l >>= 4) {
+                    dash.push((lwd > 1 ? lwd : 1) * (l & 15));
+                }
+                ctx.setLineDash(dash);
+                ctx.stroke();
+            };
+            const fill = (col, rule) => {
+                if (((col >>> 24) & 255) === 0)
+                    return;
+                ctx.fillStyle = HttpgdCanvasRenderer.rgba(col);
+                ctx.fill(rule);
+            };
+            const polyline = (c0, c1) => {
+                ctx.moveTo(coords[c0], coords[c0 + 1]);
+                for (let c = c0 + 2; c < c1; c += 2) {
+                    ctx.lineTo(coords[c], coords[c + 1]);
+                }
+            };
+            let clip = -1;
+            for (let i = 0; i < nCalls; i++) {
+                const at = callsAt + i * HttpgdCanvasRenderer.CALL_SIZE;
+                const next = at + HttpgdCanvasRenderer.CALL_SIZE;
+                const type = view.getUint8(at);
+                const flags = view.getUint8(at + 1);
+                const clipId = view.getUint32(at + 4, true);
+                const style = view.getUint32(at + 8, true);
+                const col = view.getUint32(at + 12, true);
+                const c0 = view.getUint32(at + 16, true);
+                const c1 = i + 1 < nCalls ? view.getUint32(next + 16, true) : nCoords;
+                const i0 = view.getUint32(at + 20, true);
+                const i1 = i + 1 < nCalls ? view.getUint32(next + 20, true) : nInts;
+                if (clipId !== clip) {
+                    if (clip >= 0)
+                        ctx.restore();
+                    ctx.save();
+                    const ca = clipsAt + clipId * 16;
+                    ctx.beginPath();
+                    ctx.rect(view.getFloat32(ca, true), view.getFloat32(ca + 4, true), view.getFloat32(ca + 8, true), view.getFloat32(ca + 12, true));
+                    ctx.clip();
+                    clip = clipId;
+                }
+                ctx.beginPath();
+                switch (type) {
+                    case HttpgdCanvasRenderer.CIRCLE:
+                        ctx.arc(coords[c0], coords[c0 + 1], coords[c0 + 2], 0, 2 * Math.PI);
+                        fill(col);
+                        stroke(style);
+                        break;
+                    case HttpgdCanvasRenderer.LINE:
+                    case HttpgdCanvasRenderer.POLYLINE:
+                        polyline(c0, c1);
+                        stroke(style);
+                        break;
+                    case HttpgdCanvasRenderer.RECT:
+                        ctx.rect(coords[c0], coords[c0 + 1], coords[c0 + 2], coords[c0 + 3]);
+                        fill(col);
+                        stroke(style);
+                        break;
+                    case HttpgdCanvasRenderer.POLYGON:
+                        polyline(c0, c1);
+                        ctx.closePath();
+                        fill(col);
+                        stroke(style);
+                        break;
+                    case HttpgdCanvasRenderer.PATH:
+                        for (let k = i0, c = c0; k < i1; k++) {
+                            polyline(c, c + ints[k] * 2);
+                            ctx.closePath();
+                            c += ints[k] * 2;
+                        }
+                        fill(col, (flags & 1) ? 'nonzero' : 'evenodd');
+                        stroke(style);
+                        break;
+                    case HttpgdCanvasRenderer.TEXT: {
+                        if (((col >>> 24) & 255) === 0)
+                            break;
+                        const hadj = coords[c0 + 3];
+                        const width = coords[c0 + 5];
+                        ctx.save();
+                        ctx.translate(coords[c0], coords[c0 + 1]);
+                        ctx.rotate(-coords[c0 + 2] * Math.PI / 180);
+                        ctx.textAlign = hadj === 0.5 ? 'center' : (hadj === 1 ? 'right' : 'left');
+                        ctx.font = ((flags & 1) ? 'italic ' : '') + ints[i0] + ' ' + coords[c0 + 4] + 'px ' + str(i0 + 3);
+                        ctx.fillStyle = HttpgdCanvasRenderer.rgba(col);
+                        if (width > 0) {
+                            ctx.fillText(str(i0 + 1), 0, 0, width);
+                        }
+                        else {
+                            ctx.fillText(str(i0 + 1), 0, 0);
+                        }
+                        ctx.restore();
+                        break;
+                    }
+                    case HttpgdCanvasRenderer.RASTER: {
+                        const img = images.get(i);
+                        if (!img)
+                            break;
+                        ctx.save();
+                        ctx.translate(coords[c0], coords[c0 + 1]);
+                        ctx.rotate(-coords[c0 + 4] * Math.PI / 180);
+                        ctx.imageSmoothingEnabled = (flags & 1) !== 0;
+                        ctx.drawImage(img, 0, 0, coords[c0 + 2], coords[c0 + 3]);
+                        ctx.restore();
+                        break;
+                    }
+                }
+            }
+            if (clip >= 0)
+                ctx.restore();
+            return canvas;
+        });
+    }
+}
+HttpgdCanvasRenderer.CIRCLE = 1;
+HttpgdCanvasRenderer.LINE = 2;
+HttpgdCanvasRenderer.RECT = 3;
+HttpgdCanvasRenderer.POLYLINE = 4;
+HttpgdCanvasRenderer.POLYGON = 5;
+HttpgdCanvasRenderer.PATH = 6;
+HttpgdCanvasRenderer.TEXT = 7;
+HttpgdCanvasRenderer.RASTER = 8;
+HttpgdCanvasRenderer.CALL_SIZE = 24;
+HttpgdCanvasRenderer.LINE_CAPS = ['round', 'round', 'butt', 'square'];
+HttpgdCanvasRenderer.LINE_JOINS = ['round', 'round', 'miter', 'bevel'];
 class HttpgdViewer {
-    constructor(host, token, allowWebsockets) {
+    constructor(host, token, allowWebsockets, renderer) {
         this.navi = new HttpgdNavigator();
         this.plotUpid = -1;
         this.scale = HttpgdViewer.SCALE_DEFAULT;
         this.deviceActive = true;
         this.image = undefined;
         this.sidebar = undefined;
+        this.canvasTicket = 0;
+        this.canvas = undefined;
         this.resizeBlocked = false;
+        this.useCanvas = renderer === 'canvas';
         this.connection = new HttpgdConnection(host, token, allowWebsockets);
         this.connection.remoteStateChanged = (remoteState) => this.serverChanges(remoteState);
         this.connection.connectionChanged = (disconnected) => { var _a; return (_a = this.onDisconnectedChange) === null || _a === void 0 ? void 0 : _a.call(this, disconnected); };
@@ -321,13 +538,36 @@ class HttpgdViewer {
         this.updatePlots(true);
     }
     updatePlots(scroll = false) {
-        this.connection.api.get_plots().then(plots => {
+        const apply = (plots) => {
             var _a;
+            this.plots = plots;
             this.navi.update(plots);
             (_a = this.onIndexStringChange) === null || _a === void 0 ? void 0 : _a.call(this, this.navi.indexStr());
             this.updateSidebar(plots, scroll);
             this.updateImage();
-        });
+        };
+        const known = this.plots;
+        if (known) {
+            this.connection.api.get_plots_since(known.state.upid).then(changes => {
+                apply(HttpgdViewer.applyChanges(this.plots || known, changes));
+            });
+        }
+        else {
+            this.connection.api.get_plots().then(apply);
+        }
+    }
+    static applyChanges(plots, changes) {
+        if (changes.reset) {
+            return { state: changes.state, plots: changes.plots || [] };
+        }
+        const removed = new Set((changes.removed || []).map(p => p.id));
+        const res = plots.plots.filter(p => !removed.has(p.id));
+        const ids = new Set(res.map(p => p.id));
+        for (const p of changes.added || []) {
+            if (!ids.has(p.id))
+                res.push(p);
+        }
+        return { state: changes.state, plots: res };
     }
     updateImage(c) {
         if (!this.image)
@@ -335,9 +575,44 @@ class HttpgdViewer {
         const n = this.navi.next(this.connection.api, this.plotUpid + (c ? c : ''));
         if (n) {
             console.log('update image');
-            this.image.src = n;
+            if (this.useCanvas && this.navi.id()) {
+                this.updateCanvas(this.image, n);
+            }
+            else {
+                this.removeCanvas(this.image);
+                this.image.src = n;
+            }
         }
     }
+    updateCanvas(image, href) {
+        const url = new URL(href);
+        url.searchParams.append('format', 'bin');
+        const ticket = ++this.canvasTicket;
+        fetch(url.href).then(res => res.arrayBuffer())
+            .then(buffer => HttpgdCanvasRenderer.render(buffer, window.devicePixelRatio || 1))
+            .then(canvas => {
+            if (ticket !== this.canvasTicket)
+                return;
+            canvas.id = 'drawing-canvas';
+            if (this.canvas) {
+                this.canvas.replaceWith(canvas);
+            }
+            else {
+                image.style.display = 'none';
+                image.after(canvas);
+            }
+            this.canvas = canvas;
+        })
+            .catch(e => console.log('canvas render failed: ' + e));
+    }
+    removeCanvas(image) {
+        ++this.canvasTicket;
+        if (!this.canvas)
+            return;
+        this.canvas.remove();
+        this.canvas = undefined;
+        image.style.display = '';
+    }
     updateSidebar(plots, scroll = false) {
         if (!this.sidebar)
             return;
@@ -454,9 +729,11 @@ class HttpgdViewer {
         document.body.removeChild(dl);
     }
     downloadPlotSVG(image) {
-        if (!this.navi.id())
+        const id = this.navi.id();
+        if (!id)
             return;
-        fetch(image.src).then((response) => {
+        const src = this.useCanvas ? this.connection.api.svg_id(id).href : image.src;
+        fetch(src).then((response) => {
             return response.blob();
         }).then(blob => {
             HttpgdViewer.downloadURL(URL.createObjectURL(blob), 'plot_' + this.navi.id() + '.svg');
@@ -480,7 +757,7 @@ class HttpgdViewer {
             return;
         if (!this.navi.id())
             return;
-        HttpgdViewer.imageTempCanvas(image, canvas => {
+        HttpgdViewer.imageTempCanvas(this.canvas || image, canvas => {
             const imgURI = canvas
                 .toDataURL('image/png')
                 .replace('image/png', 'image/octet-stream');
@@ -494,7 +771,7 @@ class HttpgdViewer {
             return;
         if (!navigator.clipboard)
             return;
-        HttpgdViewer.imageTempCanvas(image, canvas => {
+        HttpgdViewer.imageTempCanvas(this.canvas || image, canvas => {
             canvas.toBlob(blob => {
                 var _a, _b;
                 if (blob)
@@ -505,7 +782,7 @@ class HttpgdViewer {
     checkResize() {
         if (!this.image)
             return;
-        const rect = this.image.getBoundingClientRect();
+        const rect = (this.canvas || this.image).getBoundingClientRect();
         this.navi.resize(rect.width * this.scale, rect.height * this.scale);
         this.updateImage();
     }
@@ -1,50 +1,157 @@
 
-
-//#include <cpp11/protect.hpp>
-#include <mutex>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <later_api.h>
+#include <mutex>
+#include <R_ext/Print.h>
+#include <vector>
 #include "AsyncLater.h"
 
 namespace httpgd
 {
     namespace asynclater
     {
+        namespace
+        {
+            struct Call
+            {
+                std::function<void()> func;
+                std::promise<void> done;
+                Call *next;
+            };
 
-        std::mutex later_mutex;
+            // Lock free multi producer single consumer queue: Producers push
+            // to the head of a singly linked list, the R thread takes the
+            // whole list at once and runs it in reverse (FIFO) order.
+            std::atomic<Call *> queue_head{nullptr};
 
-        struct AsyncLaterData
-        {
-            void (*func)(void *);
-            void *data;
-        } rsdat;
+            // Wakes the R thread while it waits for further calls. Producers
+            // only take the mutex while the R thread is waiting.
+            std::atomic<bool> lingering{false};
+            std::mutex linger_mutex;
+            std::condition_variable linger_cv;
 
-        void later(void (*func)(void *), void *data, double secs)
-        {
-            later_mutex.lock();
-            rsdat.data = data;
-            rsdat.func = func;
-            later::later([](void *data) {
-                try
+            // R thread only
+            bool draining = false;
+            std::vector<std::function<void()>> after;
+            double after_linger = 0;
+
+            // Returns true if a call was queued within t_seconds.
+            bool wait_for_calls(double t_seconds)
+            {
+                const auto deadline = std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(t_seconds));
+                lingering = true;
+                bool queued;
+                {
+                    std::unique_lock<std::mutex> lock(linger_mutex);
+                    queued = linger_cv.wait_until(lock, deadline, []() { return queue_head.load() != nullptr; });
+                }
+                lingering = false;
+                return queued;
+            }
+
+            void drain(void *)
+            {
+                draining = true;
+                for (;;)
                 {
-                    //cpp11::unwind_protect([&data]() { 
-                        auto d = static_cast<AsyncLaterData *>(data);
-                        d->func(d->data);
-                        //return R_NilValue;
-                    //});
+                    Call *calls;
+                    while ((calls = queue_head.exchange(nullptr, std::memory_order_acquire)) != nullptr)
+                    {
+                        Call *fifo = nullptr;
+                        while (calls)
+                        {
+                            Call *next = calls->next;
+                            calls->next = fifo;
+                            fifo = calls;
+                            calls = next;
+                        }
+
+                        while (fifo)
+                        {
+                            Call *call = fifo;
+                            fifo = fifo->next;
+                            try
+                            {
+                                call->func();
+                                call->done.set_value();
+                            }
+                            catch (...)
+                            {
+                                call->done.set_exception(std::current_exception());
+                            }
+                            delete call;
+                        }
+                    }
+                    // Calls that arrive shortly after the last one (e.g. a
+                    // client stepping through plots) share the functions
+                    // that run after the calls.
+                    if (after.empty() || after_linger <= 0 || !wait_for_calls(after_linger))
+                    {
+                        break;
+                    }
                 }
-                catch (...)
+                draining = false;
+
+                auto funcs = std::move(after);
+                after.clear();
+                after_linger = 0;
+                // nothing waits for these, errors can only be reported
+                for (auto &func : funcs)
                 {
-                    REprintf("AsyncLater error");
-                } // make sure mutex gets unlocked (does not work)
-                later_mutex.unlock();
-            },
-                         &rsdat, secs);
+                    try
+                    {
+                        func();
+                    }
+                    catch (const std::exception &e)
+                    {
+                        REprintf("httpgd: Error after server calls: %s\n", e.what());
+                    }
+                    catch (...)
+                    {
+                        REprintf("httpgd: Error after server calls.\n");
+                    }
+                }
+            }
+        } // namespace
+
+        std::future<void> later(std::function<void()> func)
+        {
+            auto call = new Call{std::move(func), std::promise<void>(), nullptr};
+            auto future = call->done.get_future();
+
+            Call *head = queue_head.load(std::memory_order_relaxed);
+            do
+            {
+                call->next = head;
+            } while (!queue_head.compare_exchange_weak(head, call, std::memory_order_seq_cst, std::memory_order_relaxed));
+
+            if (lingering)
+            {
+                const std::lock_guard<std::mutex> lock(linger_mutex);
+                linger_cv.notify_one();
+            }
+
+            // The first call in an empty queue schedules the drain callback,
+            // the following ones get picked up by it.
+            if (head == nullptr)
+            {
+                later::later(drain, nullptr, 0.0);
+            }
+            return future;
         }
 
-        void awaitLater()
+        void after_calls(std::function<void()> func, double linger)
         {
-            later_mutex.lock();
-            later_mutex.unlock();
+            if (!draining)
+            {
+                func();
+                return;
+            }
+            after.push_back(std::move(func));
+            after_linger = std::max(after_linger, linger);
         }
 
     } // namespace asynclater
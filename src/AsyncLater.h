@@ -1,14 +1,27 @@
 #ifndef HTTPGD_RSYNC_H
 #define HTTPGD_RSYNC_H
 
+#include <functional>
+#include <future>
+
 namespace httpgd
 {
     namespace asynclater
     {
-        // Thread safe later
-        void later(void (*func)(void *), void *data, double secs);
-        void awaitLater();
+        // Thread safe later: Queues func to run in the R main thread.
+        // Any number of threads may queue calls concurrently, the queue is
+        // drained by a single later callback. The returned future is ready
+        // when func returned (or holds the exception it threw).
+        std::future<void> later(std::function<void()> func);
+
+        // Runs func when the queued calls that are being run are done
+        // (including calls queued in the meantime) and no further call was
+        // queued for linger seconds, before control returns to R. The R
+        // thread waits for further calls in the meantime. Runs func right
+        // away when not called from a queued call. Must be called from the
+        // R main thread.
+        void after_calls(std::function<void()> func, double linger);
     } // namespace asynclater
 } // namespace httpgd
 
-#endif
\ No newline at end of file
+#endif
@@ -1,25 +1,34 @@
 
 #include "DrawData.h"
 
-#include "lib/svglite_utils.h"
+#include "lib/svglite_encode.h"
 
 #include <cmath>
+#include <cstring>
+#include <limits>
 #include <fmt/ostream.h>
 #include <string>
+#include <string_view>
 #include <vector>
 
+// Do not include any R headers here !
+
 namespace httpgd::dc
 {
+    // R line types (LTY_BLANK, LTY_SOLID in R_ext/GraphicsEngine.h)
+    constexpr int LINETYPE_BLANK = -1;
+    constexpr int LINETYPE_SOLID = 0;
+
     inline void css_fill_or_none(fmt::memory_buffer &os, color_t col)
     {
-        int alpha = R_ALPHA(col);
+        int alpha = color::alpha(col);
         if (alpha == 0)
         {
             fmt::format_to(os, "fill: none;");
         }
         else
         {
-            fmt::format_to(os, "fill: #{:02X}{:02X}{:02X};", R_RED(col), R_GREEN(col), R_BLUE(col));
+            fmt::format_to(os, "fill: #{:02X}{:02X}{:02X};", color::red(col), color::green(col), color::blue(col));
             if (alpha != 255)
             {
                 fmt::format_to(os, "fill-opacity: {:.2f};", alpha / 255.0);
@@ -29,10 +38,10 @@ namespace httpgd::dc
 
     inline void css_fill_or_omit(fmt::memory_buffer &os, color_t col)
     {
-        int alpha = R_ALPHA(col);
+        int alpha = color::alpha(col);
         if (alpha != 0)
         {
-            fmt::format_to(os, "fill: #{:02X}{:02X}{:02X};", R_RED(col), R_GREEN(col), R_BLUE(col));
+            fmt::format_to(os, "fill: #{:02X}{:02X}{:02X};", color::red(col), color::green(col), color::blue(col));
             if (alpha != 255)
             {
                 fmt::format_to(os, "fill-opacity: {:.2f};", alpha / 255.0);
@@ -53,16 +62,16 @@ namespace httpgd::dc
         fmt::format_to(os, "stroke-width: {:.2f};", line.lwd / 96.0 * 72);
 
         // Default is "stroke: #000000;" as declared in <style>
-        if (line.col != R_RGBA(0, 0, 0, 255))
+        if (line.col != color::rgba(0, 0, 0, 255))
         {
-            int alpha = R_ALPHA(line.col);
+            int alpha = color::alpha(line.col);
             if (alpha == 0)
             {
                 fmt::format_to(os, "stroke: none;");
             }
             else
             {
-                fmt::format_to(os, "stroke: #{:02X}{:02X}{:02X};", R_RED(line.col), R_GREEN(line.col), R_BLUE(line.col));
+                fmt::format_to(os, "stroke: #{:02X}{:02X}{:02X};", color::red(line.col), color::green(line.col), color::blue(line.col));
                 if (alpha != 255)
                 {
                     fmt::format_to(os, "stroke-opacity: {:.2f};", alpha / 255.0);
@@ -74,8 +83,8 @@ namespace httpgd::dc
         int lty = line.lty;
         switch (lty)
         {
-        case LTY_BLANK: // never called: blank lines never get to this point
-        case LTY_SOLID: // default svg setting, so don't need to write out
+        case LINETYPE_BLANK: // never called: blank lines never get to this point
+        case LINETYPE_SOLID: // default svg setting, so don't need to write out
             break;
         default:
             // For details
@@ -129,6 +138,342 @@ namespace httpgd::dc
         }
     }
 
+    // BINARY FORMAT
+
+    // Bounding boxes
+
+    // Draw calls of unknown extent are always included
+    constexpr rect<double> BBOX_ALL = {-1e30, -1e30, 2e30, 2e30};
+
+    // Distance the stroke reaches out of the geometry
+    inline double stroke_pad(const LineInfo &line)
+    {
+        if (line.lty == LINETYPE_BLANK || color::alpha(line.col) == 0)
+        {
+            return 0;
+        }
+        const double half = line.lwd / 96.0 * 72 / 2;
+        // square caps reach out diagonally, mitre joins up to the mitre limit
+        double factor = line.lend == LineInfo::GC_SQUARE_CAP ? 1.5 : 1;
+        if (line.ljoin == LineInfo::GC_MITRE_JOIN)
+        {
+            factor = std::max(factor, line.lmitre);
+        }
+        return half * factor;
+    }
+
+    inline rect<double> bbox_pad(rect<double> t_rect, double t_pad)
+    {
+        return {t_rect.x - t_pad, t_rect.y - t_pad, t_rect.width + 2 * t_pad, t_rect.height + 2 * t_pad};
+    }
+
+    inline rect<double> bbox_points(const std::vector<vertex<double>> &t_points, double t_pad)
+    {
+        if (t_points.empty())
+        {
+            return {0, 0, 0, 0};
+        }
+        double x0 = t_points.front().x, x1 = x0, y0 = t_points.front().y, y1 = y0;
+        for (const auto &p : t_points)
+        {
+            x0 = std::min(x0, p.x);
+            x1 = std::max(x1, p.x);
+            y0 = std::min(y0, p.y);
+            y1 = std::max(y1, p.y);
+        }
+        return bbox_pad({x0, y0, x1 - x0, y1 - y0}, t_pad);
+    }
+
+    // Box (t_x0, t_y0) - (t_x1, t_y1) relative to t_origin, rotated by t_rot
+    // degrees counter clockwise around it (like SVG rotate(-t_rot))
+    inline rect<double> bbox_rotated(vertex<double> t_origin, double t_x0, double t_y0, double t_x1, double t_y1, double t_rot)
+    {
+        const double a = -t_rot * 3.14159265358979323846 / 180.0;
+        const double c = std::cos(a), s = std::sin(a);
+        double x0 = std::numeric_limits<double>::infinity(), x1 = -x0, y0 = x0, y1 = -x0;
+        for (const auto &p : {vertex<double>{t_x0, t_y0}, vertex<double>{t_x1, t_y0}, vertex<double>{t_x0, t_y1}, vertex<double>{t_x1, t_y1}})
+        {
+            const double x = t_origin.x + p.x * c - p.y * s;
+            const double y = t_origin.y + p.x * s + p.y * c;
+            x0 = std::min(x0, x);
+            x1 = std::max(x1, x);
+            y0 = std::min(y0, y);
+            y1 = std::max(y1, y);
+        }
+        return {x0, y0, x1 - x0, y1 - y0};
+    }
+
+    // Symbols: draw calls that only differ in their position are defined
+    // once if used this often
+    constexpr std::size_t SYMBOL_MIN_USES = 3;
+    constexpr std::size_t SYMBOL_MAX_POINTS = 8;
+    // Distinct elements that are counted, pages of mostly unique elements
+    // (e.g. bubble charts) stop counting once this many were seen
+    constexpr std::size_t SYMBOL_MAX_CANDIDATES = 4096;
+
+    // Joined lines: only opaque solid lines look the same as one path
+    // (no alpha blending where they cross, no dash pattern restarts).
+    inline bool line_joinable(const LineInfo &line)
+    {
+        return line.lty == LINETYPE_SOLID && color::alpha(line.col) == 255;
+    }
+
+    inline bool line_equals(const LineInfo &a, const LineInfo &b)
+    {
+        return a.col == b.col && a.lwd == b.lwd && a.lty == b.lty &&
+               a.lend == b.lend && a.ljoin == b.ljoin && a.lmitre == b.lmitre;
+    }
+
+    // Hit testing
+
+    inline double stroke_half(const LineInfo &line)
+    {
+        if (line.lty == LINETYPE_BLANK || color::alpha(line.col) == 0)
+        {
+            return -1; // not drawn
+        }
+        return line.lwd / 96.0 * 72 / 2;
+    }
+
+    inline double segment_distance(vertex<double> p, vertex<double> a, vertex<double> b)
+    {
+        const double dx = b.x - a.x, dy = b.y - a.y;
+        const double len2 = dx * dx + dy * dy;
+        const double t = len2 > 0 ? std::clamp(((p.x - a.x) * dx + (p.y - a.y) * dy) / len2, 0.0, 1.0) : 0.0;
+        return std::hypot(p.x - (a.x + t * dx), p.y - (a.y + t * dy));
+    }
+
+    // Whether an edge of the points [t_begin, t_end) is within t_radius of
+    // t_point. Closed rings also connect the last to the first point.
+    inline bool near_edges(const std::vector<vertex<double>> &t_points, std::size_t t_begin, std::size_t t_end,
+                           vertex<double> t_point, double t_radius, bool t_closed)
+    {
+        if (t_radius < 0 || t_begin >= t_end)
+        {
+            return false;
+        }
+        if (t_end - t_begin == 1)
+        {
+            return segment_distance(t_point, t_points[t_begin], t_points[t_begin]) <= t_radius;
+        }
+        for (std::size_t i = t_begin + 1; i < t_end; ++i)
+        {
+            if (segment_distance(t_point, t_points[i - 1], t_points[i]) <= t_radius)
+            {
+                return true;
+            }
+        }
+        return t_closed && segment_distance(t_point, t_points[t_end - 1], t_points[t_begin]) <= t_radius;
+    }
+
+    // Winding number of the ring [t_begin, t_end) around t_point
+    inline int winding_number(const std::vector<vertex<double>> &t_points, std::size_t t_begin, std::size_t t_end, vertex<double> t_point)
+    {
+        int wn = 0;
+        for (std::size_t i = t_begin; i < t_end; ++i)
+        {
+            const auto &a = t_points[i];
+            const auto &b = t_points[i + 1 < t_end ? i + 1 : t_begin];
+            const double left = (b.x - a.x) * (t_point.y - a.y) - (t_point.x - a.x) * (b.y - a.y);
+            if (a.y <= t_point.y)
+            {
+                if (b.y > t_point.y && left > 0)
+                {
+                    wn++;
+                }
+            }
+            else if (b.y <= t_point.y && left < 0)
+            {
+                wn--;
+            }
+        }
+        return wn;
+    }
+
+    inline std::size_t nearest_point(const std::vector<vertex<double>> &t_points, vertex<double> t_point)
+    {
+        std::size_t res = 0;
+        double best = std::numeric_limits<double>::infinity();
+        for (std::size_t i = 0; i < t_points.size(); ++i)
+        {
+            const double d = std::hypot(t_points[i].x - t_point.x, t_points[i].y - t_point.y);
+            if (d < best)
+            {
+                best = d;
+                res = i;
+            }
+        }
+        return res;
+    }
+
+    // JSON
+
+    inline void json_color(fmt::memory_buffer &os, const char *t_name, color_t t_col)
+    {
+        fmt::format_to(os, R""(, "{}": "#{:02X}{:02X}{:02X}{:02X}")"", t_name,
+                       color::red(t_col), color::green(t_col), color::blue(t_col), color::alpha(t_col));
+    }
+
+    inline void json_line(fmt::memory_buffer &os, const LineInfo &t_line)
+    {
+        json_color(os, "col", t_line.col);
+        fmt::format_to(os, R""(, "lwd": {:.2f}, "lty": {})"", t_line.lwd, t_line.lty);
+    }
+
+    inline void json_points(fmt::memory_buffer &os, const std::vector<vertex<double>> &t_points, vertex<double> t_point)
+    {
+        fmt::format_to(os, R""(, "points": {})"", t_points.size());
+        if (!t_points.empty())
+        {
+            const std::size_t i = nearest_point(t_points, t_point);
+            fmt::format_to(os, R""(, "nearest": {}, "x": {:.2f}, "y": {:.2f})"", i, t_points[i].x, t_points[i].y);
+        }
+    }
+
+    inline void write_json_escaped(fmt::memory_buffer &os, const std::string &text)
+    {
+        for (const char &c : text)
+        {
+            switch (c)
+            {
+            case '"':
+                fmt::format_to(os, "\\\"");
+                break;
+            case '\\':
+                fmt::format_to(os, "\\\\");
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    fmt::format_to(os, "\\u{:04x}", static_cast<int>(c));
+                }
+                else
+                {
+                    os.push_back(c);
+                }
+            }
+        }
+    }
+
+    // All numbers are little endian.
+    inline void bin_u32(std::string &os, uint32_t t_value)
+    {
+        const char bytes[4] = {
+            static_cast<char>(t_value & 255),
+            static_cast<char>((t_value >> 8) & 255),
+            static_cast<char>((t_value >> 16) & 255),
+            static_cast<char>((t_value >> 24) & 255)};
+        os.append(bytes, 4);
+    }
+    inline void bin_f32(std::string &os, float t_value)
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &t_value, sizeof(bits));
+        bin_u32(os, bits);
+    }
+
+    void BinaryWriter::call(Type t_type, uint8_t t_flags, clip_id_t t_clip, uint32_t t_style, color_t t_color)
+    {
+        m_calls.push_back(static_cast<char>(t_type));
+        m_calls.push_back(static_cast<char>(t_flags));
+        m_calls.append(2, '\0');
+        bin_u32(m_calls, static_cast<uint32_t>(t_clip));
+        bin_u32(m_calls, t_style);
+        bin_u32(m_calls, static_cast<uint32_t>(t_color));
+        bin_u32(m_calls, static_cast<uint32_t>(coords.size()));
+        bin_u32(m_calls, static_cast<uint32_t>(ints.size()));
+        m_calls_count++;
+    }
+
+    uint32_t BinaryWriter::style(const LineInfo &t_line)
+    {
+        std::string record;
+        record.reserve(20);
+        bin_u32(record, static_cast<uint32_t>(t_line.col));
+        bin_f32(record, static_cast<float>(t_line.lwd));
+        bin_u32(record, static_cast<uint32_t>(t_line.lty));
+        record.push_back(static_cast<char>(t_line.lend));
+        record.push_back(static_cast<char>(t_line.ljoin));
+        record.append(2, '\0');
+        bin_f32(record, static_cast<float>(t_line.lmitre));
+
+        // Most plots only use a handful of line styles
+        auto it = m_style_index.find(record);
+        if (it != m_style_index.end())
+        {
+            return it->second;
+        }
+        const auto index = static_cast<uint32_t>(m_style_index.size());
+        m_styles.append(record);
+        m_style_index.emplace(std::move(record), index);
+        return index;
+    }
+
+    void BinaryWriter::string(const std::string &t_str)
+    {
+        ints.push_back(static_cast<int32_t>(m_strings.size()));
+        ints.push_back(static_cast<int32_t>(t_str.size()));
+        m_strings.append(t_str);
+    }
+
+    void BinaryWriter::point(vertex<double> t_point)
+    {
+        coords.push_back(static_cast<float>(t_point.x));
+        coords.push_back(static_cast<float>(t_point.y));
+    }
+
+    void BinaryWriter::points(const std::vector<vertex<double>> &t_points)
+    {
+        coords.reserve(coords.size() + t_points.size() * 2);
+        for (const auto &p : t_points)
+        {
+            point(p);
+        }
+    }
+
+    void BinaryWriter::clip(rect<double> t_rect)
+    {
+        bin_f32(m_clips, static_cast<float>(t_rect.x));
+        bin_f32(m_clips, static_cast<float>(t_rect.y));
+        bin_f32(m_clips, static_cast<float>(t_rect.width));
+        bin_f32(m_clips, static_cast<float>(t_rect.height));
+        m_clips_count++;
+    }
+
+    void BinaryWriter::write(std::string &os, vertex<double> t_size, vertex<double> t_view_size, color_t t_fill) const
+    {
+        os.reserve(os.size() + 52 + m_clips.size() + m_styles.size() + m_calls.size() +
+                   (coords.size() + ints.size()) * 4 + m_strings.size());
+        os.append("HGDB", 4);
+        bin_u32(os, 1); // version
+        bin_f32(os, static_cast<float>(t_size.x));
+        bin_f32(os, static_cast<float>(t_size.y));
+        bin_f32(os, static_cast<float>(t_view_size.x));
+        bin_f32(os, static_cast<float>(t_view_size.y));
+        bin_u32(os, static_cast<uint32_t>(t_fill));
+        bin_u32(os, m_clips_count);
+        bin_u32(os, static_cast<uint32_t>(m_style_index.size()));
+        bin_u32(os, m_calls_count);
+        bin_u32(os, static_cast<uint32_t>(coords.size()));
+        bin_u32(os, static_cast<uint32_t>(ints.size()));
+        bin_u32(os, static_cast<uint32_t>(m_strings.size()));
+
+        // Every section is a multiple of 4 bytes long, coords and ints can
+        // be read as typed arrays.
+        os.append(m_clips);
+        os.append(m_styles);
+        os.append(m_calls);
+        for (float c : coords)
+        {
+            bin_f32(os, c);
+        }
+        for (int32_t i : ints)
+        {
+            bin_u32(os, static_cast<uint32_t>(i));
+        }
+        os.append(m_strings);
+    }
+
     // DRAW CALL OBJECTS
 
     clip_id_t DrawCall::clip_id() const
@@ -146,8 +491,43 @@ namespace httpgd::dc
         fmt::format_to(os, "<!-- unknown draw call -->");
     }
 
+    bool DrawCall::svg_symbol(fmt::memory_buffer & /*os*/, vertex<double> & /*t_anchor*/) const
+    {
+        return false;
+    }
+
+    const LineInfo *DrawCall::svg_line() const
+    {
+        return nullptr;
+    }
+
+    void DrawCall::svg_path_data(fmt::memory_buffer & /*os*/) const
+    {
+    }
+
+    void DrawCall::bin(BinaryWriter & /*os*/) const
+    {
+    }
+
+    rect<double> DrawCall::bbox() const
+    {
+        return BBOX_ALL;
+    }
+
+    bool DrawCall::hit(vertex<double> t_point, double t_radius) const
+    {
+        const auto b = bbox();
+        return t_point.x + t_radius >= b.x && t_point.x - t_radius <= b.x + b.width &&
+               t_point.y + t_radius >= b.y && t_point.y - t_radius <= b.y + b.height;
+    }
+
+    void DrawCall::json(fmt::memory_buffer &os, vertex<double> /*t_point*/) const
+    {
+        fmt::format_to(os, R""("type": "unknown")"");
+    }
+
     Text::Text(color_t t_col, vertex<double> t_pos, std::string &&t_str, double t_rot, double t_hadj, TextInfo &&t_text)
-        : m_col(t_col), m_pos(t_pos), m_rot(t_rot), m_hadj(t_hadj), m_str(t_str), m_text(t_text)
+        : m_col(t_col), m_pos(t_pos), m_rot(t_rot), m_hadj(t_hadj), m_str(std::move(t_str)), m_text(std::move(t_text))
     {
     }
     void Text::svg(fmt::memory_buffer &os) const
@@ -193,7 +573,7 @@ namespace httpgd::dc
         {
             fmt::format_to(os, "font-style: italic;");
         }
-        if (m_col != (int)R_RGB(0, 0, 0))
+        if (m_col != color::rgb(0, 0, 0))
         {
             css_fill_or_none(os, m_col);
         }
@@ -210,9 +590,36 @@ namespace httpgd::dc
         write_xml_escaped(os, m_str);
         fmt::format_to(os, "</text></g>");
     }
+    void Text::bin(BinaryWriter &os) const
+    {
+        os.call(BinaryWriter::TEXT, m_text.italic ? 1 : 0, clip_id(), 0, m_col);
+        os.point(m_pos);
+        os.coords.push_back(static_cast<float>(m_rot));
+        os.coords.push_back(static_cast<float>(m_hadj));
+        os.coords.push_back(static_cast<float>(m_text.fontsize));
+        os.coords.push_back(static_cast<float>(m_text.txtwidth_px));
+        os.ints.push_back(m_text.weight);
+        os.string(m_str);
+        os.string(m_text.font_family);
+        os.string(m_text.features);
+    }
+    rect<double> Text::bbox() const
+    {
+        // the text width is not always known, estimate it generously
+        const double width = m_text.txtwidth_px > 0 ? m_text.txtwidth_px : m_text.fontsize * m_str.size();
+        return bbox_rotated(m_pos, -m_hadj * width, -m_text.fontsize, (1 - m_hadj) * width, m_text.fontsize * 0.3, m_rot);
+    }
+    void Text::json(fmt::memory_buffer &os, vertex<double> /*t_point*/) const
+    {
+        fmt::format_to(os, R""("type": "text", "x": {:.2f}, "y": {:.2f}, "rot": {:.2f}, "hadj": {:.2f}, "fontsize": {:.2f}, "str": ")"",
+                       m_pos.x, m_pos.y, m_rot, m_hadj, m_text.fontsize);
+        write_json_escaped(os, m_str);
+        fmt::format_to(os, "\"");
+        json_color(os, "col", m_col);
+    }
 
     Circle::Circle(LineInfo &&t_line, color_t t_fill, vertex<double> t_pos, double t_radius)
-        : m_line(t_line), m_fill(t_fill), m_pos(t_pos), m_radius(t_radius)
+        : m_line(std::move(t_line)), m_fill(t_fill), m_pos(t_pos), m_radius(t_radius)
     {
     }
     void Circle::svg(fmt::memory_buffer &os) const
@@ -225,9 +632,40 @@ namespace httpgd::dc
         css_fill_or_omit(os, m_fill);
         fmt::format_to(os, "\"/>");
     }
+    bool Circle::svg_symbol(fmt::memory_buffer &os, vertex<double> &t_anchor) const
+    {
+        t_anchor = m_pos;
+        fmt::format_to(os, R""(<circle r="{:.2f}" style=")"", m_radius);
+        css_lineinfo(os, m_line);
+        css_fill_or_omit(os, m_fill);
+        fmt::format_to(os, "\"/>");
+        return true;
+    }
+    void Circle::bin(BinaryWriter &os) const
+    {
+        os.call(BinaryWriter::CIRCLE, 0, clip_id(), os.style(m_line), m_fill);
+        os.point(m_pos);
+        os.coords.push_back(static_cast<float>(m_radius));
+    }
+    rect<double> Circle::bbox() const
+    {
+        const double r = m_radius + stroke_pad(m_line);
+        return {m_pos.x - r, m_pos.y - r, 2 * r, 2 * r};
+    }
+    bool Circle::hit(vertex<double> t_point, double t_radius) const
+    {
+        // points are hit anywhere inside, even without fill
+        return std::hypot(t_point.x - m_pos.x, t_point.y - m_pos.y) <= m_radius + t_radius + std::max(stroke_half(m_line), 0.0);
+    }
+    void Circle::json(fmt::memory_buffer &os, vertex<double> /*t_point*/) const
+    {
+        fmt::format_to(os, R""("type": "circle", "x": {:.2f}, "y": {:.2f}, "r": {:.2f})"", m_pos.x, m_pos.y, m_radius);
+        json_line(os, m_line);
+        json_color(os, "fill", m_fill);
+    }
 
     Line::Line(LineInfo &&t_line, vertex<double> t_orig, vertex<double> t_dest)
-        : m_line(t_line), m_orig(t_orig), m_dest(t_dest)
+        : m_line(std::move(t_line)), m_orig(t_orig), m_dest(t_dest)
     {
     }
     void Line::svg(fmt::memory_buffer &os) const
@@ -239,9 +677,38 @@ namespace httpgd::dc
         css_lineinfo(os, m_line);
         fmt::format_to(os, "\"/>");
     }
+    const LineInfo *Line::svg_line() const
+    {
+        return &m_line;
+    }
+    void Line::svg_path_data(fmt::memory_buffer &os) const
+    {
+        fmt::format_to(os, "M{:.2f},{:.2f}L{:.2f},{:.2f}", m_orig.x, m_orig.y, m_dest.x, m_dest.y);
+    }
+    void Line::bin(BinaryWriter &os) const
+    {
+        os.call(BinaryWriter::LINE, 0, clip_id(), os.style(m_line), 0);
+        os.point(m_orig);
+        os.point(m_dest);
+    }
+    rect<double> Line::bbox() const
+    {
+        return bbox_points({m_orig, m_dest}, stroke_pad(m_line));
+    }
+    bool Line::hit(vertex<double> t_point, double t_radius) const
+    {
+        const double half = stroke_half(m_line);
+        return half >= 0 && segment_distance(t_point, m_orig, m_dest) <= t_radius + half;
+    }
+    void Line::json(fmt::memory_buffer &os, vertex<double> /*t_point*/) const
+    {
+        fmt::format_to(os, R""("type": "line", "x1": {:.2f}, "y1": {:.2f}, "x2": {:.2f}, "y2": {:.2f})"",
+                       m_orig.x, m_orig.y, m_dest.x, m_dest.y);
+        json_line(os, m_line);
+    }
 
     Rect::Rect(LineInfo &&t_line, color_t t_fill, rect<double> t_rect)
-        : m_line(t_line), m_fill(t_fill), m_rect(t_rect)
+        : m_line(std::move(t_line)), m_fill(t_fill), m_rect(t_rect)
     {
     }
     void Rect::svg(fmt::memory_buffer &os) const
@@ -258,9 +725,47 @@ namespace httpgd::dc
         css_fill_or_omit(os, m_fill);
         fmt::format_to(os, "\"/>");
     }
+    bool Rect::svg_symbol(fmt::memory_buffer &os, vertex<double> &t_anchor) const
+    {
+        t_anchor = {m_rect.x, m_rect.y};
+        fmt::format_to(os, R""(<rect width="{:.2f}" height="{:.2f}" style=")"", m_rect.width, m_rect.height);
+        css_lineinfo(os, m_line);
+        css_fill_or_omit(os, m_fill);
+        fmt::format_to(os, "\"/>");
+        return true;
+    }
+    void Rect::bin(BinaryWriter &os) const
+    {
+        os.call(BinaryWriter::RECT, 0, clip_id(), os.style(m_line), m_fill);
+        os.point({m_rect.x, m_rect.y});
+        os.point({m_rect.width, m_rect.height});
+    }
+    rect<double> Rect::bbox() const
+    {
+        return bbox_pad(m_rect, stroke_pad(m_line));
+    }
+    bool Rect::hit(vertex<double> t_point, double t_radius) const
+    {
+        if (color::alpha(m_fill) != 0 &&
+            t_point.x >= m_rect.x && t_point.x <= m_rect.x + m_rect.width &&
+            t_point.y >= m_rect.y && t_point.y <= m_rect.y + m_rect.height)
+        {
+            return true;
+        }
+        const double x1 = m_rect.x + m_rect.width, y1 = m_rect.y + m_rect.height;
+        const double half = stroke_half(m_line);
+        return near_edges({{m_rect.x, m_rect.y}, {x1, m_rect.y}, {x1, y1}, {m_rect.x, y1}}, 0, 4, t_point, half < 0 ? -1 : t_radius + half, true);
+    }
+    void Rect::json(fmt::memory_buffer &os, vertex<double> /*t_point*/) const
+    {
+        fmt::format_to(os, R""("type": "rect", "x": {:.2f}, "y": {:.2f}, "width": {:.2f}, "height": {:.2f})"",
+                       m_rect.x, m_rect.y, m_rect.width, m_rect.height);
+        json_line(os, m_line);
+        json_color(os, "fill", m_fill);
+    }
 
     Polyline::Polyline(LineInfo &&t_line, std::vector<vertex<double>> &&t_points)
-        : m_line(t_line), m_points(t_points)
+        : m_line(std::move(t_line)), m_points(std::move(t_points))
     {
     }
     void Polyline::svg(fmt::memory_buffer &os) const
@@ -278,8 +783,39 @@ namespace httpgd::dc
         css_lineinfo(os, m_line);
         fmt::format_to(os, "\"/>");
     }
+    const LineInfo *Polyline::svg_line() const
+    {
+        return &m_line;
+    }
+    void Polyline::svg_path_data(fmt::memory_buffer &os) const
+    {
+        for (auto it = m_points.begin(); it != m_points.end(); ++it)
+        {
+            fmt::format_to(os, it == m_points.begin() ? "M{:.2f},{:.2f}" : (it == m_points.begin() + 1 ? "L{:.2f},{:.2f}" : " {:.2f},{:.2f}"), it->x, it->y);
+        }
+    }
+    void Polyline::bin(BinaryWriter &os) const
+    {
+        os.call(BinaryWriter::POLYLINE, 0, clip_id(), os.style(m_line), 0);
+        os.points(m_points);
+    }
+    rect<double> Polyline::bbox() const
+    {
+        return bbox_points(m_points, stroke_pad(m_line));
+    }
+    bool Polyline::hit(vertex<double> t_point, double t_radius) const
+    {
+        const double half = stroke_half(m_line);
+        return near_edges(m_points, 0, m_points.size(), t_point, half < 0 ? -1 : t_radius + half, false);
+    }
+    void Polyline::json(fmt::memory_buffer &os, vertex<double> t_point) const
+    {
+        fmt::format_to(os, R""("type": "polyline")"");
+        json_points(os, m_points, t_point);
+        json_line(os, m_line);
+    }
     Polygon::Polygon(LineInfo &&t_line, color_t t_fill, std::vector<vertex<double>> &&t_points)
-        : m_line(t_line), m_fill(t_fill), m_points(t_points)
+        : m_line(std::move(t_line)), m_fill(t_fill), m_points(std::move(t_points))
     {
     }
     void Polygon::svg(fmt::memory_buffer &os) const
@@ -302,8 +838,56 @@ namespace httpgd::dc
 
         fmt::format_to(os, "/>");
     }
+    bool Polygon::svg_symbol(fmt::memory_buffer &os, vertex<double> &t_anchor) const
+    {
+        // marker shapes (triangles, diamonds, ...) only
+        if (m_points.empty() || m_points.size() > SYMBOL_MAX_POINTS)
+        {
+            return false;
+        }
+        t_anchor = m_points.front();
+        fmt::format_to(os, "<polygon points=\"");
+        for (auto it = m_points.begin(); it != m_points.end(); ++it)
+        {
+            if (it != m_points.begin())
+            {
+                fmt::format_to(os, " ");
+            }
+            fmt::format_to(os, "{:.2f},{:.2f}", it->x - t_anchor.x, it->y - t_anchor.y);
+        }
+        fmt::format_to(os, "\" style=\"");
+        css_lineinfo(os, m_line);
+        css_fill_or_omit(os, m_fill);
+        fmt::format_to(os, "\"/>");
+        return true;
+    }
+    void Polygon::bin(BinaryWriter &os) const
+    {
+        os.call(BinaryWriter::POLYGON, 0, clip_id(), os.style(m_line), m_fill);
+        os.points(m_points);
+    }
+    rect<double> Polygon::bbox() const
+    {
+        return bbox_points(m_points, stroke_pad(m_line));
+    }
+    bool Polygon::hit(vertex<double> t_point, double t_radius) const
+    {
+        if (color::alpha(m_fill) != 0 && winding_number(m_points, 0, m_points.size(), t_point) != 0)
+        {
+            return true;
+        }
+        const double half = stroke_half(m_line);
+        return near_edges(m_points, 0, m_points.size(), t_point, half < 0 ? -1 : t_radius + half, true);
+    }
+    void Polygon::json(fmt::memory_buffer &os, vertex<double> t_point) const
+    {
+        fmt::format_to(os, R""("type": "polygon")"");
+        json_points(os, m_points, t_point);
+        json_line(os, m_line);
+        json_color(os, "fill", m_fill);
+    }
     Path::Path(LineInfo &&t_line, color_t t_fill, std::vector<vertex<double>> &&t_points, std::vector<int> &&t_nper, bool t_winding)
-        : m_line(t_line), m_fill(t_fill), m_points(t_points), m_nper(t_nper), m_winding(t_winding)
+        : m_line(std::move(t_line)), m_fill(t_fill), m_points(std::move(t_points)), m_nper(std::move(t_nper)), m_winding(t_winding)
     {
     }
     void Path::svg(fmt::memory_buffer &os) const
@@ -340,12 +924,46 @@ namespace httpgd::dc
         fmt::format_to(os, m_winding ? "nonzero" : "evenodd");
         fmt::format_to(os, ";\"/>");
     }
+    void Path::bin(BinaryWriter &os) const
+    {
+        os.call(BinaryWriter::PATH, m_winding ? 1 : 0, clip_id(), os.style(m_line), m_fill);
+        os.points(m_points);
+        os.ints.insert(os.ints.end(), m_nper.begin(), m_nper.end());
+    }
+    rect<double> Path::bbox() const
+    {
+        return bbox_points(m_points, stroke_pad(m_line));
+    }
+    bool Path::hit(vertex<double> t_point, double t_radius) const
+    {
+        const double half = stroke_half(m_line);
+        int wn = 0;
+        std::size_t begin = 0;
+        for (const int n : m_nper)
+        {
+            const std::size_t end = std::min(begin + static_cast<std::size_t>(std::max(n, 0)), m_points.size());
+            if (near_edges(m_points, begin, end, t_point, half < 0 ? -1 : t_radius + half, true))
+            {
+                return true;
+            }
+            wn += winding_number(m_points, begin, end, t_point);
+            begin = end;
+        }
+        return color::alpha(m_fill) != 0 && (m_winding ? wn != 0 : wn % 2 != 0);
+    }
+    void Path::json(fmt::memory_buffer &os, vertex<double> t_point) const
+    {
+        fmt::format_to(os, R""("type": "path", "subpaths": {})"", m_nper.size());
+        json_points(os, m_points, t_point);
+        json_line(os, m_line);
+        json_color(os, "fill", m_fill);
+    }
 
     Raster::Raster(std::vector<unsigned int> &&t_raster, vertex<int> t_wh,
                rect<double> t_rect,
                double t_rot,
                bool t_interpolate)
-        : m_raster(t_raster), m_wh(t_wh), m_rect(t_rect), m_rot(t_rot), m_interpolate(t_interpolate)
+        : m_raster(std::move(t_raster)), m_wh(t_wh), m_rect(t_rect), m_rot(t_rot), m_interpolate(t_interpolate)
     {
     }
     void Raster::svg(fmt::memory_buffer &os) const
@@ -370,9 +988,28 @@ namespace httpgd::dc
             fmt::format_to(os, R""(transform="rotate({:.2f},{:.2f},{:.2f})" )"", -1.0 * m_rot, m_rect.x, m_rect.y);
         }
         fmt::format_to(os, " xlink:href=\"data:image/png;base64,");
-        fmt::format_to(os, raster_to_string(m_raster, m_wh.x, m_wh.y, m_rect.width, m_rect.height, m_interpolate));
+        const std::string encoded = raster_to_string(m_raster, m_wh.x, m_wh.y, m_rect.width, m_rect.height, m_interpolate);
+        os.append(encoded.data(), encoded.data() + encoded.size());
         fmt::format_to(os, "\"/></g>");
     }
+    void Raster::bin(BinaryWriter &os) const
+    {
+        os.call(BinaryWriter::RASTER, m_interpolate ? 1 : 0, clip_id(), 0, 0);
+        os.point({m_rect.x, m_rect.y});
+        os.point({m_rect.width, m_rect.height});
+        os.coords.push_back(static_cast<float>(m_rot));
+        // base64 PNG, like in SVGs
+        os.string(raster_to_string(m_raster, m_wh.x, m_wh.y, m_rect.width, m_rect.height, m_interpolate));
+    }
+    rect<double> Raster::bbox() const
+    {
+        return bbox_rotated({m_rect.x, m_rect.y}, 0, 0, m_rect.width, m_rect.height, m_rot);
+    }
+    void Raster::json(fmt::memory_buffer &os, vertex<double> /*t_point*/) const
+    {
+        fmt::format_to(os, R""("type": "raster", "x": {:.2f}, "y": {:.2f}, "width": {:.2f}, "height": {:.2f}, "rot": {:.2f}, "pixels": [{}, {}])"",
+                       m_rect.x, m_rect.y, m_rect.width, m_rect.height, m_rot, m_wh.x, m_wh.y);
+    }
 
     Clip::Clip(clip_id_t t_id, rect<double> t_rect)
         : m_id(t_id), m_rect(t_rect)
@@ -382,7 +1019,7 @@ namespace httpgd::dc
     bool Clip::equals(rect<double> t_rect) const
     {
         return std::abs(t_rect.x - m_rect.x) < CLIP_EPSILON &&
-               std::abs(t_rect.x - m_rect.x) < CLIP_EPSILON &&
+               std::abs(t_rect.y - m_rect.y) < CLIP_EPSILON &&
                std::abs(t_rect.width - m_rect.width) < CLIP_EPSILON &&
                std::abs(t_rect.height - m_rect.height) < CLIP_EPSILON;
     }
@@ -390,6 +1027,15 @@ namespace httpgd::dc
     {
         return m_id;
     }
+    rect<double> Clip::bounds() const
+    {
+        return m_rect;
+    }
+    bool Clip::excludes(rect<double> t_bbox) const
+    {
+        return t_bbox.x > m_rect.x + m_rect.width || t_bbox.x + t_bbox.width < m_rect.x ||
+               t_bbox.y > m_rect.y + m_rect.height || t_bbox.y + t_bbox.height < m_rect.y;
+    }
     void Clip::svg_def(fmt::memory_buffer &os) const
     {
         fmt::format_to(os, R""(<clipPath id="c{:d}"><rect x="{:.2f}" y="{:.2f}" width="{:.2f}" height="{:.2f}"/></clipPath>)"",
@@ -399,6 +1045,139 @@ namespace httpgd::dc
                    m_rect.width,
                    m_rect.height);
     }
+    void Clip::bin(BinaryWriter &os) const
+    {
+        os.clip(m_rect);
+    }
+
+    // Cells per axis are limited, the grid should stay small compared to
+    // the draw calls.
+    constexpr int INDEX_MAX_CELLS = 256;
+    constexpr double INDEX_CALLS_PER_CELL = 4;
+    // Calls that span more cells than this are tested on every query
+    constexpr int INDEX_LARGE_CELLS = 64;
+
+    inline bool intersects(const rect<double> &a, const rect<double> &b)
+    {
+        return a.x <= b.x + b.width && b.x <= a.x + a.width &&
+               a.y <= b.y + b.height && b.y <= a.y + a.height;
+    }
+
+    inline int grid_dim(std::size_t t_count, double t_extent, double t_other)
+    {
+        const double d = std::ceil(std::sqrt(t_count / INDEX_CALLS_PER_CELL * t_extent / t_other));
+        return std::isfinite(d) ? std::clamp(static_cast<int>(std::min(d, 1e6)), 1, INDEX_MAX_CELLS) : 1;
+    }
+
+    SpatialIndex::SpatialIndex(const std::vector<std::shared_ptr<DrawCall>> &t_dcs, vertex<double> t_size)
+    {
+        const vertex<double> size{std::max(t_size.x, 1.0), std::max(t_size.y, 1.0)};
+        m_cols = grid_dim(t_dcs.size(), size.x, size.y);
+        m_rows = grid_dim(t_dcs.size(), size.y, size.x);
+        m_cell = {size.x / m_cols, size.y / m_rows};
+
+        m_bboxes.reserve(t_dcs.size());
+        for (const auto &dc : t_dcs)
+        {
+            m_bboxes.push_back(dc->bbox());
+        }
+
+        // two passes: count the calls per cell, then fill
+        const auto cells = static_cast<std::size_t>(m_cols) * m_rows;
+        m_cell_start.assign(cells + 1, 0);
+        std::vector<char> large(m_bboxes.size(), 0);
+        for (std::size_t i = 0; i < m_bboxes.size(); ++i)
+        {
+            const auto &b = m_bboxes[i];
+            const int c0 = col(b.x), c1 = col(b.x + b.width);
+            const int r0 = row(b.y), r1 = row(b.y + b.height);
+            if ((c1 - c0 + 1) * (r1 - r0 + 1) > INDEX_LARGE_CELLS || std::isnan(b.width) || std::isnan(b.height))
+            {
+                large[i] = 1;
+                m_large.push_back(static_cast<uint32_t>(i));
+                continue;
+            }
+            for (int r = r0; r <= r1; ++r)
+            {
+                for (int c = c0; c <= c1; ++c)
+                {
+                    m_cell_start[r * m_cols + c + 1]++;
+                }
+            }
+        }
+        for (std::size_t i = 0; i < cells; ++i)
+        {
+            m_cell_start[i + 1] += m_cell_start[i];
+        }
+        m_cell_items.resize(m_cell_start[cells]);
+        std::vector<uint32_t> fill(m_cell_start.begin(), m_cell_start.end() - 1);
+        for (std::size_t i = 0; i < m_bboxes.size(); ++i)
+        {
+            if (large[i])
+            {
+                continue;
+            }
+            const auto &b = m_bboxes[i];
+            for (int r = row(b.y), r1 = row(b.y + b.height); r <= r1; ++r)
+            {
+                for (int c = col(b.x), c1 = col(b.x + b.width); c <= c1; ++c)
+                {
+                    m_cell_items[fill[r * m_cols + c]++] = static_cast<uint32_t>(i);
+                }
+            }
+        }
+    }
+
+    int SpatialIndex::col(double x) const
+    {
+        const double c = x / m_cell.x;
+        return c >= 0 ? static_cast<int>(std::min(c, m_cols - 1.0)) : 0;
+    }
+
+    int SpatialIndex::row(double y) const
+    {
+        const double r = y / m_cell.y;
+        return r >= 0 ? static_cast<int>(std::min(r, m_rows - 1.0)) : 0;
+    }
+
+    std::size_t SpatialIndex::size() const
+    {
+        return m_bboxes.size();
+    }
+
+    std::vector<std::size_t> SpatialIndex::query(rect<double> t_region) const
+    {
+        std::vector<std::size_t> res;
+        const int qc0 = col(t_region.x), qc1 = col(t_region.x + t_region.width);
+        const int qr0 = row(t_region.y), qr1 = row(t_region.y + t_region.height);
+        for (int r = qr0; r <= qr1; ++r)
+        {
+            for (int c = qc0; c <= qc1; ++c)
+            {
+                const auto cell = r * m_cols + c;
+                for (auto k = m_cell_start[cell]; k < m_cell_start[cell + 1]; ++k)
+                {
+                    const auto i = m_cell_items[k];
+                    const auto &b = m_bboxes[i];
+                    // calls in several cells are reported by the first
+                    // cell of the query they are in
+                    if (std::max(col(b.x), qc0) == c && std::max(row(b.y), qr0) == r && intersects(b, t_region))
+                    {
+                        res.push_back(i);
+                    }
+                }
+            }
+        }
+        for (const auto i : m_large)
+        {
+            if (intersects(m_bboxes[i], t_region))
+            {
+                res.push_back(i);
+            }
+        }
+        std::sort(res.begin(), res.end());
+        return res;
+    }
 
     Page::Page(page_id_t t_id, vertex<double> t_size)
         : m_id(t_id), m_size(t_size)
@@ -418,6 +1197,7 @@ namespace httpgd::dc
     void Page::size(vertex<double> t_size)
     {
         m_size = t_size;
+        m_version++;
     }
     
     void Page::fill(color_t t_fill)
@@ -436,8 +1216,16 @@ namespace httpgd::dc
 
     void Page::put(std::shared_ptr<DrawCall> dc)
     {
-        m_dcs.emplace_back(dc);
-        dc->clip_id(m_cps.back().id());
+        const auto &cp = m_cps.back();
+        // would be clipped away completely (e.g. off-screen points of a
+        // zoomed plot)
+        if (cp.excludes(dc->bbox()))
+        {
+            return;
+        }
+        dc->clip_id(cp.id());
+        m_dcs.emplace_back(std::move(dc));
+        m_version++;
     }
 
     void Page::clear()
@@ -445,15 +1233,39 @@ namespace httpgd::dc
         m_dcs.clear();
         m_cps.clear();
         clip({0, 0, m_size.x, m_size.y});
+        m_version++;
     }
-    std::string Page::svg(boost::optional<std::string> t_extra_css) const
+    std::string Page::svg(const boost::optional<std::string> &t_extra_css) const
+    {
+        return svg(t_extra_css, m_size);
+    }
+
+    std::string Page::svg(const boost::optional<std::string> &t_extra_css, vertex<double> t_view_size) const
     {
         fmt::memory_buffer os;
-        os.reserve((m_dcs.size() + m_cps.size()) * 128 + 512);
+        // header and style are ~700 bytes
+        os.reserve((m_dcs.size() + m_cps.size()) * 128 + 1024 + (t_extra_css ? t_extra_css->size() : 0));
+        svg(os, t_extra_css, t_view_size, boost::none, 0, nullptr);
+        return fmt::to_string(os);
+    }
+
+    std::string Page::svg(const boost::optional<std::string> &t_extra_css, vertex<double> t_view_size,
+                          const boost::optional<rect<double>> &t_viewport) const
+    {
+        fmt::memory_buffer os;
+        svg(os, t_extra_css, t_view_size, t_viewport, 0, nullptr);
+        return fmt::to_string(os);
+    }
+
+    void Page::svg(fmt::memory_buffer &os, const boost::optional<std::string> &t_extra_css, vertex<double> t_view_size,
+                   const boost::optional<rect<double>> &t_viewport,
+                   std::size_t t_chunk_size, const std::function<void(fmt::memory_buffer &)> &t_flush) const
+    {
+        const rect<double> view_box = t_viewport.get_value_or({0, 0, m_size.x, m_size.y});
         fmt::format_to(os, R""(<svg xmlns="http://www.w3.org/2000/svg" xmlns:xlink="http://www.w3.org/1999/xlink" class="httpgd" )"");
         fmt::format_to(os,
-                   R""(width="{:.2f}" height="{:.2f}" viewBox="0 0 {:.2f} {:.2f}")"",
-                   m_size.x, m_size.y, m_size.x, m_size.y);
+                   R""(width="{:.2f}" height="{:.2f}" viewBox="{:.2f} {:.2f} {:.2f} {:.2f}")"",
+                   t_view_size.x, t_view_size.y, view_box.x, view_box.y, view_box.width, view_box.height);
         fmt::format_to(os, ">\n<defs>\n"
               "  <style type='text/css'><![CDATA[\n"
               "    .httpgd line, .httpgd polyline, .httpgd polygon, .httpgd path, .httpgd rect, .httpgd circle {{\n"
@@ -470,29 +1282,307 @@ namespace httpgd::dc
         fmt::format_to(os, 
               "  ]]></style>\n");
 
+        std::vector<std::size_t> visible;
+        if (t_viewport)
+        {
+            visible = query(*t_viewport);
+        }
+        const std::size_t count = t_viewport ? visible.size() : m_dcs.size();
+
+        // Repeated point markers become symbols, the key is a hash of the
+        // element relative to its anchor (this does not allocate unless
+        // there are draw calls that can be symbols). Only the definitions
+        // of symbols are kept. The draw calls that match a candidate keep
+        // it and their anchor, so that they are not written again.
+        struct Symbol
+        {
+            std::size_t uses = 0;
+            int id = -1;
+        };
+        struct SymbolUse
+        {
+            uint32_t dc;
+            // compared with the definition, otherwise it was seen before
+            // the definition and may have a colliding hash
+            bool checked;
+            const Symbol *symbol;
+            vertex<double> anchor;
+        };
+        std::unordered_map<std::size_t, Symbol> symbols;
+        std::vector<std::string> symbol_defs;
+        std::vector<SymbolUse> symbol_uses; // in draw order
+        fmt::memory_buffer symbol_buf;
+        vertex<double> anchor;
+        const auto symbol_text = [&]() {
+            return std::string_view(symbol_buf.data(), symbol_buf.size());
+        };
+        if (count >= SYMBOL_MIN_USES)
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                symbol_buf.clear();
+                if (!m_dcs[t_viewport ? visible[i] : i]->svg_symbol(symbol_buf, anchor))
+                {
+                    continue;
+                }
+                const std::size_t hash = std::hash<std::string_view>()(symbol_text());
+                auto it = symbols.find(hash);
+                if (it == symbols.end())
+                {
+                    if (symbols.size() == SYMBOL_MAX_CANDIDATES)
+                    {
+                        if (symbol_defs.empty())
+                        {
+                            break; // (almost) no repeats
+                        }
+                        continue;
+                    }
+                    it = symbols.emplace(hash, Symbol()).first;
+                }
+                auto &symbol = it->second;
+                if (symbol.id >= 0)
+                {
+                    // elements with colliding hashes are written as they are
+                    if (symbol_defs[symbol.id] == symbol_text())
+                    {
+                        symbol_uses.push_back({static_cast<uint32_t>(i), true, &symbol, anchor});
+                    }
+                    continue;
+                }
+                symbol_uses.push_back({static_cast<uint32_t>(i), false, &symbol, anchor});
+                if (++symbol.uses == SYMBOL_MIN_USES)
+                {
+                    symbol.id = static_cast<int>(symbol_defs.size());
+                    symbol_defs.emplace_back(symbol_text());
+                    symbol_uses.back().checked = true;
+                }
+            }
+        }
+
         for (const auto &cp : m_cps)
         {
             cp.svg_def(os);
             fmt::format_to(os, "\n");
         }
+        for (std::size_t i = 0; i < symbol_defs.size(); ++i)
+        {
+            fmt::format_to(os, R""(<symbol id="s{:d}" style="overflow: visible">{}</symbol>)"" "\n", i, symbol_defs[i]);
+        }
         fmt::format_to(os, "</defs>\n");
-        fmt::format_to(os, R""(<rect width="100%" height="100%" style="stroke: none;fill: #{:02X}{:02X}{:02X};"/>)"" "\n",
-                   R_RED(m_fill), R_GREEN(m_fill), R_BLUE(m_fill));
+        if (t_viewport)
+        {
+            fmt::format_to(os, R""(<rect x="{:.2f}" y="{:.2f}" width="100%" height="100%" style="stroke: none;fill: #{:02X}{:02X}{:02X};"/>)"" "\n",
+                       view_box.x, view_box.y, color::red(m_fill), color::green(m_fill), color::blue(m_fill));
+        }
+        else
+        {
+            fmt::format_to(os, R""(<rect width="100%" height="100%" style="stroke: none;fill: #{:02X}{:02X}{:02X};"/>)"" "\n",
+                       color::red(m_fill), color::green(m_fill), color::blue(m_fill));
+        }
+
+        const auto at = [&](std::size_t t_i) -> const DrawCall & {
+            return *m_dcs[t_viewport ? visible[t_i] : t_i];
+        };
+        const auto flush_full = [&]() {
+            if (t_flush && os.size() >= t_chunk_size)
+            {
+                t_flush(os);
+                os.clear();
+            }
+        };
+        // Symbol used for draw call t_i (and its anchor), -1: none.
+        // Called in draw order (joined lines are skipped).
+        std::size_t next_use = symbol_defs.empty() ? symbol_uses.size() : 0;
+        const auto symbol_id = [&](std::size_t t_i) {
+            while (next_use < symbol_uses.size() && symbol_uses[next_use].dc < t_i)
+            {
+                next_use++;
+            }
+            if (next_use == symbol_uses.size() || symbol_uses[next_use].dc != t_i)
+            {
+                return -1;
+            }
+            const auto &use = symbol_uses[next_use++];
+            const int id = use.symbol->id;
+            if (id < 0)
+            {
+                return -1;
+            }
+            anchor = use.anchor;
+            if (!use.checked)
+            {
+                symbol_buf.clear();
+                at(t_i).svg_symbol(symbol_buf, anchor);
+                if (symbol_defs[id] != symbol_text())
+                {
+                    return -1;
+                }
+            }
+            return id;
+        };
+        // Whether t_next can be joined with a path of t_line in t_clip
+        const auto joins = [&](const LineInfo &t_line, clip_id_t t_clip, const DrawCall &t_next) {
+            const LineInfo *next = t_next.svg_line();
+            return next && t_next.clip_id() == t_clip && line_equals(t_line, *next);
+        };
 
         clip_id_t last_id = m_cps.front().id();
         fmt::format_to(os, R""(<g clip-path='url(#c{:d})'>)"" "\n", last_id);
-        for (const auto &dc : m_dcs)
+        for (std::size_t i = 0; i < count; ++i)
         {
-            if (dc->clip_id() != last_id)
+            const auto &dc = at(i);
+            if (dc.clip_id() != last_id)
             {
-                fmt::format_to(os, R""(</g><g clip-path='url(#c{:d})'>)"" "\n", dc->clip_id());
-                last_id = dc->clip_id();
+                fmt::format_to(os, R""(</g><g clip-path='url(#c{:d})'>)"" "\n", dc.clip_id());
+                last_id = dc.clip_id();
+            }
+            const int symbol = symbol_id(i);
+            const LineInfo *line = dc.svg_line();
+            if (symbol >= 0)
+            {
+                fmt::format_to(os, R""(<use xlink:href="#s{:d}" x="{:.2f}" y="{:.2f}"/>)"", symbol, anchor.x, anchor.y);
+            }
+            else if (line && line_joinable(*line) && i + 1 < count && joins(*line, dc.clip_id(), at(i + 1)))
+            {
+                // consecutive lines of the same style (grid lines,
+                // segments, ...) become one path
+                fmt::format_to(os, "<path d=\"");
+                dc.svg_path_data(os);
+                for (; i + 1 < count && joins(*line, dc.clip_id(), at(i + 1)); ++i)
+                {
+                    flush_full();
+                    fmt::format_to(os, " ");
+                    at(i + 1).svg_path_data(os);
+                }
+                fmt::format_to(os, "\" style=\"");
+                css_lineinfo(os, *line);
+                fmt::format_to(os, "\"/>");
+            }
+            else
+            {
+                dc.svg(os);
             }
-            dc->svg(os);
             fmt::format_to(os, "\n");
+            flush_full();
         }
         fmt::format_to(os, "</g>\n</svg>");
-        return fmt::to_string(os);
+        if (t_flush)
+        {
+            t_flush(os);
+            os.clear();
+        }
+    }
+
+    std::string Page::bin(vertex<double> t_view_size) const
+    {
+        BinaryWriter writer;
+        for (const auto &cp : m_cps)
+        {
+            cp.bin(writer);
+        }
+        for (const auto &dc : m_dcs)
+        {
+            dc->bin(writer);
+        }
+        std::string res;
+        writer.write(res, m_size, t_view_size, m_fill);
+        return res;
+    }
+
+    std::size_t Page::draw_calls() const
+    {
+        return m_dcs.size();
+    }
+
+    Page::IndexCache::IndexCache(const IndexCache &t_other)
+    {
+        const std::lock_guard<std::mutex> lock(t_other.m_mutex);
+        m_index = t_other.m_index;
+        m_version = t_other.m_version;
+    }
+
+    Page::IndexCache &Page::IndexCache::operator=(const IndexCache &t_other)
+    {
+        if (this != &t_other)
+        {
+            const std::scoped_lock lock(m_mutex, t_other.m_mutex);
+            m_index = t_other.m_index;
+            m_version = t_other.m_version;
+        }
+        return *this;
+    }
+
+    std::shared_ptr<const SpatialIndex> Page::IndexCache::get(uint64_t t_version) const
+    {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        return m_version == t_version ? m_index : nullptr;
+    }
+
+    void Page::IndexCache::set(std::shared_ptr<const SpatialIndex> t_index, uint64_t t_version)
+    {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        m_index = std::move(t_index);
+        m_version = t_version;
+    }
+
+    std::shared_ptr<const SpatialIndex> Page::index() const
+    {
+        auto res = m_index_cache.get(m_version);
+        if (!res)
+        {
+            res = std::make_shared<const SpatialIndex>(m_dcs, m_size);
+            m_index_cache.set(res, m_version);
+        }
+        return res;
+    }
+
+    bool Page::indexed() const
+    {
+        return m_index_cache.get(m_version) != nullptr;
+    }
+
+    void Page::adopt_index(const Page &t_copy)
+    {
+        if (&t_copy == this || t_copy.m_id != m_id || t_copy.m_version != m_version)
+        {
+            return;
+        }
+        if (auto index = t_copy.m_index_cache.get(m_version))
+        {
+            m_index_cache.set(std::move(index), m_version);
+        }
+    }
+
+    std::vector<std::size_t> Page::query(rect<double> t_region) const
+    {
+        return index()->query(t_region);
+    }
+
+    std::vector<std::size_t> Page::hit(vertex<double> t_point, double t_radius, std::size_t t_limit) const
+    {
+        std::vector<std::size_t> res;
+        const auto candidates = query({t_point.x - t_radius, t_point.y - t_radius, 2 * t_radius, 2 * t_radius});
+        for (auto it = candidates.rbegin(); it != candidates.rend() && res.size() < t_limit; ++it)
+        {
+            const auto &dc = m_dcs[*it];
+            const auto cp = m_cps[dc->clip_id()].bounds();
+            if (t_point.x < cp.x || t_point.x > cp.x + cp.width || t_point.y < cp.y || t_point.y > cp.y + cp.height)
+            {
+                continue;
+            }
+            if (dc->hit(t_point, t_radius))
+            {
+                res.push_back(*it);
+            }
+        }
+        return res;
+    }
+
+    void Page::json(fmt::memory_buffer &os, std::size_t t_index, vertex<double> t_point) const
+    {
+        fmt::format_to(os, R""({{ "index": {}, "clip": {}, )"", t_index, m_dcs[t_index]->clip_id());
+        m_dcs[t_index]->json(os, t_point);
+        fmt::format_to(os, " }}");
     }
 
 } // namespace httpgd::dc
\ No newline at end of file
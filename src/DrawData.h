@@ -5,9 +5,12 @@
 
 #include <algorithm>
 #include <boost/optional.hpp>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <ostream>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <fmt/format.h>
 
@@ -54,6 +57,50 @@ namespace httpgd::dc
         double txtwidth_px;
     };
 
+    // Compact binary page format for the canvas renderer of the web client.
+    // Draw calls are fixed size records that refer to shared coordinate,
+    // integer and string arrays and a deduplicated style table (see
+    // docs/api-documentation.md for the layout).
+    class BinaryWriter
+    {
+    public:
+        enum Type : uint8_t
+        {
+            CIRCLE = 1,
+            LINE = 2,
+            RECT = 3,
+            POLYLINE = 4,
+            POLYGON = 5,
+            PATH = 6,
+            TEXT = 7,
+            RASTER = 8
+        };
+
+        std::vector<float> coords;
+        std::vector<int32_t> ints;
+
+        // Starts a record, data appended to coords and ints afterwards
+        // belongs to it.
+        void call(Type t_type, uint8_t t_flags, clip_id_t t_clip, uint32_t t_style, color_t t_color);
+        [[nodiscard]] uint32_t style(const LineInfo &t_line);
+        // Appends offset and length of t_str to ints.
+        void string(const std::string &t_str);
+        void point(vertex<double> t_point);
+        void points(const std::vector<vertex<double>> &t_points);
+
+        void clip(rect<double> t_rect);
+        void write(std::string &os, vertex<double> t_size, vertex<double> t_view_size, color_t t_fill) const;
+
+    private:
+        std::string m_calls;
+        std::string m_styles;
+        std::string m_clips;
+        std::string m_strings;
+        uint32_t m_calls_count = 0;
+        uint32_t m_clips_count = 0;
+        std::unordered_map<std::string, uint32_t> m_style_index;
+    };
+
     // Draw calls
 
     class Clip;
@@ -62,6 +109,21 @@ namespace httpgd::dc
     {
     public:
         virtual void svg(fmt::memory_buffer &os) const;
+        // Draw calls that can be reused as <symbol> (point markers) write
+        // their element relative to t_anchor and return true.
+        virtual bool svg_symbol(fmt::memory_buffer &os, vertex<double> &t_anchor) const;
+        // Open lines that can be joined with others of the same style into
+        // one <path> return their style and write their path data.
+        [[nodiscard]] virtual const LineInfo *svg_line() const;
+        virtual void svg_path_data(fmt::memory_buffer &os) const;
+        virtual void bin(BinaryWriter &os) const;
+        // Area covered in page coordinates, including the stroke
+        [[nodiscard]] virtual rect<double> bbox() const;
+        // Whether the shape is drawn within t_radius of t_point
+        [[nodiscard]] virtual bool hit(vertex<double> t_point, double t_radius) const;
+        // Type, coordinates and style as JSON object members. Point lists
+        // report their size and the point nearest to t_point.
+        virtual void json(fmt::memory_buffer &os, vertex<double> t_point) const;
         [[nodiscard]] clip_id_t clip_id() const;
         void clip_id(clip_id_t t_clip_id);
 
@@ -74,6 +136,9 @@ namespace httpgd::dc
     public:
         Text(color_t t_col, vertex<double> t_pos, std::string &&t_str, double t_rot, double t_hadj, TextInfo &&t_text);
         void svg(fmt::memory_buffer &os) const override;
+        void bin(BinaryWriter &os) const override;
+        [[nodiscard]] rect<double> bbox() const override;
+        void json(fmt::memory_buffer &os, vertex<double> t_point) const override;
 
     private:
         color_t m_col;
@@ -88,6 +153,11 @@ namespace httpgd::dc
     public:
         Circle(LineInfo &&t_line, color_t t_fill, vertex<double> t_pos, double t_radius);
         void svg(fmt::memory_buffer &os) const override;
+        bool svg_symbol(fmt::memory_buffer &os, vertex<double> &t_anchor) const override;
+        void bin(BinaryWriter &os) const override;
+        [[nodiscard]] rect<double> bbox() const override;
+        [[nodiscard]] bool hit(vertex<double> t_point, double t_radius) const override;
+        void json(fmt::memory_buffer &os, vertex<double> t_point) const override;
 
     private:
         LineInfo m_line;
@@ -101,6 +171,12 @@ namespace httpgd::dc
     public:
         Line(LineInfo &&t_line, vertex<double> t_orig, vertex<double> t_dest);
         void svg(fmt::memory_buffer &os) const override;
+        [[nodiscard]] const LineInfo *svg_line() const override;
+        void svg_path_data(fmt::memory_buffer &os) const override;
+        void bin(BinaryWriter &os) const override;
+        [[nodiscard]] rect<double> bbox() const override;
+        [[nodiscard]] bool hit(vertex<double> t_point, double t_radius) const override;
+        void json(fmt::memory_buffer &os, vertex<double> t_point) const override;
 
     private:
         LineInfo m_line;
@@ -112,6 +188,11 @@ namespace httpgd::dc
     public:
         Rect(LineInfo &&t_line, color_t t_fill, rect<double> t_rect);
         void svg(fmt::memory_buffer &os) const override;
+        bool svg_symbol(fmt::memory_buffer &os, vertex<double> &t_anchor) const override;
+        void bin(BinaryWriter &os) const override;
+        [[nodiscard]] rect<double> bbox() const override;
+        [[nodiscard]] bool hit(vertex<double> t_point, double t_radius) const override;
+        void json(fmt::memory_buffer &os, vertex<double> t_point) const override;
 
     private:
         LineInfo m_line;
@@ -124,6 +205,12 @@ namespace httpgd::dc
     public:
         Polyline(LineInfo &&t_line, std::vector<vertex<double>> &&t_points);
         void svg(fmt::memory_buffer &os) const override;
+        [[nodiscard]] const LineInfo *svg_line() const override;
+        void svg_path_data(fmt::memory_buffer &os) const override;
+        void bin(BinaryWriter &os) const override;
+        [[nodiscard]] rect<double> bbox() const override;
+        [[nodiscard]] bool hit(vertex<double> t_point, double t_radius) const override;
+        void json(fmt::memory_buffer &os, vertex<double> t_point) const override;
 
     private:
         LineInfo m_line;
@@ -134,6 +221,11 @@ namespace httpgd::dc
     public:
         Polygon(LineInfo &&t_line, color_t t_fill, std::vector<vertex<double>> &&t_points);
         void svg(fmt::memory_buffer &os) const override;
+        bool svg_symbol(fmt::memory_buffer &os, vertex<double> &t_anchor) const override;
+        void bin(BinaryWriter &os) const override;
+        [[nodiscard]] rect<double> bbox() const override;
+        [[nodiscard]] bool hit(vertex<double> t_point, double t_radius) const override;
+        void json(fmt::memory_buffer &os, vertex<double> t_point) const override;
 
     private:
         LineInfo m_line;
@@ -145,6 +237,10 @@ namespace httpgd::dc
     public:
         Path(LineInfo &&t_line, color_t t_fill, std::vector<vertex<double>> &&t_points, std::vector<int> &&t_nper, bool t_winding);
         void svg(fmt::memory_buffer &os) const override;
+        void bin(BinaryWriter &os) const override;
+        [[nodiscard]] rect<double> bbox() const override;
+        [[nodiscard]] bool hit(vertex<double> t_point, double t_radius) const override;
+        void json(fmt::memory_buffer &os, vertex<double> t_point) const override;
 
     private:
         LineInfo m_line;
@@ -162,6 +258,9 @@ namespace httpgd::dc
                double t_rot,
                bool t_interpolate);
         void svg(fmt::memory_buffer &os) const override;
+        void bin(BinaryWriter &os) const override;
+        [[nodiscard]] rect<double> bbox() const override;
+        void json(fmt::memory_buffer &os, vertex<double> t_point) const override;
 
     private:
         std::vector<unsigned int> m_raster;
@@ -177,20 +276,75 @@ namespace httpgd::dc
         Clip(clip_id_t t_id, rect<double> t_rect);
         [[nodiscard]] bool equals(rect<double> t_rect) const;
         void svg_def(fmt::memory_buffer &os) const;
+        void bin(BinaryWriter &os) const;
         [[nodiscard]] clip_id_t id() const;
+        [[nodiscard]] rect<double> bounds() const;
+        // Whether t_bbox lies completely outside
+        [[nodiscard]] bool excludes(rect<double> t_bbox) const;
 
     private:
         clip_id_t m_id;
         rect<double> m_rect;
     };
 
+    // Uniform grid over the bounding boxes of the draw calls of a page to
+    // find the calls in a region without testing all of them. Calls that
+    // span many cells are kept in a list that is always tested.
+    class SpatialIndex
+    {
+    public:
+        SpatialIndex(const std::vector<std::shared_ptr<DrawCall>> &t_dcs, vertex<double> t_size);
+        // Indices of the draw calls intersecting t_region, in draw order
+        [[nodiscard]] std::vector<std::size_t> query(rect<double> t_region) const;
+        [[nodiscard]] std::size_t size() const;
+
+    private:
+        int m_cols, m_rows;
+        vertex<double> m_cell;
+        std::vector<rect<double>> m_bboxes;
+        std::vector<uint32_t> m_cell_start; // items of cell i: [m_cell_start[i], m_cell_start[i + 1])
+        std::vector<uint32_t> m_cell_items;
+        std::vector<uint32_t> m_large;
+
+        [[nodiscard]] int col(double x) const;
+        [[nodiscard]] int row(double y) const;
+    };
+
     class Page
     {
     public:
         Page(page_id_t t_id, vertex<double> t_size);
+        // Draw calls outside of the current clipping area are dropped
         void put(std::shared_ptr<DrawCall> t_dc);
         void clear();
-        std::string svg(boost::optional<std::string> t_extra_css) const;
+        std::string svg(const boost::optional<std::string> &t_extra_css) const;
+        // Output size differs from the page size, the content is scaled
+        std::string svg(const boost::optional<std::string> &t_extra_css, vertex<double> t_view_size) const;
+        // Only the draw calls that intersect t_viewport (page coordinates),
+        // which is scaled to t_view_size
+        std::string svg(const boost::optional<std::string> &t_extra_css, vertex<double> t_view_size,
+                        const boost::optional<rect<double>> &t_viewport) const;
+        // Passes the SVG to t_flush in chunks of about t_chunk_size bytes
+        // (the buffer is cleared after each call).
+        void svg(fmt::memory_buffer &os, const boost::optional<std::string> &t_extra_css, vertex<double> t_view_size,
+                 const boost::optional<rect<double>> &t_viewport,
+                 std::size_t t_chunk_size, const std::function<void(fmt::memory_buffer &)> &t_flush) const;
+        // Compact binary format (see BinaryWriter)
+        std::string bin(vertex<double> t_view_size) const;
+        [[nodiscard]] std::size_t draw_calls() const;
+        // Indices of the draw calls that intersect t_region, in draw order.
+        // The spatial index is built on first use.
+        [[nodiscard]] std::vector<std::size_t> query(rect<double> t_region) const;
+        // Whether the spatial index is built
+        [[nodiscard]] bool indexed() const;
+        // Takes the spatial index of a copy of this page, if neither has
+        // changed since the copy was made
+        void adopt_index(const Page &t_copy);
+        // Indices of up to t_limit draw calls drawn within t_radius of
+        // t_point (and inside their clipping area), topmost first
+        [[nodiscard]] std::vector<std::size_t> hit(vertex<double> t_point, double t_radius, std::size_t t_limit) const;
+        // JSON object of draw call t_index (see DrawCall::json)
+        void json(fmt::memory_buffer &os, std::size_t t_index, vertex<double> t_point) const;
         void clip(rect<double> t_rect);
         [[nodiscard]] vertex<double> size() const;
         void size(vertex<double> t_size);
@@ -204,6 +358,29 @@ namespace httpgd::dc
 
         std::vector<std::shared_ptr<DrawCall>> m_dcs;
         std::vector<Clip> m_cps;
+
+        // Changed by every modification of the draw calls or the size
+        uint64_t m_version = 0;
+
+        // Spatial index of the page at a version. Every page has its own,
+        // copies (snapshots) start with the index of the original.
+        class IndexCache
+        {
+        public:
+            IndexCache() = default;
+            IndexCache(const IndexCache &t_other);
+            IndexCache &operator=(const IndexCache &t_other);
+
+            std::shared_ptr<const SpatialIndex> get(uint64_t t_version) const;
+            void set(std::shared_ptr<const SpatialIndex> t_index, uint64_t t_version);
+
+        private:
+            mutable std::mutex m_mutex;
+            std::shared_ptr<const SpatialIndex> m_index;
+            uint64_t m_version = 0;
+        };
+        mutable IndexCache m_index_cache;
+        [[nodiscard]] std::shared_ptr<const SpatialIndex> index() const;
     };
 
 } // namespace httpgd::dc
@@ -11,22 +11,11 @@
 #include <string>
 
 #include "HttpgdDev.h"
+#include "HttpgdTrace.h"
 
 namespace httpgd
 {
 
-    // returns system path to {package}/inst/www/{filename}
-    std::string get_wwwpath(const std::string &filename)
-    {
-        using namespace cpp11::literals;
-
-        auto sys_file = cpp11::package("base")["system.file"];
-
-        cpp11::strings res(sys_file("www", filename,
-                                          "package"_nm = "httpgd"));
-        return res[0];
-    }
-
     inline HttpgdDev *getDev(pDevDesc dd)
     {
         return static_cast<HttpgdDev *>(dd->deviceSpecific);
@@ -37,15 +26,14 @@ namespace httpgd
 } // namespace httpgd
 
 [[cpp11::register]]
-bool httpgd_(std::string host, int port, std::string bg, double width, double height,
-             double pointsize, cpp11::list aliases, bool cors, std::string token, bool webserver, bool silent, bool fix_text_width, std::string extra_css)
+bool httpgd_(std::string host, int port, std::string socket_path, std::string bg, double width, double height,
+             double pointsize, cpp11::list aliases, bool cors, std::string token, bool webserver, bool silent, bool fix_text_width, std::string extra_css,
+             double stale_timeout, double broadcast_interval, bool shared_server)
 {
     bool recording = true;
     bool use_token = token.length();
     int ibg = R_GE_str2col(bg.c_str());
 
-    std::string wwwpath(httpgd::get_wwwpath(""));
-
     boost::optional<std::string> css;
     if (!extra_css.empty()) 
     {
@@ -55,13 +43,16 @@ bool httpgd_(std::string host, int port, std::string bg, double width, double he
     auto dev = new httpgd::HttpgdDev(
         {std::move(host),
          port,
-         wwwpath,
+         std::move(socket_path),
          cors,
          use_token,
          token,
          recording,
          webserver,
-         silent},
+         silent,
+         stale_timeout,
+         broadcast_interval,
+         shared_server},
         {ibg,
          width,
          height,
@@ -71,7 +62,23 @@ bool httpgd_(std::string host, int port, std::string bg, double width, double he
          css});
 
     httpgd::HttpgdDev::make_device("httpgd", dev);
-    return dev->server_start();
+    // the new device is the current one, R device numbers start at 1
+    if (!dev->server_start(curDevice() + 1))
+    {
+        return false;
+    }
+
+    const auto conflicts = dev->server_conflicts();
+    if (!conflicts.empty())
+    {
+        std::string names;
+        for (const auto &name : conflicts)
+        {
+            names += (names.empty() ? "`" : ", `") + name + "`";
+        }
+        cpp11::warning("The shared server is already running with different settings, %s of this device are ignored.", names.c_str());
+    }
+    return true;
 }
 
 inline httpgd::HttpgdDev *validate_httpgddev(int devnum)
@@ -121,8 +128,10 @@ cpp11::list httpgd_state_(int devnum)
 
     using namespace cpp11::literals;
     return cpp11::writable::list{
-        "host"_nm = svr_config->host.c_str(),
+        "host"_nm = dev->server_host().c_str(),
         "port"_nm = dev->server_port(),
+        "path"_nm = dev->server_path().c_str(),
+        "socket"_nm = dev->server_socket_path().c_str(),
         "token"_nm = svr_config->token.c_str(),
         "hsize"_nm = state.hsize,
         "upid"_nm = state.upid,
@@ -162,6 +171,112 @@ std::string httpgd_svg_id_(int devnum, std::string id, double width, double heig
     return dev->api_svg(*page, width, height);
 }
 
+[[cpp11::register]]
+bool httpgd_svg_file_(int devnum, int page, std::string id, double width, double height, std::string file, bool compress)
+{
+    auto dev = validate_httpgddev(devnum);
+    if (!id.empty())
+    {
+        auto index = dev->api_index(validate_plotid(id));
+        if (!index)
+        {
+            cpp11::stop("Not a valid plot ID.");
+        }
+        page = *index;
+    }
+
+    auto snapshot = dev->api_svg_page(page, width, height);
+    if (!snapshot.svg_file(file, compress))
+    {
+        cpp11::stop("Could not write file '%s'.", file.c_str());
+    }
+    return true;
+}
+
+// Plot IDs of a batch given by ids, page indices or all plots if both are empty
+inline std::vector<int32_t> validate_batch(httpgd::HttpgdDev *dev, cpp11::integers pages, cpp11::strings ids)
+{
+    auto all_ids = dev->api_query_all().ids;
+
+    std::vector<int32_t> batch;
+    if (ids.size() > 0)
+    {
+        for (R_xlen_t i = 0; i < ids.size(); ++i)
+        {
+            const auto id = validate_plotid(ids[i]);
+            if (!dev->api_index(id))
+            {
+                cpp11::stop("Not a valid plot ID.");
+            }
+            batch.push_back(id);
+        }
+    }
+    else if (pages.size() > 0)
+    {
+        for (R_xlen_t i = 0; i < pages.size(); ++i)
+        {
+            const int page = pages[i];
+            if (page < 0 || page >= static_cast<int>(all_ids.size()))
+            {
+                cpp11::stop("Not a valid plot index.");
+            }
+            batch.push_back(all_ids[page]);
+        }
+    }
+    else
+    {
+        batch = all_ids;
+    }
+    return batch;
+}
+
+[[cpp11::register]]
+cpp11::writable::strings httpgd_svg_batch_(int devnum, cpp11::integers pages, cpp11::strings ids, double width, double height)
+{
+    auto dev = validate_httpgddev(devnum);
+    const auto batch = validate_batch(dev, pages, ids);
+
+    auto svgs = dev->api_svg_batch(batch, width, height);
+
+    cpp11::writable::strings res(static_cast<R_xlen_t>(svgs.size()));
+    cpp11::writable::strings names(static_cast<R_xlen_t>(svgs.size()));
+    for (std::size_t i = 0; i < svgs.size(); ++i)
+    {
+        res[i] = svgs[i];
+        names[i] = std::to_string(batch[i]);
+    }
+    res.names() = names;
+    return res;
+}
+
+[[cpp11::register]]
+cpp11::writable::strings httpgd_svg_batch_files_(int devnum, cpp11::integers pages, cpp11::strings ids, double width, double height, std::string dir)
+{
+    auto dev = validate_httpgddev(devnum);
+    const auto batch = validate_batch(dev, pages, ids);
+
+    std::vector<std::string> paths;
+    paths.reserve(batch.size());
+    for (int32_t id : batch)
+    {
+        paths.push_back(dir + "/" + std::to_string(id) + ".svg");
+    }
+    if (!dev->api_svg_batch_files(batch, width, height, paths))
+    {
+        cpp11::stop("Could not write SVG files to '%s'.", dir.c_str());
+    }
+
+    cpp11::writable::strings res(static_cast<R_xlen_t>(paths.size()));
+    cpp11::writable::strings names(static_cast<R_xlen_t>(paths.size()));
+    for (std::size_t i = 0; i < paths.size(); ++i)
+    {
+        res[i] = paths[i];
+        names[i] = std::to_string(batch[i]);
+    }
+    res.names() = names;
+    return res;
+}
+
 [[cpp11::register]]
 bool httpgd_remove_(int devnum, int page)
 {
@@ -219,9 +334,62 @@ cpp11::writable::list httpgd_id_(int devnum, int page, int limit)
     };
 }
 
+[[cpp11::register]]
+cpp11::writable::list httpgd_id_vector_(int devnum, int page, int limit)
+{
+    auto dev = validate_httpgddev(devnum);
+    httpgd::HttpgdQueryResults res;
+
+    if (page == -1)
+    {
+        res = dev->api_query_index(page);
+    }
+    else
+    {
+        res = dev->api_query_range(page, limit);
+    }
+
+    using namespace cpp11::literals;
+    cpp11::writable::list state{
+        "hsize"_nm = res.state.hsize,
+        "upid"_nm = res.state.upid,
+        "active"_nm = res.state.active};
+
+    // One integer vector instead of a list per plot
+    cpp11::writable::integers ids(static_cast<R_xlen_t>(res.ids.size()));
+    for (std::size_t i = 0; i < res.ids.size(); ++i)
+    {
+        ids[static_cast<R_xlen_t>(i)] = res.ids[i];
+    }
+
+    return {
+        "state"_nm = state,
+        "id"_nm = ids
+    };
+}
+
 [[cpp11::register]]
 bool httpgd_clear_(int devnum)
 {
     auto dev = validate_httpgddev(devnum);
     return dev->api_clear();
-}
\ No newline at end of file
+}
+[[cpp11::register]]
+bool httpgd_trace_(bool enable)
+{
+    bool was_enabled = httpgd::trace::enabled();
+    httpgd::trace::enable(enable);
+    return was_enabled;
+}
+
+[[cpp11::register]]
+std::string httpgd_trace_json_(bool clear)
+{
+    fmt::memory_buffer buf;
+    httpgd::trace::write_json(buf, -1);
+    if (clear)
+    {
+        httpgd::trace::clear();
+    }
+    return fmt::to_string(buf);
+}
@@ -13,10 +13,14 @@ namespace httpgd
     {
     public:
         virtual void api_render(int index, double width, double height) = 0;
+        // Batches are given by plot ID, so that plots removed in the
+        // meantime are not mistaken for others
+        virtual void api_render_batch(const std::vector<int32_t> &ids, double width, double height) = 0;
         virtual bool api_remove(int index) = 0;
         virtual bool api_clear() = 0;
 
         virtual std::string api_svg(int index, double width, double height) = 0;
+        virtual std::vector<std::string> api_svg_batch(const std::vector<int32_t> &ids, double width, double height) = 0;
         virtual boost::optional<int> api_index(int32_t id) = 0;
 
         virtual HttpgdState api_state() = 0;
@@ -24,6 +28,8 @@ namespace httpgd
         virtual HttpgdQueryResults api_query_all() = 0;
         virtual HttpgdQueryResults api_query_index(int index) = 0;
         virtual HttpgdQueryResults api_query_range(int offset, int limit) = 0;
+        virtual HttpgdQueryResults api_query_after(int32_t id, int limit) = 0;
+        virtual HttpgdChanges api_query_changes(int since) = 0;
         
         virtual std::shared_ptr<HttpgdServerConfig> api_server_config() = 0;
     };
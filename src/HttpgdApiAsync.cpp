@@ -1,20 +1,20 @@
 #include "AsyncLater.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
 #include "HttpgdApiAsync.h"
+#include "HttpgdTrace.h"
 
 namespace httpgd
 {
 
-    struct AsyncApiCallIndexSizeData
+    enum RevalidateState
     {
-        HttpgdApi *api;
-        int index;
-        double width;
-        double height;
-    };
-    struct AsyncApiCallIndexData
-    {
-        HttpgdApi *api;
-        int index;
+        REVALIDATE_WAITING = 0,
+        REVALIDATE_DONE,
+        REVALIDATE_DROPPED,
+        REVALIDATE_ABANDONED
     };
 
     HttpgdApiAsync::HttpgdApiAsync(
@@ -24,67 +24,118 @@ namespace httpgd
         : m_rdevice(t_rdevice),
           m_rdevice_alive(true),
           m_svr_config(t_svr_config),
-          m_data_store(t_data_store)
+          m_data_store(t_data_store),
+          m_metrics(std::make_shared<metrics::Metrics>())
+    {
+    }
+
+    // dev_close() joins the server thread from the R thread, so a request
+    // waiting here must not outlive the device: the queued call would only
+    // run after the join returns. Wait in slices and give up as soon as
+    // the device is gone (the queued call then runs as a no-op).
+    bool HttpgdApiAsync::m_await_later(std::future<void> &t_done, double t_timeout)
     {
+        const auto slice = std::chrono::milliseconds(50);
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(std::max(t_timeout, 0.0)));
+
+        trace::Span span("await_later");
+        metrics::Stopwatch sw;
+        bool ready = false;
+        while (m_rdevice_alive)
+        {
+            auto wait = slice;
+            if (t_timeout >= 0)
+            {
+                const auto left = deadline - std::chrono::steady_clock::now();
+                if (left <= left.zero())
+                {
+                    ready = t_done.wait_for(left.zero()) == std::future_status::ready;
+                    break;
+                }
+                wait = std::min(wait, std::chrono::duration_cast<std::chrono::milliseconds>(left) + std::chrono::milliseconds(1));
+            }
+            if (t_done.wait_for(wait) == std::future_status::ready)
+            {
+                ready = true;
+                break;
+            }
+        }
+        m_metrics->later_wait(sw.elapsed());
+        if (ready)
+        {
+            t_done.get(); // rethrow
+        }
+        return ready;
     }
 
+    // Queued calls keep this object alive and check m_rdevice_alive (which
+    // is only modified in the R thread) before touching the device.
+
     bool HttpgdApiAsync::api_remove(int index)
     {
-        const std::lock_guard<std::mutex> lock(m_rdevice_alive_mutex);
         if (!m_rdevice_alive)
             return false;
 
-        auto dat = new AsyncApiCallIndexData{
-            m_rdevice,
-            index};
-
-        asynclater::later([](void *t_dat) {
-            auto dat = static_cast<AsyncApiCallIndexData *>(t_dat);
-            HttpgdApi *api = dat->api;
-            api->api_remove(dat->index);
-            delete dat;
-        },
-                     dat, 0.0);
-        asynclater::awaitLater();
+        auto self = shared_from_this();
+        auto done = asynclater::later([self, index]() {
+            if (self->m_rdevice_alive)
+                self->m_rdevice->api_remove(index);
+        });
+        m_await_later(done, -1);
 
         return true;
     }
     bool HttpgdApiAsync::api_clear()
     {
-        const std::lock_guard<std::mutex> lock(m_rdevice_alive_mutex);
         if (!m_rdevice_alive)
             return false;
 
-        asynclater::later([](void *t_api) {
-            auto api = static_cast<HttpgdApi *>(t_api);
-            api->api_clear();
-        },
-                     m_rdevice, 0.0);
-        asynclater::awaitLater();
+        auto self = shared_from_this();
+        auto done = asynclater::later([self]() {
+            if (self->m_rdevice_alive)
+                self->m_rdevice->api_clear();
+        });
+        m_await_later(done, -1);
 
         return true;
     }
 
     void HttpgdApiAsync::api_render(int index, double width, double height)
     {
-        const std::lock_guard<std::mutex> lock(m_rdevice_alive_mutex);
         if (!m_rdevice_alive)
             return;
 
-        auto dat = new AsyncApiCallIndexSizeData{
-            m_rdevice,
-            index,
-            width,
-            height};
+        auto self = shared_from_this();
+        const trace::Context trace_context = trace::current();
+        auto done = asynclater::later([self, trace_context, index, width, height]() {
+            if (!self->m_rdevice_alive)
+                return;
+            trace::Scope scope(trace_context);
+            trace::Span span("render");
+            metrics::Stopwatch sw;
+            self->m_rdevice->api_render(index, width, height);
+            self->m_metrics->render(sw.elapsed());
+        });
+        m_await_later(done, -1);
+    }
+
+    void HttpgdApiAsync::api_render_batch(const std::vector<int32_t> &ids, double width, double height)
+    {
+        if (!m_rdevice_alive)
+            return;
 
-        asynclater::later([](void *t_dat) {
-            auto dat = static_cast<AsyncApiCallIndexSizeData *>(t_dat);
-            HttpgdApi *api = dat->api;
-            api->api_render(dat->index, dat->width, dat->height);
-            delete dat;
-        },
-                     dat, 0.0);
-        asynclater::awaitLater();
+        auto self = shared_from_this();
+        const trace::Context trace_context = trace::current();
+        auto done = asynclater::later([self, trace_context, ids, width, height]() {
+            if (!self->m_rdevice_alive)
+                return;
+            trace::Scope scope(trace_context);
+            trace::Span span("render");
+            metrics::Stopwatch sw;
+            self->m_rdevice->api_render_batch(ids, width, height);
+            self->m_metrics->render(sw.elapsed());
+        });
+        m_await_later(done, -1);
     }
 
     std::string HttpgdApiAsync::api_svg(int index, double width, double height)
@@ -97,6 +148,127 @@ namespace httpgd
         return m_data_store->svg(index);
     }
 
+    PageSnapshot HttpgdApiAsync::api_svg_page(int index, double width, double height, double t_timeout, const boost::optional<RenderTicket> &t_ticket, bool &t_stale)
+    {
+        t_stale = false;
+        if (!m_data_store->diff(index, {width, height}))
+        {
+            return m_data_store->snapshot(index, {-1, -1});
+        }
+        if (t_ticket && !m_generation_announce(*t_ticket))
+        {
+            // a newer request of the same client was seen already
+            m_metrics->superseded();
+            t_stale = true;
+        }
+        else if (m_rdevice_alive)
+        {
+            auto self = shared_from_this();
+            const trace::Context trace_context = trace::current();
+            auto state = std::make_shared<std::atomic<int>>(REVALIDATE_WAITING);
+            auto done = asynclater::later([self, trace_context, index, width, height, t_ticket, state]() {
+                if (!self->m_rdevice_alive)
+                    return;
+                int result = REVALIDATE_DROPPED;
+                if (!t_ticket || !self->m_generation_superseded(*t_ticket))
+                {
+                    trace::Scope scope(trace_context);
+                    trace::Span span("render");
+                    metrics::Stopwatch sw;
+                    self->m_rdevice->api_render(index, width, height);
+                    self->m_metrics->render(sw.elapsed());
+                    result = REVALIDATE_DONE;
+                }
+                else
+                {
+                    self->m_metrics->superseded();
+                }
+                // notify clients that got a stale SVG (even if the
+                // render was dropped, so they request their latest plot)
+                if (state->exchange(result) == REVALIDATE_ABANDONED)
+                {
+                    self->m_data_store->inc_upid();
+                    if (self->broadcast_notify_change)
+                        self->broadcast_notify_change();
+                }
+            });
+
+            if (m_await_later(done, t_timeout))
+            {
+                t_stale = (state->load() == REVALIDATE_DROPPED);
+            }
+            else // timed out or device closed
+            {
+                const int result = state->exchange(REVALIDATE_ABANDONED);
+                t_stale = (result != REVALIDATE_DONE);
+            }
+        }
+
+        if (t_stale)
+        {
+            m_metrics->stale();
+            return m_data_store->snapshot(index, {width, height});
+        }
+        return m_data_store->snapshot(index, {-1, -1});
+    }
+
+    boost::optional<std::string> HttpgdApiAsync::api_hit(int index, double width, double height, vertex<double> point, double radius, std::size_t limit)
+    {
+        return m_data_store->hit(index, {width, height}, point, radius, limit);
+    }
+
+    bool HttpgdApiAsync::m_generation_announce(const RenderTicket &t_ticket)
+    {
+        const std::lock_guard<std::mutex> lock(m_generations_mutex);
+        auto it = m_generations.find(t_ticket.client);
+        if (it == m_generations.end())
+        {
+            if (m_generations.size() >= MAX_RENDER_CLIENTS)
+            {
+                m_generations.clear();
+            }
+            m_generations.emplace(t_ticket.client, t_ticket.generation);
+            return true;
+        }
+        if (it->second > t_ticket.generation)
+        {
+            return false;
+        }
+        it->second = t_ticket.generation;
+        return true;
+    }
+
+    bool HttpgdApiAsync::m_generation_superseded(const RenderTicket &t_ticket)
+    {
+        const std::lock_guard<std::mutex> lock(m_generations_mutex);
+        auto it = m_generations.find(t_ticket.client);
+        return it != m_generations.end() && it->second > t_ticket.generation;
+    }
+
+    void HttpgdApiAsync::m_render_batch_diff(const std::vector<int32_t> &ids, double width, double height)
+    {
+        // only go to the R thread if any page needs to be replayed
+        if (std::any_of(ids.begin(), ids.end(), [&](int32_t id) {
+                const auto index = m_data_store->find_index(id);
+                return index && m_data_store->diff(*index, {width, height});
+            }))
+        {
+            api_render_batch(ids, width, height);
+        }
+    }
+
+    std::vector<std::string> HttpgdApiAsync::api_svg_batch(const std::vector<int32_t> &ids, double width, double height)
+    {
+        m_render_batch_diff(ids, width, height);
+        return m_data_store->svg_batch(ids);
+    }
+
+    std::vector<PageSnapshot> HttpgdApiAsync::api_svg_batch_pages(const std::vector<int32_t> &ids, double width, double height)
+    {
+        m_render_batch_diff(ids, width, height);
+        return m_data_store->snapshot_batch(ids);
+    }
+
     boost::optional<int> HttpgdApiAsync::api_index(int32_t id)
     {
         return m_data_store->find_index(id);
@@ -119,15 +291,27 @@ namespace httpgd
     {
         return m_data_store->query_range(offset, limit);
     }
+    HttpgdQueryResults HttpgdApiAsync::api_query_after(int32_t id, int limit)
+    {
+        return m_data_store->query_after(id, limit);
+    }
+    HttpgdChanges HttpgdApiAsync::api_query_changes(int since)
+    {
+        return m_data_store->query_changes(since);
+    }
 
     std::shared_ptr<HttpgdServerConfig> HttpgdApiAsync::api_server_config()
     {
         return m_svr_config;
     }
 
+    std::shared_ptr<metrics::Metrics> HttpgdApiAsync::metrics()
+    {
+        return m_metrics;
+    }
+
     void HttpgdApiAsync::rdevice_destructing()
     {
-        const std::lock_guard<std::mutex> lock(m_rdevice_alive_mutex);
         m_rdevice_alive = false;
     }
 
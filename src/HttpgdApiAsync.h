@@ -4,11 +4,15 @@
 #include <string>
 #include <memory>
 #include <mutex>
+#include <atomic>
 #include <functional>
+#include <future>
+#include <unordered_map>
 #include <vector>
 #include "HttpgdApi.h"
 #include "HttpgdCommons.h"
 #include "HttpgdDataStore.h"
+#include "HttpgdMetrics.h"
 
 namespace httpgd
 {
@@ -18,7 +22,18 @@ namespace httpgd
         virtual void plot_changed(int upid) = 0;
     };
 
-    class HttpgdApiAsync : public HttpgdApi
+    // Client supplied tag of a render request. Generations increase with
+    // every request of a client, renders of older generations are dropped.
+    struct RenderTicket
+    {
+        std::string client;
+        uint64_t generation;
+    };
+
+    // Forget all clients when exceeded
+    constexpr std::size_t MAX_RENDER_CLIENTS = 1024;
+
+    class HttpgdApiAsync : public HttpgdApi, public std::enable_shared_from_this<HttpgdApiAsync>
     {
 
     public:
@@ -29,30 +44,63 @@ namespace httpgd
 
         // Calls that DO synchronize with R
         void api_render(int index, double width, double height) override;
+        void api_render_batch(const std::vector<int32_t> &ids, double width, double height) override;
         bool api_remove(int index) override;
         bool api_clear() override;
 
         // Calls that MAYBE synchronize with R
         std::string api_svg(int index, double width, double height) override;
+        std::vector<std::string> api_svg_batch(const std::vector<int32_t> &ids, double width, double height) override;
         boost::optional<int> api_index(int32_t id) override;
+
+        // Stale-while-revalidate: When R does not render within t_timeout
+        // seconds (negative: no timeout), the last rendered SVG is scaled to
+        // the requested size and t_stale is set. The render keeps queued and
+        // notifies clients via broadcast_notify_change when it is done.
+        // Renders superseded by a newer ticket of the same client are
+        // dropped and answered stale as well.
+        // Returns a snapshot of the page to serialize outside of the store.
+        PageSnapshot api_svg_page(int index, double width, double height, double t_timeout, const boost::optional<RenderTicket> &t_ticket, bool &t_stale);
+        // Renders like api_svg_batch, returns snapshots of the pages to
+        // serialize one after another.
+        std::vector<PageSnapshot> api_svg_batch_pages(const std::vector<int32_t> &ids, double width, double height);
         
         // Calls that DONT synchronize with R
+        // Hit test JSON of the page as it was last rendered (see
+        // HttpgdDataStore::hit), none if there is no such page
+        boost::optional<std::string> api_hit(int index, double width, double height, vertex<double> point, double radius, std::size_t limit);
         HttpgdState api_state() override;
         HttpgdQueryResults api_query_all() override;
         HttpgdQueryResults api_query_index(int index) override;
         HttpgdQueryResults api_query_range(int offset, int limit) override;
+        HttpgdQueryResults api_query_after(int32_t id, int limit) override;
+        HttpgdChanges api_query_changes(int since) override;
         std::shared_ptr<HttpgdServerConfig> api_server_config() override;
 
-        // this will block when a operation is running in another thread that needs the r device to be alive
+        std::shared_ptr<metrics::Metrics> metrics();
+
+        // has to be called from the R thread, queued calls will not touch the device anymore
         void rdevice_destructing();
 
     private:
         HttpgdApi *m_rdevice;
-        bool m_rdevice_alive;
-        std::mutex m_rdevice_alive_mutex;
+        std::atomic<bool> m_rdevice_alive;
         
         std::shared_ptr<HttpgdServerConfig> m_svr_config;
         std::shared_ptr<HttpgdDataStore> m_data_store;
+        std::shared_ptr<metrics::Metrics> m_metrics;
+
+        std::mutex m_generations_mutex;
+        std::unordered_map<std::string, uint64_t> m_generations;
+
+        // waits for a queued call; returns false on timeout (t_timeout < 0
+        // waits indefinitely) or when the device closes first
+        bool m_await_later(std::future<void> &t_done, double t_timeout);
+        // renders the pages of ids that differ in size
+        void m_render_batch_diff(const std::vector<int32_t> &ids, double width, double height);
+        // returns false if the ticket is already superseded
+        bool m_generation_announce(const RenderTicket &t_ticket);
+        bool m_generation_superseded(const RenderTicket &t_ticket);
     };
 } // namespace httpgd
 
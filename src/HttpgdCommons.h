@@ -28,19 +28,33 @@ namespace httpgd
     struct HttpgdQueryResults {
         HttpgdState state;
         std::vector<int32_t> ids;
+        bool more = false; // cursor queries: there are plots after the last id
+    };
+
+    // Plot IDs that changed since an update id.
+    struct HttpgdChanges {
+        HttpgdState state;
+        bool reset; // changes are not known that far back, ids has all plots
+        std::vector<int32_t> ids;
+        std::vector<int32_t> added;
+        std::vector<int32_t> removed;
+        std::vector<int32_t> changed;
     };
 
     struct HttpgdServerConfig
     {
         std::string host;
-        int port;
-        std::string wwwpath;
+        int port; // negative: no TCP listener
+        std::string socket_path; // unix domain socket, empty: none
         bool cors;
         bool use_token;
         std::string token;
         bool record_history;
         bool webserver;
         bool silent;
+        double stale_timeout; // seconds, negative: never serve stale SVGs
+        double broadcast_interval; // seconds, minimum time between websocket state messages
+        bool shared_server; // serve from the process wide server at /dev/{devnum}
     };
 
 } // namespace httpgd
@@ -1,42 +1,327 @@
 
 #include "HttpgdDataStore.h"
+#include "HttpgdTrace.h"
+#include <algorithm>
 #include <cmath>
+#include <condition_variable>
+#include <cstdio>
+#include <exception>
 #include <iostream>
+#include <thread>
+#include <unordered_map>
+#include <zlib.h>
 
 // Do not include any R headers here!
 
 namespace httpgd
 {
+    namespace
+    {
+        // Threads that serialize batches, shared by all devices and started
+        // on first use. The thread that posts a batch works on it as well.
+        class SerializePool
+        {
+        public:
+            static SerializePool &get()
+            {
+                static SerializePool pool;
+                return pool;
+            }
+
+            [[nodiscard]] std::size_t size() const
+            {
+                return m_threads.size();
+            }
+
+            void post(std::function<void()> t_task)
+            {
+                {
+                    const std::lock_guard<std::mutex> lock(m_mutex);
+                    m_tasks.push_back(std::move(t_task));
+                }
+                m_cv.notify_one();
+            }
+
+            ~SerializePool()
+            {
+                {
+                    const std::lock_guard<std::mutex> lock(m_mutex);
+                    m_stop = true;
+                }
+                m_cv.notify_all();
+                for (auto &t : m_threads)
+                {
+                    t.join();
+                }
+            }
+
+        private:
+            std::mutex m_mutex;
+            std::condition_variable m_cv;
+            std::deque<std::function<void()>> m_tasks;
+            std::vector<std::thread> m_threads;
+            bool m_stop = false;
+
+            SerializePool()
+            {
+                const unsigned n = std::max(1U, std::thread::hardware_concurrency()) - 1;
+                for (unsigned i = 0; i < n; ++i)
+                {
+                    m_threads.emplace_back(&SerializePool::run, this);
+                }
+            }
+
+            void run()
+            {
+                for (;;)
+                {
+                    std::function<void()> task;
+                    {
+                        std::unique_lock<std::mutex> lock(m_mutex);
+                        m_cv.wait(lock, [&]() { return m_stop || !m_tasks.empty(); });
+                        if (m_tasks.empty())
+                        {
+                            return;
+                        }
+                        task = std::move(m_tasks.front());
+                        m_tasks.pop_front();
+                    }
+                    task();
+                }
+            }
+        };
+
+        // Runs t_fn(0) ... t_fn(t_n - 1) in parallel on the pool and the
+        // calling thread, returns when all are done. Rethrows the last
+        // exception of t_fn.
+        void parallel_for(std::size_t t_n, const std::function<void(std::size_t)> &t_fn)
+        {
+            struct Work
+            {
+                std::function<void(std::size_t)> fn;
+                std::size_t n;
+                std::atomic<std::size_t> next{0};
+                std::mutex mutex;
+                std::condition_variable cv;
+                std::size_t done = 0;
+                std::exception_ptr error;
+            };
+            auto work = std::make_shared<Work>();
+            work->fn = t_fn;
+            work->n = t_n;
+
+            // Workers that start after all items are done find nothing
+            // left to do.
+            const auto run = [](const std::shared_ptr<Work> &t_work) {
+                std::size_t n = 0;
+                for (std::size_t i = t_work->next++; i < t_work->n; i = t_work->next++, n++)
+                {
+                    try
+                    {
+                        t_work->fn(i);
+                    }
+                    catch (...)
+                    {
+                        const std::lock_guard<std::mutex> lock(t_work->mutex);
+                        t_work->error = std::current_exception();
+                    }
+                }
+                if (n > 0)
+                {
+                    const std::lock_guard<std::mutex> lock(t_work->mutex);
+                    t_work->done += n;
+                    if (t_work->done == t_work->n)
+                    {
+                        t_work->cv.notify_all();
+                    }
+                }
+            };
+            auto &pool = SerializePool::get();
+            for (std::size_t i = 1; i < std::min(pool.size() + 1, t_n); ++i)
+            {
+                pool.post([work, run]() { run(work); });
+            }
+            run(work);
+
+            std::unique_lock<std::mutex> lock(work->mutex);
+            work->cv.wait(lock, [&]() { return work->done == work->n; });
+            if (work->error)
+            {
+                std::rethrow_exception(work->error);
+            }
+        }
+
+        std::string hit_json(const dc::Page &t_page, vertex<double> t_view_size,
+                             vertex<double> t_point, double t_radius, std::size_t t_limit)
+        {
+            // differs from the view size when the plot was not rendered at that size
+            const vertex<double> size = t_page.size();
+            const vertex<double> scale{t_view_size.x < 0.1 ? 1.0 : size.x / t_view_size.x,
+                                       t_view_size.y < 0.1 ? 1.0 : size.y / t_view_size.y};
+            const vertex<double> point{t_point.x * scale.x, t_point.y * scale.y};
+            const double radius = t_radius * std::max(scale.x, scale.y);
+
+            fmt::memory_buffer os;
+            fmt::format_to(os, R""({{ "id": "{}", "width": {:.2f}, "height": {:.2f}, "hits": [)"", t_page.id(), size.x, size.y);
+            const auto hits = t_page.hit(point, radius, t_limit);
+            for (std::size_t i = 0; i < hits.size(); ++i)
+            {
+                fmt::format_to(os, i == 0 ? "" : ", ");
+                t_page.json(os, hits[i], point);
+            }
+            fmt::format_to(os, "] }}");
+            return fmt::to_string(os);
+        }
+    } // namespace
+
+    inline std::size_t HttpgdDataStore::m_count() const
+    {
+        return m_pages.size() - m_removed;
+    }
     inline bool HttpgdDataStore::m_valid_index(page_index_t t_index)
     {
-        auto psize = m_pages.size();
+        auto psize = m_count();
         return (psize > 0 && (t_index >= -1 && t_index < static_cast<int>(psize)));
     }
     inline std::size_t HttpgdDataStore::m_index_to_pos(page_index_t t_index)
     {
-        return (t_index == -1 ? (m_pages.size() - 1) : t_index);
+        if (t_index == -1)
+        {
+            return m_pages.size() - 1;
+        }
+        if (m_removed == 0)
+        {
+            return t_index;
+        }
+        // descend the tree to the slot holding page t_index + 1
+        std::size_t pos = 0;
+        std::size_t rest = t_index + 1;
+        std::size_t step = 1;
+        while (step * 2 < m_live.size())
+        {
+            step *= 2;
+        }
+        for (; step != 0; step /= 2)
+        {
+            if (pos + step < m_live.size() && m_live[pos + step] < rest)
+            {
+                pos += step;
+                rest -= m_live[pos];
+            }
+        }
+        return pos;
+    }
+    std::size_t HttpgdDataStore::m_pos_to_index(std::size_t t_pos) const
+    {
+        if (m_removed == 0)
+        {
+            return t_pos;
+        }
+        std::size_t index = 0;
+        for (std::size_t i = t_pos; i != 0; i -= i & (~i + 1))
+        {
+            index += m_live[i];
+        }
+        return index;
+    }
+    void HttpgdDataStore::m_erase_pos(std::size_t t_pos)
+    {
+        m_slots.erase(m_ids[t_pos]);
+        m_pages[t_pos].reset();
+        if (m_removed == 0 && t_pos + 1 == m_pages.size())
+        {
+            m_pages.pop_back();
+            m_ids.pop_back();
+            return;
+        }
+        if (m_removed == 0)
+        {
+            // build the tree, all slots are full
+            m_live.assign(m_pages.size() + 1, 0);
+            for (std::size_t i = 1; i != m_live.size(); i++)
+            {
+                m_live[i] = i & (~i + 1);
+            }
+        }
+        m_removed++;
+        for (std::size_t i = t_pos + 1; i < m_live.size(); i += i & (~i + 1))
+        {
+            m_live[i]--;
+        }
+        // the last entry of the tree only covers slots up to itself, so
+        // trailing empty slots are dropped without touching the others
+        while (!m_pages.empty() && !m_pages.back())
+        {
+            m_slots.erase(m_ids.back());
+            m_pages.pop_back();
+            m_ids.pop_back();
+            m_live.pop_back();
+            m_removed--;
+        }
+        if (m_removed == 0)
+        {
+            m_live.clear();
+        }
+        else if (m_removed * 2 >= m_pages.size())
+        {
+            m_compact();
+        }
+    }
+    void HttpgdDataStore::m_compact()
+    {
+        std::size_t n = 0;
+        for (std::size_t i = 0; i != m_pages.size(); i++)
+        {
+            if (m_pages[i])
+            {
+                m_slots[m_ids[i]] = n;
+                m_ids[n] = m_ids[i];
+                m_pages[n++] = std::move(m_pages[i]);
+            }
+        }
+        m_pages.resize(n);
+        m_ids.resize(n);
+        m_removed = 0;
+        m_live.clear();
     }
 
     page_index_t HttpgdDataStore::append(vertex<double> t_size)
     {
         const std::lock_guard<std::mutex> lock(m_store_mutex);
-        m_pages.emplace_back(m_id_counter, t_size);
+        m_pages.push_back(std::make_unique<dc::Page>(m_id_counter, t_size));
+        m_ids.push_back(m_id_counter);
+        m_slots[m_id_counter] = m_pages.size() - 1;
+        if (m_removed != 0)
+        {
+            // the new entry covers its own slot and the ranges of the
+            // entries below it
+            const std::size_t i = m_pages.size();
+            std::size_t count = 1;
+            for (std::size_t j = i - 1; j > i - (i & (~i + 1)); j -= j & (~j + 1))
+            {
+                count += m_live[j];
+            }
+            m_live.push_back(count);
+        }
+        m_log_change(ChangeType::added, m_id_counter);
 
         m_id_counter = incwrap(m_id_counter);
 
-        return m_pages.size() - 1;
+        return m_count() - 1;
     }
     void HttpgdDataStore::add_dc(page_index_t t_index, std::shared_ptr<dc::DrawCall> t_dc, bool t_silent)
     {
+        trace::Tally tally("record");
         const std::lock_guard<std::mutex> lock(m_store_mutex);
         if (!m_valid_index(t_index))
         {
             return;
         }
         auto index = m_index_to_pos(t_index);
-        m_pages[index].put(t_dc);
+        m_pages[index]->put(std::move(t_dc));
         if (!t_silent)
         {
+            m_log_change(ChangeType::changed, m_pages[index]->id());
             m_inc_upid();
         }
     }
@@ -48,9 +333,10 @@ namespace httpgd
             return;
         }
         auto index = m_index_to_pos(t_index);
-        m_pages[index].clear();
+        m_pages[index]->clear();
         if (!t_silent)
         {
+            m_log_change(ChangeType::changed, m_pages[index]->id());
             m_inc_upid();
         }
     }
@@ -64,7 +350,8 @@ namespace httpgd
         }
         auto index = m_index_to_pos(t_index);
 
-        m_pages.erase(m_pages.begin() + index);
+        m_log_change(ChangeType::removed, m_pages[index]->id());
+        m_erase_pos(index);
         if (!t_silent) // if it was the last page
         {
             m_inc_upid();
@@ -79,12 +366,15 @@ namespace httpgd
         {
             return false;
         }
-        for (auto p : m_pages)
-        {
-            p.clear();
-        }
         m_pages.clear();
+        m_ids.clear();
+        m_slots.clear();
+        m_removed = 0;
+        m_live.clear();
         m_inc_upid();
+        // Clients that are behind get the (empty) plot list
+        m_changes.clear();
+        m_changes_since = m_upid;
         return true;
     }
     void HttpgdDataStore::fill(page_index_t t_index, color_t t_fill)
@@ -95,7 +385,7 @@ namespace httpgd
             return;
         }
         auto index = m_index_to_pos(t_index);
-        m_pages[index].fill(t_fill);
+        m_pages[index]->fill(t_fill);
     }
     void HttpgdDataStore::resize(page_index_t t_index, vertex<double> t_size)
     {
@@ -105,8 +395,8 @@ namespace httpgd
             return;
         }
         auto index = m_index_to_pos(t_index);
-        m_pages[index].size(t_size);
-        m_pages[index].clear();
+        m_pages[index]->size(t_size);
+        m_pages[index]->clear();
     }
     httpgd::vertex<double> HttpgdDataStore::size(page_index_t t_index)
     {
@@ -116,7 +406,7 @@ namespace httpgd
             return {10, 10};
         }
         auto index = m_index_to_pos(t_index);
-        return m_pages[index].size();
+        return m_pages[index]->size();
     }
     void HttpgdDataStore::clip(page_index_t t_index, rect<double> t_rect)
     {
@@ -126,12 +416,14 @@ namespace httpgd
             return;
         }
         auto index = m_index_to_pos(t_index);
-        m_pages[index].clip(t_rect);
+        m_pages[index]->clip(t_rect);
     }
 
     bool HttpgdDataStore::diff(page_index_t t_index, vertex<double> t_size)
     {
+        trace::Span lock_span("store_lock");
         const std::lock_guard<std::mutex> lock(m_store_mutex);
+        lock_span.end();
         if (!m_valid_index(t_index))
         {
             return false;
@@ -140,7 +432,7 @@ namespace httpgd
 
         // get current state
         vertex<double> new_size = t_size;
-        vertex<double> old_size = m_pages[index].size();
+        vertex<double> old_size = m_pages[index]->size();
 
         if (new_size.x < 0.1)
         {
@@ -158,38 +450,269 @@ namespace httpgd
     const char *SVG_EMPTY = "<svg width=\"10\" height=\"10\" xmlns=\"http://www.w3.org/2000/svg\"></svg>";
     std::string HttpgdDataStore::svg(page_index_t t_index)
     {
+        trace::Span lock_span("store_lock");
         const std::lock_guard<std::mutex> lock(m_store_mutex);
+        lock_span.end();
         if (!m_valid_index(t_index))
         {
             return std::string(SVG_EMPTY);
         }
         auto index = m_index_to_pos(t_index);
-        return m_pages[index].svg(m_extra_css);
+        trace::Span span("serialize");
+        return m_pages[index]->svg(*m_extra_css);
     }
 
-    boost::optional<int> HttpgdDataStore::find_index(page_id_t t_id)
+    PageSnapshot HttpgdDataStore::snapshot(page_index_t t_index, vertex<double> t_view_size)
     {
+        trace::Span lock_span("store_lock");
         const std::lock_guard<std::mutex> lock(m_store_mutex);
-        for (std::size_t i = 0; i != m_pages.size(); i++)
+        lock_span.end();
+        PageSnapshot res{boost::none, m_extra_css, t_view_size, boost::none};
+        if (!m_valid_index(t_index))
+        {
+            return res;
+        }
+        res.page = *m_pages[m_index_to_pos(t_index)];
+        const vertex<double> size = res.page->size();
+        if (res.view_size.x < 0.1)
+        {
+            res.view_size.x = size.x;
+        }
+        if (res.view_size.y < 0.1)
+        {
+            res.view_size.y = size.y;
+        }
+        return res;
+    }
+
+    boost::optional<std::string> HttpgdDataStore::hit(page_index_t t_index, vertex<double> t_view_size,
+                                                      vertex<double> t_point, double t_radius, std::size_t t_limit)
+    {
+        boost::optional<dc::Page> copy;
+        {
+            const std::lock_guard<std::mutex> lock(m_store_mutex);
+            if (!m_valid_index(t_index))
+            {
+                return boost::none;
+            }
+            const auto &page = *m_pages[m_index_to_pos(t_index)];
+            if (page.indexed())
+            {
+                return hit_json(page, t_view_size, t_point, t_radius, t_limit);
+            }
+            // building the spatial index takes a while for large pages, it
+            // is built on a copy outside of the lock (like a snapshot)
+            copy = page;
+        }
+
+        auto res = hit_json(*copy, t_view_size, t_point, t_radius, t_limit);
+
+        const std::lock_guard<std::mutex> lock(m_store_mutex);
+        if (m_valid_index(t_index))
+        {
+            m_pages[m_index_to_pos(t_index)]->adopt_index(*copy);
+        }
+        return res;
+    }
+
+    std::size_t PageSnapshot::draw_calls() const
+    {
+        return page ? page->draw_calls() : 0;
+    }
+
+    vertex<double> PageSnapshot::viewport_size() const
+    {
+        return {viewport->width, viewport->height};
+    }
+
+    rect<double> PageSnapshot::page_viewport() const
+    {
+        // differs from view_size when a stale page is served
+        const vertex<double> size = page->size();
+        const double sx = size.x / view_size.x;
+        const double sy = size.y / view_size.y;
+        return {viewport->x * sx, viewport->y * sy, viewport->width * sx, viewport->height * sy};
+    }
+
+    std::string PageSnapshot::svg() const
+    {
+        if (!page)
+        {
+            return std::string(SVG_EMPTY);
+        }
+        trace::Span span("serialize");
+        if (viewport)
+        {
+            return page->svg(*extra_css, viewport_size(), page_viewport());
+        }
+        return page->svg(*extra_css, view_size);
+    }
+
+    void PageSnapshot::svg(std::size_t t_chunk_size, const std::function<void(fmt::memory_buffer &)> &t_flush) const
+    {
+        fmt::memory_buffer os;
+        if (!page)
+        {
+            fmt::format_to(os, "{}", SVG_EMPTY);
+            t_flush(os);
+            return;
+        }
+        os.reserve(t_chunk_size + 1024);
+        if (viewport)
+        {
+            page->svg(os, *extra_css, viewport_size(), page_viewport(), t_chunk_size, t_flush);
+        }
+        else
+        {
+            page->svg(os, *extra_css, view_size, boost::none, t_chunk_size, t_flush);
+        }
+    }
+
+    std::string PageSnapshot::bin() const
+    {
+        trace::Span span("serialize");
+        if (!page)
+        {
+            return dc::Page(0, {10, 10}).bin({10, 10});
+        }
+        return page->bin(view_size);
+    }
+
+    bool PageSnapshot::svg_file(const std::string &t_path, bool t_gzip) const
+    {
+        constexpr std::size_t chunk_size = 64 * 1024;
+        trace::Span span("serialize");
+        bool ok = true;
+        if (t_gzip)
         {
-            if (m_pages[i].id() == t_id)
+            gzFile f = gzopen(t_path.c_str(), "wb");
+            if (!f)
             {
-                return static_cast<int>(i);
+                return false;
             }
+            svg(chunk_size, [&](fmt::memory_buffer &buf) {
+                if (ok && buf.size() > 0)
+                {
+                    ok = gzwrite(f, buf.data(), static_cast<unsigned>(buf.size())) == static_cast<int>(buf.size());
+                }
+            });
+            return gzclose(f) == Z_OK && ok;
+        }
+
+        std::FILE *f = std::fopen(t_path.c_str(), "wb");
+        if (!f)
+        {
+            return false;
+        }
+        svg(chunk_size, [&](fmt::memory_buffer &buf) {
+            if (ok)
+            {
+                ok = std::fwrite(buf.data(), 1, buf.size(), f) == buf.size();
+            }
+        });
+        return std::fclose(f) == 0 && ok;
+    }
+
+    std::vector<PageSnapshot> HttpgdDataStore::snapshot_batch(const std::vector<page_id_t> &t_ids)
+    {
+        std::vector<PageSnapshot> res;
+        res.reserve(t_ids.size());
+        const std::lock_guard<std::mutex> lock(m_store_mutex);
+        for (page_id_t id : t_ids)
+        {
+            const auto pos = m_find_pos(id);
+            PageSnapshot snapshot{boost::none, m_extra_css, {-1, -1}, boost::none};
+            if (pos)
+            {
+                snapshot.page = *m_pages[*pos];
+                snapshot.view_size = snapshot.page->size();
+            }
+            res.push_back(std::move(snapshot));
+        }
+        return res;
+    }
+
+    std::vector<std::string> HttpgdDataStore::svg_batch(const std::vector<page_id_t> &t_ids)
+    {
+        const auto pages = snapshot_batch(t_ids);
+        std::vector<std::string> res(pages.size());
+        parallel_for(pages.size(), [&](std::size_t i) {
+            res[i] = pages[i].svg();
+        });
+        return res;
+    }
+
+    bool HttpgdDataStore::svg_batch_files(const std::vector<page_id_t> &t_ids, const std::vector<std::string> &t_paths)
+    {
+        const auto pages = snapshot_batch(t_ids);
+        std::atomic<bool> ok{true};
+        parallel_for(pages.size(), [&](std::size_t i) {
+            if (!pages[i].svg_file(t_paths[i], false))
+            {
+                ok = false;
+            }
+        });
+        return ok;
+    }
+
+    boost::optional<int> HttpgdDataStore::find_index(page_id_t t_id)
+    {
+        const std::lock_guard<std::mutex> lock(m_store_mutex);
+        const auto pos = m_find_pos(t_id);
+        if (!pos)
+        {
+            return boost::none;
+        }
+        return static_cast<int>(m_pos_to_index(*pos));
+    }
+    boost::optional<std::size_t> HttpgdDataStore::m_find_pos(page_id_t t_id)
+    {
+        auto it = m_slots.find(t_id);
+        if (it == m_slots.end())
+        {
+            return boost::none;
         }
-        return boost::none;
+        return it->second;
     }
 
     void HttpgdDataStore::m_inc_upid()
     {
         m_upid = incwrap(m_upid);
+        if (m_upid == 0) // wrapped, older changes can not be told apart
+        {
+            m_changes.clear();
+            m_changes_since = 0;
+        }
+    }
+    void HttpgdDataStore::m_log_change(ChangeType t_type, page_id_t t_id)
+    {
+        constexpr std::size_t max_changes = 1024;
+
+        // Drawing to the same plot repeatedly only moves its entry forward
+        if (t_type == ChangeType::changed && !m_changes.empty() &&
+            m_changes.back().type == ChangeType::changed && m_changes.back().id == t_id)
+        {
+            m_changes.back().upid = m_upid;
+            return;
+        }
+        if (m_changes.size() == max_changes)
+        {
+            m_changes_since = m_changes.front().upid + 1;
+            m_changes.pop_front();
+        }
+        m_changes.push_back({m_upid, t_id, t_type});
+    }
+    void HttpgdDataStore::inc_upid()
+    {
+        const std::lock_guard<std::mutex> lock(m_store_mutex);
+        m_inc_upid();
     }
     HttpgdState HttpgdDataStore::state()
     {
         const std::lock_guard<std::mutex> lock(m_store_mutex);
         return {
             m_upid,
-            m_pages.size(),
+            m_count(),
             m_device_active};
     }
 
@@ -203,13 +726,17 @@ namespace httpgd
     {
         const std::lock_guard<std::mutex> lock(m_store_mutex);
 
-        std::vector<page_id_t> res(m_pages.size());
-        for (std::size_t i = 0; i != m_pages.size(); i++)
+        std::vector<page_id_t> res;
+        res.reserve(m_count());
+        for (const auto &page : m_pages)
         {
-            res[i] = m_pages[i].id();
+            if (page)
+            {
+                res.push_back(page->id());
+            }
         }
         return {{m_upid,
-                 m_pages.size(),
+                 m_count(),
                  m_device_active},
                 res};
     }
@@ -220,15 +747,15 @@ namespace httpgd
         if (!m_valid_index(t_index))
         {
             return {{m_upid,
-                     m_pages.size(),
+                     m_count(),
                      m_device_active},
                     {}};
         }
         auto index = m_index_to_pos(t_index);
         return {{m_upid,
-                 m_pages.size(),
+                 m_count(),
                  m_device_active},
-                {m_pages[index].id()}};
+                {m_pages[index]->id()}};
     }
     HttpgdQueryResults HttpgdDataStore::query_range(page_id_t t_offset, page_id_t t_limit)
     {
@@ -237,32 +764,132 @@ namespace httpgd
         if (!m_valid_index(t_offset))
         {
             return {{m_upid,
-                     m_pages.size(),
+                     m_count(),
                      m_device_active},
                     {}};
         }
         auto index = m_index_to_pos(t_offset);
         if (t_limit < 0)
         {
-            t_limit = m_pages.size();
+            t_limit = m_count();
         }
-        auto end = std::min(m_pages.size(), index + static_cast<std::size_t>(t_limit));
-
-        std::vector<page_id_t> res(end - index);
-        for (std::size_t i = index; i != end; i++)
+        const auto n = std::min(m_count() - m_pos_to_index(index), static_cast<std::size_t>(t_limit));
+        std::vector<page_id_t> res;
+        res.reserve(n);
+        for (std::size_t i = index; res.size() != n; i++)
         {
-            res[i - index] = m_pages[i].id();
+            if (m_pages[i])
+            {
+                res.push_back(m_pages[i]->id());
+            }
         }
         return {{m_upid,
-                 m_pages.size(),
+                 m_count(),
                  m_device_active},
                 res};
     }
+    HttpgdQueryResults HttpgdDataStore::query_after(page_id_t t_after, page_index_t t_limit)
+    {
+        const std::lock_guard<std::mutex> lock(m_store_mutex);
+
+        // empty slots keep their ID, so the search works on removed plots
+        auto it = std::upper_bound(m_ids.begin(), m_ids.end(), t_after);
+        std::size_t pos = it - m_ids.begin();
+        std::size_t index = m_pos_to_index(pos);
+        std::size_t end = m_count();
+        if (t_limit >= 0)
+        {
+            end = std::min(end, index + static_cast<std::size_t>(t_limit));
+        }
+
+        HttpgdQueryResults res{{m_upid,
+                                m_count(),
+                                m_device_active},
+                               {}};
+        res.ids.reserve(end - index);
+        for (; res.ids.size() != end - index; pos++)
+        {
+            if (m_pages[pos])
+            {
+                res.ids.push_back(m_pages[pos]->id());
+            }
+        }
+        res.more = end < m_count();
+        return res;
+    }
+    HttpgdChanges HttpgdDataStore::query_changes(int t_since)
+    {
+        const std::lock_guard<std::mutex> lock(m_store_mutex);
+
+        HttpgdChanges res{{m_upid,
+                           m_count(),
+                           m_device_active},
+                          t_since < m_changes_since || t_since > m_upid,
+                          {},
+                          {},
+                          {},
+                          {}};
+        if (res.reset)
+        {
+            res.ids.reserve(m_count());
+            for (const auto &page : m_pages)
+            {
+                if (page)
+                {
+                    res.ids.push_back(page->id());
+                }
+            }
+            return res;
+        }
+
+        // Coalesce multiple changes of the same plot, in order of their first change
+        std::vector<std::pair<page_id_t, ChangeType>> plots;
+        std::vector<bool> dropped; // added and removed again
+        std::unordered_map<page_id_t, std::size_t> pos;
+        auto it = std::lower_bound(m_changes.begin(), m_changes.end(), t_since, [](const Change &change, int upid) {
+            return change.upid < upid;
+        });
+        for (; it != m_changes.end(); ++it)
+        {
+            auto p = pos.find(it->id);
+            if (p == pos.end())
+            {
+                pos.emplace(it->id, plots.size());
+                plots.emplace_back(it->id, it->type);
+                dropped.push_back(false);
+            }
+            else if (it->type == ChangeType::removed)
+            {
+                dropped[p->second] = plots[p->second].second == ChangeType::added;
+                plots[p->second].second = ChangeType::removed;
+            }
+        }
+        for (std::size_t i = 0; i != plots.size(); i++)
+        {
+            if (dropped[i])
+            {
+                continue;
+            }
+            switch (plots[i].second)
+            {
+            case ChangeType::added:
+                res.added.push_back(plots[i].first);
+                break;
+            case ChangeType::removed:
+                res.removed.push_back(plots[i].first);
+                break;
+            case ChangeType::changed:
+                res.changed.push_back(plots[i].first);
+                break;
+            }
+        }
+        return res;
+    }
 
     void HttpgdDataStore::extra_css(boost::optional<std::string> t_extra_css)
     {
         const std::lock_guard<std::mutex> lock(m_store_mutex);
-        m_extra_css = t_extra_css;
+        m_extra_css = std::make_shared<const boost::optional<std::string>>(std::move(t_extra_css));
     }
 
 } // namespace httpgd
\ No newline at end of file
@@ -7,9 +7,12 @@
 #include "HttpgdGeom.h"
 
 #include <atomic>
+#include <deque>
 #include <functional>
+#include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace httpgd
@@ -17,6 +20,31 @@ namespace httpgd
     using page_id_t = int32_t;
     using page_index_t = int;
 
+    // Copy of a page that is serialized without holding the store lock
+    // (draw calls are shared, they do not change once recorded).
+    struct PageSnapshot
+    {
+        boost::optional<dc::Page> page; // none: invalid index
+        std::shared_ptr<const boost::optional<std::string>> extra_css;
+        vertex<double> view_size;
+        // Only the region of the plot at view_size, served at its own size
+        boost::optional<rect<double>> viewport;
+
+        [[nodiscard]] std::size_t draw_calls() const;
+        std::string svg() const;
+        // Passes the SVG to t_flush in chunks of about t_chunk_size bytes
+        void svg(std::size_t t_chunk_size, const std::function<void(fmt::memory_buffer &)> &t_flush) const;
+        // Writes the SVG to t_path without building it as a whole, gzip
+        // compressed (svgz) if t_gzip. Returns false on I/O errors.
+        bool svg_file(const std::string &t_path, bool t_gzip) const;
+        // Compact binary format for the canvas renderer (see dc::BinaryWriter)
+        std::string bin() const;
+
+    private:
+        [[nodiscard]] vertex<double> viewport_size() const;
+        [[nodiscard]] rect<double> page_viewport() const;
+    };
+
     class HttpgdDataStore
     {
     public:
@@ -24,6 +52,22 @@ namespace httpgd
 
         bool diff(page_index_t t_index, vertex<double> t_size);
         std::string svg(page_index_t t_index);
+        // The content is scaled to t_view_size (page size if < 0.1)
+        PageSnapshot snapshot(page_index_t t_index, vertex<double> t_view_size);
+        // JSON of up to t_limit draw calls within t_radius of t_point (in
+        // coordinates of the plot at t_view_size, page size if < 0.1),
+        // topmost first. Runs on the stored page without copying it.
+        boost::optional<std::string> hit(page_index_t t_index, vertex<double> t_view_size,
+                                         vertex<double> t_point, double t_radius, std::size_t t_limit);
+        // Snapshots of the pages at their size, plots that do not exist
+        // (anymore) are empty.
+        std::vector<PageSnapshot> snapshot_batch(const std::vector<page_id_t> &t_ids);
+        // Pages are copied under the store lock and serialized outside of it
+        // in parallel, plots that do not exist (anymore) are empty.
+        std::vector<std::string> svg_batch(const std::vector<page_id_t> &t_ids);
+        // Like svg_batch, but each page is written to the file in t_paths
+        // without building the SVG as a whole. Returns false on I/O errors.
+        bool svg_batch_files(const std::vector<page_id_t> &t_ids, const std::vector<std::string> &t_paths);
 
         page_index_t append(vertex<double> t_size);
         void clear(page_index_t t_index, bool t_silent);
@@ -37,28 +81,76 @@ namespace httpgd
         void clip(page_index_t t_index, rect<double> t_rect);
 
         HttpgdState state();
+        // Notify clients of a change that was recorded silently
+        void inc_upid();
         void set_device_active(bool t_active);
 
         HttpgdQueryResults query_all();
         HttpgdQueryResults query_index(page_index_t t_index);
         HttpgdQueryResults query_range(page_index_t t_offset, page_index_t t_limit);
+        // Plots after the plot t_after (which may have been removed already),
+        // -1 starts at the first plot
+        HttpgdQueryResults query_after(page_id_t t_after, page_index_t t_limit);
+        // Plots added, removed or drawn to while the update id was t_since or later
+        HttpgdChanges query_changes(int t_since);
 
         void extra_css(boost::optional<std::string> t_extra_css);
 
     private:
         std::mutex m_store_mutex;
 
+        // IDs are assigned in increasing order, so m_ids is sorted
+        // (query_after relies on this). The counter only wraps after 2^31
+        // plots, plot cursors of clients may skip plots after that.
         page_id_t m_id_counter = 0;
-        std::vector<dc::Page> m_pages;
+        // Page slots in history order. Removal leaves an empty slot behind
+        // (trailing ones are dropped), slots are compacted once half of
+        // them are empty. The last slot is never empty.
+        std::vector<std::unique_ptr<dc::Page>> m_pages;
+        // Page ID of every slot, including the empty ones
+        std::vector<page_id_t> m_ids;
+        // Slot by page ID, stable until the next compaction
+        std::unordered_map<page_id_t, std::size_t> m_slots;
+        // Number of empty slots
+        std::size_t m_removed = 0;
+        // Fenwick tree counting the pages in the slots, maps between page
+        // indices and slots in O(log n). Only kept while m_removed > 0,
+        // index and slot are the same otherwise.
+        std::vector<std::size_t> m_live;
         int m_upid = 0;
         bool m_device_active = true;
 
-        boost::optional<std::string> m_extra_css;
+        // Bounded log of plot changes, each tagged with the update id it
+        // happened at. The log is complete for update ids >= m_changes_since.
+        enum class ChangeType
+        {
+            added,
+            removed,
+            changed
+        };
+        struct Change
+        {
+            int upid;
+            page_id_t id;
+            ChangeType type;
+        };
+        std::deque<Change> m_changes;
+        int m_changes_since = 0;
+
+        std::shared_ptr<const boost::optional<std::string>> m_extra_css{
+            std::make_shared<const boost::optional<std::string>>()};
 
         void m_inc_upid();
+        void m_log_change(ChangeType t_type, page_id_t t_id);
 
+        inline std::size_t m_count() const;
         inline bool m_valid_index(page_index_t t_index);
+        boost::optional<std::size_t> m_find_pos(page_id_t t_id);
         inline size_t m_index_to_pos(page_index_t t_index);
+        // Number of pages in the slots before t_pos
+        std::size_t m_pos_to_index(std::size_t t_pos) const;
+        void m_erase_pos(std::size_t t_pos);
+        void m_compact();
         
     };
 
@@ -1,6 +1,7 @@
 
 #include "HttpgdDev.h"
 #include "DebugPrint.h"
+#include "AsyncLater.h"
 
 #include <cmath>
 #include <cpp11/as.hpp>
@@ -55,13 +56,13 @@ namespace httpgd
         m_data_store->extra_css(t_params.extra_css);
         m_api_async_watcher = std::make_shared<HttpgdApiAsync>(this, m_svr_config, m_data_store);
 
-        // setup http server
-        m_server = m_svr_config->webserver ? std::make_shared<web::WebServer>(m_api_async_watcher) : nullptr;
+        m_restore_handle = std::make_shared<HttpgdDev *>(this);
 
         m_initialized = true;
     }
     HttpgdDev::~HttpgdDev()
     {
+        *m_restore_handle = nullptr; // cancel deferred restore
         //Rcpp::Rcout << "Httpgd Device destructed.\n";
     }
 
@@ -73,9 +74,9 @@ namespace httpgd
             return;
         //Rcpp::Rcout << "ACTIVATE 1\n";
         m_data_store->set_device_active(true);
-        if (m_server && m_server_running)
+        if (m_api_async_watcher->broadcast_notify_change)
         {
-            m_server->broadcast_state_current();
+            m_api_async_watcher->broadcast_notify_change();
         }
     }
     void HttpgdDev::dev_deactivate(pDevDesc dd)
@@ -84,9 +85,9 @@ namespace httpgd
             return;
         //Rcpp::Rcout << "DEACTIVATE 0\n";
         m_data_store->set_device_active(false);
-        if (m_server && m_server_running)
+        if (m_api_async_watcher->broadcast_notify_change)
         {
-            m_server->broadcast_state_current();
+            m_api_async_watcher->broadcast_notify_change();
         }
     }
 
@@ -95,15 +96,15 @@ namespace httpgd
         if (m_target.is_void() || mode == 1)
             return;
 
-        if (m_server && m_server_running)
-            m_server->broadcast_state_current();
+        if (m_api_async_watcher->broadcast_notify_change)
+            m_api_async_watcher->broadcast_notify_change();
     }
 
     void HttpgdDev::dev_close(pDevDesc dd)
     {
         m_initialized = false;
 
-        if (m_server && !m_svr_config->silent)
+        if (m_svr_config->webserver && !m_svr_config->silent)
             Rprintf("Server closing... ");
 
         // notify watcher
@@ -119,7 +120,7 @@ namespace httpgd
         // cleanup r session data
         m_history.clear();
 
-        if (m_server && !m_svr_config->silent)
+        if (m_svr_config->webserver && !m_svr_config->silent)
             Rprintf("Closed.\n");
     }
 
@@ -208,7 +209,13 @@ namespace httpgd
         debug_print("[new_page] replaying=%i\n", replaying);
         if (!replaying)
         {
-            if (m_target.get_newest_index() >= 0) // no previous pages
+            if (m_restore_pending)
+            {
+                // open page was already recorded before an old page was played
+                debug_print("    -> drop pending restore\n");
+                m_restore_pending = false;
+            }
+            else if (m_target.get_newest_index() >= 0) // no previous pages
             {
                 debug_print("    -> record open page in history\n");
                 m_history.put_last(m_target.get_newest_index(), dd);
@@ -269,7 +276,7 @@ namespace httpgd
         put(std::make_shared<dc::Text>(gc->col, vertex<double>{x, y}, str, rot, hadj,
                                        dc::TextInfo{
                                            weight,
-                                           feature,
+                                           std::move(feature),
                                            fontname(gc->fontfamily, gc->fontface, system_aliases, user_aliases, font_info),
                                            gc->cex * gc->ps,
                                            is_italic(gc->fontface),
@@ -333,7 +340,7 @@ namespace httpgd
         if (m_target.is_void())
             return;
 
-        m_data_store->add_dc(m_target.get_index(), dc, replaying);
+        m_data_store->add_dc(m_target.get_index(), std::move(dc), replaying);
     }
 
     void HttpgdDev::api_render(int index, double width, double height)
@@ -352,22 +359,79 @@ namespace httpgd
             m_target.set_index(index);
             debug_print("    -> open page. target_index=%i\n", m_target.get_index());
             resize_device_to_page(dd);
-            PlotHistory::replay_current(dd); // replay active page
+            if (m_restore_pending)
+            {
+                // playing the recorded open page renders and restores it at once
+                m_history.play(index, dd);
+                m_restore_pending = false;
+            }
+            else
+            {
+                PlotHistory::replay_current(dd); // replay active page
+            }
         }
         else
         {
             debug_print("    -> old page. target_newest_index=%i\n", m_target.get_newest_index());
-            m_history.put_current(m_target.get_newest_index(), dd);
+            if (!m_restore_pending)
+                m_history.put_current(m_target.get_newest_index(), dd);
 
             m_target.set_index(index);
             resize_device_to_page(dd);
             m_history.play(m_target.get_index(), dd);
             m_target.set_void();
+            restore_later(dd);
+        }
+        replaying = false;
+    }
+
+    void HttpgdDev::api_render_batch(const std::vector<int32_t> &ids, double width, double height)
+    {
+        const int newest = m_target.get_newest_index();
+        bool render_newest = false;
+        bool played_old = false;
+
+        pDevDesc dd = devGeneric::get_active_pDevDesc();
+
+        debug_print("[render_batch] n=%i\n", static_cast<int>(ids.size()));
+
+        replaying = true;
+        for (int32_t id : ids)
+        {
+            // plots are only removed on this thread
+            const auto found = m_data_store->find_index(id);
+            if (!found)
+                continue;
+            const int index = *found;
+            if (!m_data_store->diff(index, {width, height}))
+                continue;
+            if (index == newest)
+            {
+                render_newest = true;
+                continue;
+            }
+            if (!played_old && !m_restore_pending)
+            {
+                m_history.put_current(newest, dd);
+            }
+            played_old = true;
+            m_data_store->resize(index, {width, height}); // this also clears
+            m_target.set_index(index);
             resize_device_to_page(dd);
-            m_history.play(m_target.get_newest_index(), dd); // recreate previous state
-            m_target.set_index(m_target.get_newest_index()); // set target to open page for new draw calls
+            m_history.play(index, dd);
+        }
+        if (played_old)
+        {
+            // recreate previous state once for all old pages
+            m_target.set_void();
+            restore_later(dd);
         }
         replaying = false;
+
+        if (render_newest)
+        {
+            api_render(newest, width, height);
+        }
     }
 
     bool HttpgdDev::api_clear()
@@ -379,6 +443,7 @@ namespace httpgd
         m_history.clear();
         m_target.set_void();
         m_target.set_newest_index(-1);
+        m_restore_pending = false;
 
         return r;
     }
@@ -404,6 +469,7 @@ namespace httpgd
             m_target.set_index(m_target.get_newest_index() - 1);
             resize_device_to_page(dd);
             m_history.play(m_target.get_newest_index() - 1, dd); // recreate state of the element before last element
+            m_restore_pending = false;
         }
         m_target.set_newest_index(m_target.get_newest_index() - 1);
         replaying = false;
@@ -418,36 +484,120 @@ namespace httpgd
         {
             debug_print("RENDER \n");
             api_render(index, width, height);
+            // called from R code, which may continue drawing right away
+            restore_open_page(devGeneric::get_active_pDevDesc());
         }
         debug_print("SVG \n");
         return m_data_store->svg(index);
     }
 
+    PageSnapshot HttpgdDev::api_svg_page(int index, double width, double height)
+    {
+        if (m_data_store->diff(index, {width, height}))
+        {
+            api_render(index, width, height);
+            restore_open_page(devGeneric::get_active_pDevDesc());
+        }
+        return m_data_store->snapshot(index, {-1, -1});
+    }
+
+    std::vector<std::string> HttpgdDev::api_svg_batch(const std::vector<int32_t> &ids, double width, double height)
+    {
+        api_render_batch(ids, width, height);
+        restore_open_page(devGeneric::get_active_pDevDesc());
+        return m_data_store->svg_batch(ids);
+    }
+
+    bool HttpgdDev::api_svg_batch_files(const std::vector<int32_t> &ids, double width, double height, const std::vector<std::string> &paths)
+    {
+        api_render_batch(ids, width, height);
+        restore_open_page(devGeneric::get_active_pDevDesc());
+        return m_data_store->svg_batch_files(ids, paths);
+    }
+
+    // Seconds without a further call from the server before the open page
+    // is restored. Covers the time between the renders of a client that
+    // steps through the plot history. R is idle while it waits.
+    constexpr double RESTORE_LINGER = 0.25;
+
+    void HttpgdDev::restore_later(pDevDesc dd)
+    {
+        if (m_restore_pending)
+            return; // already scheduled
+        m_restore_pending = true;
+
+        auto handle = m_restore_handle;
+        asynclater::after_calls([handle, dd]() {
+            if (*handle)
+                (*handle)->restore_open_page(dd);
+        }, RESTORE_LINGER);
+    }
+
+    void HttpgdDev::restore_open_page(pDevDesc dd)
+    {
+        if (!m_restore_pending)
+            return;
+        m_restore_pending = false;
+
+        debug_print("[restore_open_page] newest_index=%i\n", m_target.get_newest_index());
+        replaying = true;
+        m_target.set_void();
+        resize_device_to_page(dd);
+        m_history.play(m_target.get_newest_index(), dd); // recreate previous state
+        m_target.set_index(m_target.get_newest_index()); // set target to open page for new draw calls
+        replaying = false;
+    }
+
     boost::optional<int> HttpgdDev::api_index(int32_t id)
     {
         return m_data_store->find_index(id);
     }
 
-    bool HttpgdDev::server_start()
+    bool HttpgdDev::server_start(int t_devnum)
     {
-        if (m_server && !m_server_running)
+        if (!m_svr_config->webserver || m_server)
         {
-            m_server_running = m_server->start();
-            return m_server_running;
+            return true;
         }
+        auto server = m_svr_config->shared_server ? web::WebServer::shared(m_svr_config)
+                                                  : std::make_shared<web::WebServer>(m_svr_config);
+        if (!server->attach(t_devnum, m_api_async_watcher, !m_svr_config->shared_server))
+        {
+            return false;
+        }
+        m_server = server;
+        m_server_devnum = t_devnum;
         return true;
     }
     void HttpgdDev::server_stop()
     {
-        if (m_server && m_server_running)
-            m_server->stop();
-
-        m_server_running = false;
+        if (m_server)
+        {
+            m_server->detach(m_server_devnum);
+            m_server = nullptr;
+        }
     }
     unsigned short HttpgdDev::server_port() const
     {
         return m_server ? m_server->port() : 0;
     }
+    std::string HttpgdDev::server_host() const
+    {
+        return m_server ? m_server->host() : m_svr_config->host;
+    }
+    std::string HttpgdDev::server_socket_path() const
+    {
+        return m_server ? m_server->socket_path() : m_svr_config->socket_path;
+    }
+    std::string HttpgdDev::server_path() const
+    {
+        return (m_server && m_svr_config->shared_server) ? "/dev/" + std::to_string(m_server_devnum) : "";
+    }
+
+    std::vector<std::string> HttpgdDev::server_conflicts() const
+    {
+        return m_server ? m_server->conflicts(*m_svr_config) : std::vector<std::string>();
+    }
 
     std::shared_ptr<HttpgdServerConfig> HttpgdDev::api_server_config()
     {
@@ -471,6 +621,14 @@ namespace httpgd
     {
         return m_data_store->query_range(offset, limit);
     }
+    HttpgdQueryResults HttpgdDev::api_query_after(int32_t id, int limit)
+    {
+        return m_data_store->query_after(id, limit);
+    }
+    HttpgdChanges HttpgdDev::api_query_changes(int since)
+    {
+        return m_data_store->query_changes(since);
+    }
 
     // Can not use R's RNG for this for security reasons.
     // (Seed could be predicted)
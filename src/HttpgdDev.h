@@ -60,20 +60,36 @@ namespace httpgd
         virtual ~HttpgdDev();
 
         // http server
-        bool server_start();
+        // Serves the device with R device number t_devnum
+        bool server_start(int t_devnum);
         void server_stop();
         unsigned short server_port() const;
+        std::string server_host() const;
+        std::string server_socket_path() const;
+        // URL prefix of the device API ("" or "/dev/{devnum}")
+        std::string server_path() const;
+        // Settings of this device that a running shared server ignores
+        std::vector<std::string> server_conflicts() const;
 
         // API functions
 
         virtual void api_render(int index, double width, double height) override;
+        virtual void api_render_batch(const std::vector<int32_t> &ids, double width, double height) override;
         virtual bool api_remove(int index) override;
         virtual bool api_clear() override;
         virtual HttpgdState api_state() override;
         HttpgdQueryResults api_query_all() override;
         HttpgdQueryResults api_query_index(int index) override;
         HttpgdQueryResults api_query_range(int offset, int limit) override;
+        HttpgdQueryResults api_query_after(int32_t id, int limit) override;
+        HttpgdChanges api_query_changes(int since) override;
         virtual std::string api_svg(int index, double width, double height) override;
+        virtual std::vector<std::string> api_svg_batch(const std::vector<int32_t> &ids, double width, double height) override;
+        // Renders like api_svg, the snapshot can be serialized without an R string.
+        PageSnapshot api_svg_page(int index, double width, double height);
+        // Renders like api_svg_batch and writes each plot to the file in
+        // paths. Returns false on I/O errors.
+        bool api_svg_batch_files(const std::vector<int32_t> &ids, double width, double height, const std::vector<std::string> &paths);
         virtual boost::optional<int> api_index(int32_t id) override;
         virtual std::shared_ptr<HttpgdServerConfig> api_server_config() override;
 
@@ -109,12 +125,24 @@ namespace httpgd
         std::shared_ptr<HttpgdApiAsync> m_api_async_watcher;
         
         std::shared_ptr<web::WebServer> m_server;
+        int m_server_devnum{-1};
 
         bool replaying{false}; // Is the device replaying
         DeviceTarget m_target;
 
+        // After an old page was rendered the graphics engine still holds its
+        // state. Replaying the open page is deferred until the calls from
+        // the server are done and no further call arrived for a moment
+        // (before control returns to R), so renders handled in one go and
+        // renders of a client stepping through the history replay it once.
+        bool m_restore_pending{false};
+        // Handed to the deferred callback, reset when the device is destroyed.
+        std::shared_ptr<HttpgdDev *> m_restore_handle;
+
+        void restore_later(pDevDesc dd);
+        void restore_open_page(pDevDesc dd);
+
         bool m_initialized{false};
-        bool m_server_running{false};
 
         void put(std::shared_ptr<dc::DrawCall> dc);
 
@@ -7,6 +7,39 @@ namespace httpgd {
     
     using color_t = int;
 
+    // Same bit layout as R colors (R_RED, R_RGBA, ... in R_ext/GraphicsDevice.h)
+    // so this can be used without R headers.
+    namespace color
+    {
+        constexpr int red(color_t col)
+        {
+            return col & 255;
+        }
+        constexpr int green(color_t col)
+        {
+            return (col >> 8) & 255;
+        }
+        constexpr int blue(color_t col)
+        {
+            return (col >> 16) & 255;
+        }
+        constexpr int alpha(color_t col)
+        {
+            return (col >> 24) & 255;
+        }
+        constexpr color_t rgba(int r, int g, int b, int a)
+        {
+            return static_cast<color_t>(static_cast<unsigned int>(r) |
+                                        (static_cast<unsigned int>(g) << 8) |
+                                        (static_cast<unsigned int>(b) << 16) |
+                                        (static_cast<unsigned int>(a) << 24));
+        }
+        constexpr color_t rgb(int r, int g, int b)
+        {
+            return rgba(r, g, b, 255);
+        }
+    } // namespace color
+
     template <class T>
     struct vertex
     {
@@ -0,0 +1,141 @@
+#include "HttpgdMetrics.h"
+
+#include <string>
+
+// Do not include any R headers here!
+
+namespace httpgd
+{
+    namespace metrics
+    {
+        static const char *ROUTE_NAMES[] = {"/svg", "/svg/batch", "/plots", "/state", "/remove", "/clear", "/hit"};
+
+        void Histogram::observe(clock::duration t_duration)
+        {
+            const auto us = std::chrono::duration_cast<std::chrono::microseconds>(t_duration).count();
+            const double secs = us / 1e6;
+            for (std::size_t i = 0; i < HISTOGRAM_BUCKETS.size(); ++i)
+            {
+                if (secs <= HISTOGRAM_BUCKETS[i])
+                {
+                    m_buckets[i].fetch_add(1, std::memory_order_relaxed);
+                    break;
+                }
+            }
+            m_sum_us.fetch_add(static_cast<uint64_t>(us), std::memory_order_relaxed);
+            m_count.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        uint64_t Histogram::count() const
+        {
+            return m_count.load(std::memory_order_relaxed);
+        }
+
+        void Histogram::write(fmt::memory_buffer &os, const char *t_name, const char *t_labels) const
+        {
+            const bool has_labels = t_labels[0] != '\0';
+            const char *sep = has_labels ? "," : "";
+            const std::string braced = has_labels ? fmt::format("{{{}}}", t_labels) : std::string();
+            uint64_t cumulative = 0;
+            for (std::size_t i = 0; i < HISTOGRAM_BUCKETS.size(); ++i)
+            {
+                cumulative += m_buckets[i].load(std::memory_order_relaxed);
+                fmt::format_to(os, "{}_bucket{{{}{}le=\"{}\"}} {}\n", t_name, t_labels, sep, HISTOGRAM_BUCKETS[i], cumulative);
+            }
+            const auto count = m_count.load(std::memory_order_relaxed);
+            fmt::format_to(os, "{}_bucket{{{}{}le=\"+Inf\"}} {}\n", t_name, t_labels, sep, count);
+            fmt::format_to(os, "{}_sum{} {:.6f}\n", t_name, braced, m_sum_us.load(std::memory_order_relaxed) / 1e6);
+            fmt::format_to(os, "{}_count{} {}\n", t_name, braced, count);
+        }
+
+        void Metrics::request(Route t_route, clock::duration t_duration, std::size_t t_bytes, bool t_error)
+        {
+            auto &route = m_routes[static_cast<std::size_t>(t_route)];
+            route.duration.observe(t_duration);
+            route.bytes_sent.fetch_add(t_bytes, std::memory_order_relaxed);
+            if (t_error)
+            {
+                route.errors.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        void Metrics::render(clock::duration t_duration)
+        {
+            m_render.observe(t_duration);
+        }
+
+        void Metrics::later_wait(clock::duration t_duration)
+        {
+            m_later_wait.observe(t_duration);
+        }
+
+        void Metrics::stale()
+        {
+            m_stale.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void Metrics::superseded()
+        {
+            m_superseded.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void Metrics::write(fmt::memory_buffer &os, std::size_t t_websocket_clients) const
+        {
+            fmt::format_to(os, "# HELP httpgd_http_requests_total Number of handled HTTP requests.\n"
+                               "# TYPE httpgd_http_requests_total counter\n");
+            for (std::size_t i = 0; i < m_routes.size(); ++i)
+            {
+                fmt::format_to(os, "httpgd_http_requests_total{{route=\"{}\"}} {}\n", ROUTE_NAMES[i], m_routes[i].duration.count());
+            }
+            fmt::format_to(os, "# HELP httpgd_http_request_errors_total Number of HTTP requests that resulted in an error.\n"
+                               "# TYPE httpgd_http_request_errors_total counter\n");
+            for (std::size_t i = 0; i < m_routes.size(); ++i)
+            {
+                fmt::format_to(os, "httpgd_http_request_errors_total{{route=\"{}\"}} {}\n", ROUTE_NAMES[i], m_routes[i].errors.load(std::memory_order_relaxed));
+            }
+            fmt::format_to(os, "# HELP httpgd_http_response_bytes_total Number of response body bytes sent.\n"
+                               "# TYPE httpgd_http_response_bytes_total counter\n");
+            for (std::size_t i = 0; i < m_routes.size(); ++i)
+            {
+                fmt::format_to(os, "httpgd_http_response_bytes_total{{route=\"{}\"}} {}\n", ROUTE_NAMES[i], m_routes[i].bytes_sent.load(std::memory_order_relaxed));
+            }
+            fmt::format_to(os, "# HELP httpgd_http_request_duration_seconds HTTP request latency.\n"
+                               "# TYPE httpgd_http_request_duration_seconds histogram\n");
+            for (std::size_t i = 0; i < m_routes.size(); ++i)
+            {
+                m_routes[i].duration.write(os, "httpgd_http_request_duration_seconds", fmt::format("route=\"{}\"", ROUTE_NAMES[i]).c_str());
+            }
+
+            fmt::format_to(os, "# HELP httpgd_websocket_clients Number of connected websocket clients.\n"
+                               "# TYPE httpgd_websocket_clients gauge\n"
+                               "httpgd_websocket_clients {}\n",
+                           t_websocket_clients);
+
+            fmt::format_to(os, "# HELP httpgd_render_duration_seconds Time spent replaying plots in the R thread.\n"
+                               "# TYPE httpgd_render_duration_seconds histogram\n");
+            m_render.write(os, "httpgd_render_duration_seconds", "");
+            fmt::format_to(os, "# HELP httpgd_later_wait_duration_seconds Time spent waiting for the R thread.\n"
+                               "# TYPE httpgd_later_wait_duration_seconds histogram\n");
+            m_later_wait.write(os, "httpgd_later_wait_duration_seconds", "");
+            fmt::format_to(os, "# HELP httpgd_svg_stale_total Number of SVGs served stale because the R thread was busy.\n"
+                               "# TYPE httpgd_svg_stale_total counter\n"
+                               "httpgd_svg_stale_total {}\n",
+                           m_stale.load(std::memory_order_relaxed));
+            fmt::format_to(os, "# HELP httpgd_renders_superseded_total Number of renders dropped because the client requested a newer one.\n"
+                               "# TYPE httpgd_renders_superseded_total counter\n"
+                               "httpgd_renders_superseded_total {}\n",
+                           m_superseded.load(std::memory_order_relaxed));
+        }
+
+        Stopwatch::Stopwatch()
+            : m_start(clock::now())
+        {
+        }
+
+        clock::duration Stopwatch::elapsed() const
+        {
+            return clock::now() - m_start;
+        }
+
+    } // namespace metrics
+} // namespace httpgd
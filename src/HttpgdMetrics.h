@@ -0,0 +1,89 @@
+#ifndef HTTPGD_METRICS_H
+#define HTTPGD_METRICS_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fmt/format.h>
+
+namespace httpgd
+{
+    namespace metrics
+    {
+        using clock = std::chrono::steady_clock;
+
+        // Upper bucket bounds in seconds
+        constexpr std::array<double, 12> HISTOGRAM_BUCKETS{
+            0.0005, 0.001, 0.0025, 0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1.0, 2.5};
+
+        // Lock free latency histogram, safe to update from any thread.
+        class Histogram
+        {
+        public:
+            void observe(clock::duration t_duration);
+            void write(fmt::memory_buffer &os, const char *t_name, const char *t_labels) const;
+            [[nodiscard]] uint64_t count() const;
+
+        private:
+            std::array<std::atomic<uint64_t>, HISTOGRAM_BUCKETS.size()> m_buckets{};
+            std::atomic<uint64_t> m_count{0};
+            std::atomic<uint64_t> m_sum_us{0};
+        };
+
+        enum class Route
+        {
+            svg = 0,
+            svg_batch,
+            plots,
+            state,
+            remove,
+            clear,
+            hit,
+            ROUTE_COUNT
+        };
+
+        struct RouteMetrics
+        {
+            Histogram duration;
+            std::atomic<uint64_t> errors{0};
+            std::atomic<uint64_t> bytes_sent{0};
+        };
+
+        // All counters of one device (and its web server).
+        // Counters are lock free so they can be updated on the hot path.
+        class Metrics
+        {
+        public:
+            void request(Route t_route, clock::duration t_duration, std::size_t t_bytes, bool t_error);
+            void render(clock::duration t_duration);
+            void later_wait(clock::duration t_duration);
+            void stale();
+            void superseded();
+
+            // Prometheus text exposition format
+            void write(fmt::memory_buffer &os, std::size_t t_websocket_clients) const;
+
+        private:
+            std::array<RouteMetrics, static_cast<std::size_t>(Route::ROUTE_COUNT)> m_routes{};
+            Histogram m_render;
+            Histogram m_later_wait;
+            std::atomic<uint64_t> m_stale{0};
+            std::atomic<uint64_t> m_superseded{0};
+        };
+
+        // Measures the lifetime of the object
+        class Stopwatch
+        {
+        public:
+            Stopwatch();
+            [[nodiscard]] clock::duration elapsed() const;
+
+        private:
+            clock::time_point m_start;
+        };
+
+    } // namespace metrics
+} // namespace httpgd
+
+#endif // HTTPGD_METRICS_H
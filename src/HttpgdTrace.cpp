@@ -0,0 +1,186 @@
+#include "HttpgdTrace.h"
+
+#include <mutex>
+#include <vector>
+
+// Do not include any R headers here!
+
+namespace httpgd
+{
+    namespace trace
+    {
+        std::atomic<bool> g_enabled{false};
+
+        namespace
+        {
+            struct Event
+            {
+                const char *name;
+                Context context;
+                uint32_t tid;
+                int64_t ts_us;
+                int64_t dur_us;
+                uint64_t count; // number of tallied intervals, 0 for spans
+            };
+
+            struct TallyState
+            {
+                const char *name = nullptr;
+                clock::duration sum{0};
+                uint64_t count = 0;
+            };
+
+            const clock::time_point g_epoch = clock::now();
+            std::atomic<trace_id_t> g_trace_counter{0};
+            std::atomic<uint32_t> g_thread_counter{0};
+
+            std::mutex g_buffer_mutex;
+            std::vector<Event> g_buffer;
+            std::size_t g_buffer_next = 0;
+
+            thread_local Context t_current{0, -1};
+            thread_local uint32_t t_tid = ++g_thread_counter;
+            thread_local TallyState t_tally;
+
+            inline int64_t to_us(clock::duration t_duration)
+            {
+                return std::chrono::duration_cast<std::chrono::microseconds>(t_duration).count();
+            }
+
+            void push(const char *t_name, const Context &t_context, clock::time_point t_start, clock::duration t_duration, uint64_t t_count)
+            {
+                const std::lock_guard<std::mutex> lock(g_buffer_mutex);
+                Event ev{t_name, t_context, t_tid, to_us(t_start - g_epoch), to_us(t_duration), t_count};
+                if (g_buffer.size() < RING_BUFFER_SIZE)
+                {
+                    g_buffer.push_back(ev);
+                }
+                else
+                {
+                    g_buffer[g_buffer_next] = ev;
+                }
+                g_buffer_next = (g_buffer_next + 1) % RING_BUFFER_SIZE;
+            }
+
+            void write_event(fmt::memory_buffer &os, const Event &ev)
+            {
+                fmt::format_to(os, "{{\"name\": \"{}\", \"cat\": \"httpgd\", \"ph\": \"X\", \"pid\": 1, \"tid\": {}, \"ts\": {}, \"dur\": {}, \"args\": {{\"trace\": {}, \"device\": {}",
+                               ev.name, ev.tid, ev.ts_us, ev.dur_us, ev.context.trace, ev.context.device);
+                if (ev.count > 0)
+                {
+                    fmt::format_to(os, ", \"count\": {}", ev.count);
+                }
+                fmt::format_to(os, "}}}}");
+            }
+        } // namespace
+
+        void enable(bool t_enabled)
+        {
+            g_enabled.store(t_enabled, std::memory_order_relaxed);
+        }
+
+        Context current()
+        {
+            return t_current;
+        }
+
+        void write_json(fmt::memory_buffer &os, int t_device)
+        {
+            const std::lock_guard<std::mutex> lock(g_buffer_mutex);
+            fmt::format_to(os, "{{\"displayTimeUnit\": \"ms\", \"traceEvents\": [");
+            // oldest first
+            const std::size_t start = g_buffer.size() < RING_BUFFER_SIZE ? 0 : g_buffer_next;
+            bool first = true;
+            for (std::size_t i = 0; i < g_buffer.size(); ++i)
+            {
+                const Event &ev = g_buffer[(start + i) % g_buffer.size()];
+                if (t_device != -1 && ev.context.device != t_device)
+                {
+                    continue;
+                }
+                if (!first)
+                {
+                    fmt::format_to(os, ",\n");
+                }
+                first = false;
+                write_event(os, ev);
+            }
+            fmt::format_to(os, "]}}");
+        }
+
+        void clear()
+        {
+            const std::lock_guard<std::mutex> lock(g_buffer_mutex);
+            g_buffer.clear();
+            g_buffer_next = 0;
+        }
+
+        Span::Span(const char *t_name)
+            : m_name(t_name),
+              m_context(enabled() ? t_current : Context{0, -1})
+        {
+            if (m_context.trace != 0)
+            {
+                m_start = clock::now();
+            }
+        }
+
+        Span::~Span()
+        {
+            end();
+        }
+
+        void Span::end()
+        {
+            if (m_context.trace == 0)
+            {
+                return;
+            }
+            push(m_name, m_context, m_start, clock::now() - m_start, 0);
+            if (t_tally.count > 0)
+            {
+                push(t_tally.name, m_context, m_start, t_tally.sum, t_tally.count);
+                t_tally = TallyState();
+            }
+            m_context.trace = 0;
+        }
+
+        Scope::Scope(const Context &t_context)
+            : m_previous(t_current)
+        {
+            t_current = t_context;
+        }
+
+        Scope::~Scope()
+        {
+            t_current = m_previous;
+        }
+
+        Request::Request(const char *t_name, int t_device)
+            : m_scope(enabled() ? Context{++g_trace_counter, t_device} : Context{0, -1}),
+              m_span(t_name)
+        {
+        }
+
+        Tally::Tally(const char *t_name)
+            : m_name(t_name),
+              m_active(t_current.trace != 0 && enabled())
+        {
+            if (m_active)
+            {
+                m_start = clock::now();
+            }
+        }
+
+        Tally::~Tally()
+        {
+            if (m_active)
+            {
+                t_tally.name = m_name;
+                t_tally.sum += clock::now() - m_start;
+                t_tally.count++;
+            }
+        }
+
+    } // namespace trace
+} // namespace httpgd
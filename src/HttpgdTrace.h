@@ -0,0 +1,100 @@
+#ifndef HTTPGD_TRACE_H
+#define HTTPGD_TRACE_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fmt/format.h>
+
+namespace httpgd
+{
+    namespace trace
+    {
+        using clock = std::chrono::steady_clock;
+        using trace_id_t = uint64_t;
+
+        // Maximum number of events kept (oldest get overwritten)
+        constexpr std::size_t RING_BUFFER_SIZE = 16384;
+
+        extern std::atomic<bool> g_enabled;
+
+        // Tracing is process wide and disabled by default.
+        inline bool enabled()
+        {
+            return g_enabled.load(std::memory_order_relaxed);
+        }
+        void enable(bool t_enabled);
+
+        // Request that is currently handled by a thread: trace id (0 if
+        // there is none, spans are only recorded inside of requests) and
+        // the device it was sent to.
+        struct Context
+        {
+            trace_id_t trace;
+            int device;
+        };
+
+        Context current();
+
+        // Chrome trace event format (JSON object) of the requests to
+        // t_device (-1: all devices)
+        void write_json(fmt::memory_buffer &os, int t_device);
+        void clear();
+
+        // Records the time from construction to destruction (or end()).
+        class Span
+        {
+        public:
+            explicit Span(const char *t_name);
+            ~Span();
+            void end();
+
+        private:
+            const char *m_name;
+            Context m_context;
+            clock::time_point m_start;
+        };
+
+        // Sets the request of the current thread for the lifetime of the
+        // object, e.g. to continue a request in the R thread.
+        class Scope
+        {
+        public:
+            explicit Scope(const Context &t_context);
+            ~Scope();
+
+        private:
+            Context m_previous;
+        };
+
+        // Starts a new trace of a request to device t_device and records
+        // its top level span.
+        class Request
+        {
+        public:
+            Request(const char *t_name, int t_device);
+
+        private:
+            Scope m_scope;
+            Span m_span;
+        };
+
+        // Sums up many short intervals (like single draw calls) that would
+        // flood the ring buffer. The sum is recorded as one event when the
+        // enclosing span ends.
+        class Tally
+        {
+        public:
+            explicit Tally(const char *t_name);
+            ~Tally();
+
+        private:
+            const char *m_name;
+            bool m_active;
+            clock::time_point m_start;
+        };
+
+    } // namespace trace
+} // namespace httpgd
+
+#endif // HTTPGD_TRACE_H
@@ -0,0 +1,42 @@
+
+#include "HttpgdWebAssets.h"
+#include <cstring>
+#include <zlib.h>
+
+namespace httpgd
+{
+    namespace web
+    {
+        const Asset *find_asset(const std::string &t_name)
+        {
+            for (std::size_t i = 0; i < ASSETS_COUNT; ++i)
+            {
+                if (t_name == ASSETS[i].name)
+                {
+                    return &ASSETS[i];
+                }
+            }
+            return nullptr;
+        }
+
+        std::string gunzip(const Asset &t_asset)
+        {
+            std::string out(t_asset.size, '\0');
+
+            z_stream zs;
+            std::memset(&zs, 0, sizeof(zs));
+            if (inflateInit2(&zs, 16 + MAX_WBITS) != Z_OK) // gzip header
+            {
+                return std::string();
+            }
+            zs.next_in = const_cast<Bytef *>(t_asset.gzip);
+            zs.avail_in = static_cast<uInt>(t_asset.gzip_size);
+            zs.next_out = reinterpret_cast<Bytef *>(&out[0]);
+            zs.avail_out = static_cast<uInt>(out.size());
+            const int ret = inflate(&zs, Z_FINISH);
+            inflateEnd(&zs);
+
+            return ret == Z_STREAM_END ? out : std::string();
+        }
+    } // namespace web
+} // namespace httpgd
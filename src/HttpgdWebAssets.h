@@ -0,0 +1,34 @@
+#ifndef HTTPGD_WEB_ASSETS_H
+#define HTTPGD_WEB_ASSETS_H
+
+#include <cstddef>
+#include <string>
+
+namespace httpgd
+{
+    namespace web
+    {
+        // Web client file of inst/www, embedded gzip compressed at build
+        // time (see tools/embed-www.R).
+        struct Asset
+        {
+            const char *name; // file name, e.g. "httpgd.js"
+            const char *content_type;
+            const char *etag; // quoted md5 of the file
+            const unsigned char *gzip;
+            std::size_t gzip_size;
+            std::size_t size; // uncompressed
+        };
+
+        extern const Asset ASSETS[];
+        extern const std::size_t ASSETS_COUNT;
+
+        // nullptr if there is no asset with this name
+        const Asset *find_asset(const std::string &t_name);
+
+        // For clients that do not accept gzip encoding.
+        std::string gunzip(const Asset &t_asset);
+    } // namespace web
+} // namespace httpgd
+
+#endif
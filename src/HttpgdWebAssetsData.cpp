@@ -0,0 +1,1185 @@
+// Generated by tools/embed-www.R from inst/www, do not edit by hand.
+
+#include "HttpgdWebAssets.h"
+
+namespace httpgd
+{
+    namespace web
+    {
+        namespace
+        {
+            const unsigned char asset_0[] = {
+                0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x5a, 0x6d, 0x6f, 0xdb, 0x38,
+                0x12, 0xfe, 0x9e, 0x5f, 0xc1, 0x0a, 0xb8, 0x56, 0xc6, 0x5a, 0xb2, 0x24, 0xbf, 0x37, 0xb1, 0x0f,
+                0x6d, 0xd2, 0x5b, 0x17, 0x97, 0x74, 0x83, 0xa6, 0xeb, 0x0f, 0x5b, 0x14, 0x85, 0x62, 0x31, 0x96,
+                0x2e, 0xb4, 0x64, 0x48, 0xb4, 0xf2, 0x72, 0x9b, 0xff, 0x7e, 0x33, 0xa4, 0x24, 0xeb, 0x25, 0xb6,
+                0x65, 0xb7, 0xbb, 0x68, 0x81, 0x6b, 0xd2, 0x58, 0x24, 0x87, 0xcf, 0x0c, 0xe7, 0x19, 0x0e, 0x5f,
+                0xe4, 0x13, 0x97, 0x2f, 0x18, 0x61, 0xb6, 0x3f, 0x1f, 0x29, 0xd4, 0x57, 0xc6, 0x47, 0x47, 0x27,
+                0x2e, 0xb5, 0x9d, 0xf1, 0x11, 0x21, 0x27, 0x0b, 0xca, 0x6d, 0x32, 0x73, 0xed, 0x30, 0xa2, 0x7c,
+                0xa4, 0xac, 0xf8, 0x8d, 0x36, 0x50, 0x44, 0x03, 0xf7, 0x38, 0xa3, 0xe3, 0x8f, 0xe4, 0x92, 0x05,
+                0xfc, 0xa4, 0x25, 0x4b, 0x47, 0xd8, 0xc0, 0x3c, 0xff, 0x96, 0x84, 0x94, 0x8d, 0x14, 0x6f, 0x16,
+                0xf8, 0x0a, 0xe1, 0x0f, 0x4b, 0x0a, 0xcf, 0x0b, 0x7b, 0x4e, 0x5b, 0x4b, 0x7f, 0xae, 0x90, 0xc8,
+                0x7b, 0xa4, 0xd1, 0x48, 0x69, 0x5b, 0xf7, 0x6d, 0x4b, 0x21, 0x6e, 0x48, 0x6f, 0x46, 0x4a, 0xeb,
+                0xc6, 0x8e, 0x51, 0x5c, 0x13, 0xb5, 0x3a, 0xca, 0x8d, 0xf7, 0x01, 0x33, 0x7b, 0xf7, 0x66, 0xaf,
+                0x02, 0x26, 0x6a, 0x4b, 0x60, 0x52, 0x44, 0x6f, 0x45, 0xfc, 0x81, 0x51, 0x7d, 0x16, 0x45, 0x8a,
+                0xc4, 0x17, 0xe5, 0xc8, 0xa5, 0x94, 0x4b, 0xe1, 0x68, 0x16, 0x7a, 0x4b, 0x4e, 0xa2, 0x70, 0x86,
+                0xd2, 0x2e, 0xe7, 0xcb, 0xb9, 0xa3, 0xff, 0x27, 0x52, 0xc6, 0x27, 0x2d, 0xd9, 0x34, 0x3e, 0x3a,
+                0x69, 0x49, 0x37, 0x1d, 0x9d, 0x5c, 0x07, 0xce, 0x83, 0xe8, 0xe5, 0x78, 0x31, 0xf1, 0x9c, 0x91,
+                0x02, 0xda, 0xb9, 0xed, 0xf9, 0x34, 0x14, 0x60, 0xb9, 0x86, 0x20, 0xa6, 0x21, 0xb3, 0x1f, 0x92,
+                0xea, 0x6a, 0x83, 0xc6, 0xe9, 0x3d, 0x47, 0x25, 0x50, 0x9f, 0x74, 0xcd, 0x3d, 0xa6, 0xc2, 0x73,
+                0x9b, 0x31, 0x1a, 0x3e, 0x68, 0x15, 0x35, 0x25, 0xd9, 0x19, 0xb3, 0x23, 0xf0, 0xce, 0x12, 0x38,
+                0x8a, 0x3d, 0x7a, 0xa7, 0x88, 0xce, 0x59, 0xa9, 0x62, 0x03, 0x0f, 0x02, 0x76, 0x6d, 0x87, 0x59,
+                0x43, 0xbe, 0xe9, 0x5a, 0xc3, 0xd6, 0x28, 0xd7, 0x86, 0x4e, 0x5a, 0xda, 0x7e, 0xbe, 0x02, 0xaa,
+                0x6c, 0x22, 0x62, 0x61, 0xa4, 0x5c, 0x86, 0x34, 0xf6, 0x82, 0x55, 0x44, 0xd4, 0x97, 0xcc, 0x0e,
+                0xc3, 0xe3, 0x86, 0x92, 0x02, 0x31, 0x7a, 0xc3, 0x95, 0xd4, 0x36, 0x44, 0xe5, 0xde, 0x12, 0x86,
+                0x1c, 0xc5, 0xf3, 0xb4, 0x52, 0x92, 0xed, 0x52, 0x6f, 0xee, 0x42, 0xd4, 0x59, 0x1d, 0x85, 0xa0,
+                0xc1, 0x6f, 0x83, 0xfb, 0x91, 0x62, 0x10, 0x83, 0x58, 0x1d, 0xf8, 0x55, 0x0a, 0x7a, 0xf1, 0xdf,
+                0x9d, 0xe7, 0x70, 0x57, 0x88, 0x8f, 0x2b, 0x6d, 0x27, 0x4b, 0x9b, 0xbb, 0x04, 0xf4, 0x5f, 0x00,
+                0x80, 0x6b, 0x75, 0x62, 0xab, 0x33, 0x31, 0x1e, 0x15, 0x72, 0xe3, 0x31, 0x20, 0xdf, 0x0f, 0x7c,
+                0xaa, 0x90, 0xd6, 0xb6, 0x6e, 0x96, 0x41, 0x4c, 0x73, 0xd2, 0xd7, 0x07, 0x6d, 0xd6, 0xd5, 0xbb,
+                0x43, 0x0d, 0xff, 0x9c, 0x9b, 0x16, 0xe9, 0x30, 0x6d, 0x40, 0xe4, 0x8f, 0xa9, 0x77, 0x4c, 0x0d,
+                0xff, 0x9c, 0xa3, 0x18, 0x31, 0xdb, 0x13, 0xcb, 0x88, 0x35, 0xeb, 0xf1, 0x19, 0x64, 0x08, 0xa2,
+                0x78, 0x3e, 0x16, 0xfe, 0x2b, 0x39, 0x42, 0xf2, 0x5f, 0x71, 0x1e, 0x74, 0x40, 0x5f, 0x9f, 0xb4,
+                0xec, 0x4d, 0xfe, 0xfe, 0x40, 0xef, 0x68, 0xc4, 0x89, 0xfa, 0x61, 0xed, 0xe8, 0xa5, 0xbf, 0x5a,
+                0x54, 0x1d, 0x6d, 0xb4, 0x8c, 0xcd, 0x8a, 0xd7, 0x28, 0x75, 0x34, 0xde, 0x83, 0xe4, 0xcb, 0xb0,
+                0xc8, 0x6e, 0x88, 0xa4, 0xfd, 0x74, 0xf4, 0x4a, 0x26, 0x91, 0x3c, 0x41, 0xe3, 0x39, 0xe4, 0x0d,
+                0xb3, 0x8f, 0x8c, 0x03, 0x94, 0x6b, 0x5a, 0x50, 0x60, 0x48, 0xf9, 0x80, 0xa4, 0xbc, 0x5b, 0x06,
+                0x1b, 0x68, 0x83, 0x43, 0xb8, 0x2d, 0xb8, 0x6d, 0xa3, 0x97, 0x5f, 0x68, 0x5a, 0x56, 0xa1, 0x69,
+                0x85, 0x59, 0xd7, 0x2a, 0x4f, 0xbb, 0xad, 0xf3, 0xf0, 0x8f, 0x20, 0x58, 0x90, 0x60, 0x05, 0x2a,
+                0xb5, 0x35, 0x49, 0x0b, 0xcf, 0x5f, 0x45, 0x3f, 0x04, 0x49, 0xd3, 0xba, 0x34, 0x55, 0x6a, 0x89,
+                0x24, 0x0e, 0x08, 0x21, 0x66, 0xc7, 0xd5, 0xf4, 0xfe, 0x90, 0x69, 0xba, 0x35, 0x80, 0xff, 0xfd,
+                0x53, 0xa8, 0x45, 0x26, 0x2d, 0x20, 0x8b, 0x98, 0x3d, 0xe0, 0x51, 0x37, 0x4d, 0x7c, 0x18, 0xa2,
+                0x70, 0x0f, 0x48, 0x1c, 0x42, 0xb1, 0xad, 0x1b, 0x43, 0xd2, 0x16, 0x75, 0xed, 0xab, 0xb6, 0xac,
+                0x94, 0x45, 0xd9, 0x9e, 0x8a, 0xcf, 0x4c, 0xbd, 0x67, 0xc2, 0x90, 0x51, 0x5e, 0x43, 0xc4, 0x8e,
+                0x6e, 0xb5, 0x21, 0x56, 0xba, 0x7d, 0x06, 0xba, 0x40, 0x65, 0x8c, 0xba, 0xbb, 0x50, 0x3d, 0x1c,
+                0x9e, 0x5b, 0x86, 0xde, 0x01, 0x9d, 0x60, 0x0b, 0x16, 0xb5, 0xee, 0xe3, 0x42, 0xeb, 0x11, 0xe3,
+                0xb4, 0xaf, 0x1b, 0x80, 0xd8, 0x21, 0x5d, 0xb4, 0x65, 0x38, 0x84, 0x4f, 0xc0, 0xbe, 0x12, 0xb5,
+                0x5d, 0xa9, 0x12, 0x5b, 0x53, 0x29, 0xa1, 0x57, 0xc8, 0xa5, 0x85, 0xce, 0xe3, 0x45, 0x9f, 0x0c,
+                0xdd, 0x6e, 0x0c, 0x39, 0xe8, 0x90, 0xa0, 0xcb, 0x47, 0xc1, 0xee, 0x99, 0xfd, 0x91, 0xc2, 0x72,
+                0x4f, 0x1e, 0xb1, 0x8f, 0x6a, 0xac, 0xa3, 0xe6, 0x91, 0xc5, 0xac, 0x1a, 0x34, 0xa6, 0x61, 0xfc,
+                0x63, 0xb3, 0xe2, 0x35, 0x54, 0x85, 0x40, 0x80, 0xde, 0x6d, 0x8a, 0x30, 0xdc, 0xf3, 0x89, 0xfa,
+                0x4b, 0x2e, 0xaf, 0xb1, 0xff, 0x07, 0xef, 0xcf, 0x15, 0xbc, 0xbb, 0xb3, 0xaf, 0x69, 0xb8, 0x9a,
+                0x15, 0x5b, 0x93, 0x21, 0xac, 0x98, 0x93, 0xfe, 0x74, 0xe8, 0x5a, 0xd3, 0xbe, 0x6b, 0x42, 0xf2,
+                0xb5, 0x62, 0xf3, 0xe0, 0x80, 0x97, 0x71, 0xf3, 0xd7, 0xe7, 0xd8, 0x33, 0xca, 0x28, 0xa7, 0x44,
+                0x3d, 0xcb, 0x2d, 0x83, 0x74, 0x01, 0x5b, 0xba, 0xdd, 0x51, 0xaa, 0xdd, 0xd9, 0xe1, 0x0f, 0xb4,
+                0x18, 0x6e, 0x0a, 0xd4, 0x21, 0xe9, 0x89, 0x65, 0xb1, 0x8f, 0x21, 0x04, 0x94, 0x22, 0x61, 0xf8,
+                0x88, 0xb5, 0x04, 0x03, 0x40, 0x3c, 0xc8, 0x3a, 0x68, 0x04, 0x89, 0x7e, 0xd6, 0x6c, 0x8a, 0x2a,
+                0x88, 0x58, 0x7c, 0x16, 0xd5, 0xa6, 0xfc, 0x95, 0xcf, 0xb2, 0xfe, 0xa0, 0x6d, 0xd2, 0xda, 0xef,
+                0xdf, 0x8f, 0xe3, 0x54, 0x91, 0x13, 0x06, 0x4b, 0x65, 0x13, 0xe1, 0x17, 0x41, 0x48, 0xd7, 0x8b,
+                0x29, 0x16, 0xf6, 0x4f, 0x3f, 0x09, 0x1f, 0xd7, 0xcc, 0x9e, 0xdd, 0x2a, 0x7f, 0x3b, 0xa1, 0x16,
+                0x19, 0x40, 0x6a, 0xc0, 0xcc, 0x60, 0x69, 0xfa, 0x10, 0xfe, 0x58, 0x11, 0x7c, 0x6a, 0x96, 0xfc,
+                0x21, 0xf8, 0x48, 0xf0, 0x83, 0xe0, 0x87, 0xf5, 0xb8, 0x00, 0xb9, 0x99, 0x26, 0x3a, 0x64, 0xad,
+                0x51, 0xda, 0x9a, 0x41, 0x64, 0x08, 0x28, 0xdf, 0xdb, 0x47, 0x7e, 0x33, 0xf9, 0x15, 0x46, 0x57,
+                0xac, 0x22, 0xc9, 0xbc, 0x71, 0x6e, 0x32, 0x06, 0x77, 0x3e, 0x0b, 0x6c, 0x87, 0x5c, 0x4d, 0x7f,
+                0x25, 0xea, 0xd5, 0x7a, 0x4a, 0x46, 0x76, 0x4c, 0x35, 0xc0, 0x4c, 0xb8, 0xda, 0x45, 0xcf, 0x36,
+                0x46, 0xbe, 0x81, 0x95, 0x6d, 0xcc, 0xe4, 0xa6, 0x9b, 0x69, 0xc5, 0xfd, 0x49, 0x37, 0xd6, 0xfa,
+                0x93, 0x76, 0xdc, 0x9f, 0xc1, 0xe1, 0x43, 0x37, 0x53, 0xf7, 0xb9, 0x66, 0xa7, 0x44, 0x1d, 0x88,
+                0xb9, 0xe8, 0x74, 0xc8, 0xd6, 0x7a, 0xaf, 0xcf, 0x70, 0xe5, 0xd0, 0xe0, 0xcf, 0xe0, 0x5c, 0xec,
+                0x61, 0xf5, 0x2e, 0xec, 0x5d, 0x49, 0x57, 0x83, 0x9f, 0xdc, 0x19, 0xc5, 0x14, 0x4b, 0x4c, 0xaf,
+                0x3f, 0x6d, 0xbb, 0xd6, 0xe3, 0x06, 0x4b, 0x73, 0xf3, 0x6f, 0x9c, 0x77, 0x6b, 0x3a, 0xdb, 0xca,
+                0xf3, 0x45, 0xbb, 0xbd, 0x76, 0x94, 0xf1, 0x55, 0x6e, 0x32, 0x9e, 0xb4, 0x80, 0x9b, 0x7a, 0x74,
+                0x5d, 0x7e, 0x00, 0xba, 0x2e, 0x4b, 0x74, 0x89, 0xc3, 0xfb, 0x8f, 0x4e, 0xd7, 0x40, 0xef, 0x36,
+                0x21, 0x8d, 0x75, 0xc1, 0xa7, 0x4d, 0x38, 0x38, 0xc0, 0x67, 0x07, 0x6b, 0xac, 0x73, 0x73, 0xd8,
+                0x34, 0x07, 0x93, 0xee, 0x85, 0x05, 0xf5, 0xc3, 0x69, 0xf7, 0x14, 0x3e, 0xdb, 0xfa, 0x00, 0x28,
+                0x33, 0x74, 0x78, 0x82, 0x1c, 0xd8, 0x6c, 0x4f, 0xba, 0x6f, 0xac, 0xa6, 0x05, 0xc3, 0x30, 0x9a,
+                0xb0, 0x48, 0x37, 0xbb, 0x53, 0x73, 0x98, 0xab, 0xe8, 0x36, 0x2d, 0x73, 0x52, 0xa8, 0x11, 0x50,
+                0x7f, 0xec, 0xc3, 0x17, 0xf8, 0x75, 0x3b, 0x5f, 0x97, 0x7b, 0xf1, 0x75, 0x1a, 0x2c, 0x1f, 0x24,
+                0x57, 0xa7, 0x6b, 0xae, 0x66, 0x50, 0xf9, 0x73, 0x70, 0x85, 0x1b, 0xaa, 0x49, 0xa7, 0x9c, 0x9a,
+                0x62, 0xd8, 0x84, 0x59, 0x30, 0x13, 0x4c, 0x6b, 0x6a, 0x3e, 0x2e, 0xda, 0xa4, 0x33, 0x19, 0x3c,
+                0x23, 0x52, 0x9e, 0x86, 0x66, 0x69, 0x1a, 0x4e, 0x61, 0xa2, 0x62, 0xaf, 0x42, 0x1a, 0x34, 0x7b,
+                0x93, 0x01, 0x6e, 0x65, 0xcc, 0x78, 0xd3, 0x3e, 0xa8, 0xc8, 0x5b, 0xea, 0xdf, 0xed, 0x9c, 0x9d,
+                0xd6, 0xe3, 0x2c, 0xa5, 0x87, 0x51, 0x3b, 0xcc, 0xf6, 0x22, 0xb8, 0xe3, 0xd0, 0x5c, 0xbc, 0x70,
+                0xfa, 0x41, 0xe8, 0x3a, 0x64, 0x5b, 0x5d, 0x87, 0x6b, 0xa0, 0x7a, 0x58, 0xe2, 0x6c, 0x50, 0xa1,
+                0x6c, 0xd2, 0x8b, 0x61, 0xf3, 0xb1, 0xb0, 0xf4, 0x4e, 0x4f, 0xeb, 0xeb, 0xa6, 0xc5, 0x72, 0x29,
+                0xd2, 0x92, 0xbb, 0x70, 0x48, 0xa8, 0x26, 0xc8, 0xea, 0x58, 0x5e, 0xdf, 0x10, 0xc8, 0x7d, 0x4b,
+                0x47, 0x34, 0x12, 0x21, 0x91, 0x6b, 0x04, 0x49, 0xdc, 0xc5, 0x33, 0xad, 0xd8, 0x9a, 0xe0, 0xca,
+                0x6d, 0x52, 0x47, 0xb4, 0xb6, 0x85, 0xc8, 0xa3, 0x3c, 0x0b, 0xe0, 0x1d, 0x84, 0x66, 0xba, 0x1a,
+                0x64, 0x6c, 0x40, 0x82, 0xfc, 0x8f, 0xc9, 0x7e, 0x5a, 0x2f, 0x6e, 0x90, 0x63, 0x62, 0x33, 0x46,
+                0xf0, 0x82, 0x2f, 0xda, 0x1e, 0x3e, 0x6f, 0x18, 0xff, 0xe5, 0x6c, 0xaf, 0x10, 0x72, 0xbd, 0x88,
+                0x07, 0xe1, 0x43, 0xbd, 0x88, 0xd9, 0xc5, 0x75, 0xbb, 0x69, 0x76, 0x27, 0x96, 0x39, 0x35, 0xdb,
+                0x93, 0xf6, 0xd4, 0xec, 0x62, 0x79, 0x28, 0xca, 0x7d, 0x2c, 0x0f, 0xb1, 0x6c, 0x62, 0x79, 0x88,
+                0x45, 0xf3, 0x02, 0xd3, 0x62, 0x1f, 0xcb, 0xdd, 0x49, 0xbb, 0x4e, 0xea, 0xbb, 0x72, 0x83, 0x3b,
+                0x92, 0x18, 0xbc, 0xdd, 0x0f, 0x93, 0xad, 0x3e, 0x38, 0x69, 0x95, 0xf7, 0x1a, 0x7b, 0x6c, 0x27,
+                0x73, 0x77, 0xb1, 0xe5, 0x82, 0xb7, 0x98, 0x0b, 0xb7, 0x3a, 0xa1, 0x7d, 0xe7, 0xe1, 0x2d, 0xf6,
+                0x2c, 0x0c, 0xa2, 0x28, 0x08, 0xbd, 0xb9, 0xe7, 0x8f, 0x14, 0x1b, 0x62, 0xfe, 0x61, 0x11, 0xac,
+                0xc4, 0x5d, 0x33, 0x88, 0x6e, 0xbd, 0xda, 0x4d, 0x69, 0x11, 0x78, 0x91, 0xe7, 0x50, 0x71, 0x7f,
+                0x9b, 0x09, 0xaf, 0x1f, 0xd2, 0x4b, 0x6b, 0x04, 0x80, 0xdd, 0x69, 0xc4, 0x09, 0x98, 0x1b, 0xda,
+                0x8b, 0x88, 0x8c, 0x88, 0x4f, 0xef, 0xc8, 0xef, 0x1f, 0xcf, 0x55, 0x30, 0xc6, 0x09, 0xee, 0x74,
+                0x16, 0xcc, 0x6c, 0xee, 0x05, 0xbe, 0x8e, 0x77, 0xe5, 0x0d, 0x3d, 0x82, 0xb8, 0x9a, 0xb9, 0x97,
+                0x42, 0xf8, 0xf8, 0x48, 0x00, 0x78, 0x37, 0x44, 0x4d, 0xba, 0xeb, 0xae, 0x1d, 0xa9, 0x99, 0xe6,
+                0x06, 0x79, 0xf9, 0x32, 0x05, 0xd6, 0xe7, 0x94, 0xe7, 0x5a, 0x1a, 0xe4, 0xbf, 0x99, 0x6f, 0x9c,
+                0x60, 0xb6, 0x5a, 0x50, 0x9f, 0xa3, 0xc8, 0x3b, 0x46, 0xf1, 0xf1, 0xed, 0xc3, 0x7b, 0x27, 0x27,
+                0xad, 0x8b, 0xf1, 0x9d, 0xc3, 0xe8, 0x74, 0xdb, 0x71, 0xd4, 0x57, 0x7e, 0xc0, 0x43, 0xdb, 0x8f,
+                0x3c, 0xb4, 0xeb, 0x55, 0xe3, 0x78, 0x37, 0x52, 0x76, 0xcb, 0xfd, 0xed, 0x50, 0x5b, 0x8c, 0x42,
+                0xf7, 0x7f, 0xb3, 0x39, 0x65, 0x90, 0x88, 0xf2, 0x4f, 0xde, 0x82, 0x06, 0x2b, 0xae, 0xaa, 0x0d,
+                0x32, 0x1a, 0xe7, 0x1c, 0xb7, 0xa7, 0x95, 0xf2, 0x10, 0xba, 0x79, 0xc8, 0xfb, 0x1a, 0xbc, 0x0b,
+                0xef, 0xa9, 0xd9, 0x36, 0x8c, 0xac, 0xfc, 0x24, 0x83, 0x25, 0x86, 0xb4, 0x24, 0xdf, 0x9f, 0x4c,
+                0x01, 0x8f, 0x86, 0x49, 0xc0, 0x4d, 0x72, 0x55, 0x6a, 0xd2, 0xa3, 0x10, 0x53, 0x6e, 0x10, 0x71,
+                0x08, 0xa8, 0x7f, 0x16, 0xe3, 0x29, 0xa9, 0x7d, 0x4d, 0x2a, 0xc1, 0x0a, 0x0d, 0xcd, 0xe7, 0x70,
+                0x78, 0x70, 0x4b, 0xfd, 0x2a, 0x50, 0x5a, 0xfd, 0x9a, 0xf8, 0x2b, 0xc6, 0x9e, 0xed, 0x79, 0x17,
+                0x89, 0x6e, 0x6a, 0xa1, 0x9f, 0xa8, 0x7c, 0x31, 0x22, 0x8a, 0x21, 0x3a, 0xf3, 0x70, 0x45, 0xcb,
+                0x9d, 0x85, 0x5c, 0x48, 0x7d, 0x87, 0x86, 0xb0, 0xc6, 0x36, 0x44, 0x6b, 0x23, 0x99, 0x3a, 0x89,
+                0xd9, 0x81, 0xdc, 0x9b, 0x8d, 0xc8, 0xcd, 0xca, 0x9f, 0xa1, 0xfd, 0x44, 0xc5, 0x09, 0x92, 0x00,
+                0xc9, 0x09, 0x8a, 0x69, 0x0a, 0x39, 0x01, 0xa9, 0x8d, 0x34, 0xa5, 0xc7, 0xcf, 0x86, 0x0e, 0xba,
+                0xa1, 0x36, 0x69, 0x4c, 0x29, 0x48, 0x21, 0x40, 0x1f, 0x66, 0x14, 0x0a, 0x4d, 0x82, 0x80, 0x72,
+                0x5c, 0x65, 0x72, 0xa5, 0xe0, 0x14, 0x99, 0x32, 0x58, 0xd2, 0x1c, 0xcb, 0x4f, 0x9b, 0xb0, 0x61,
+                0xfd, 0x89, 0x69, 0x3d, 0xec, 0x34, 0x8e, 0xb6, 0xc1, 0x67, 0x8e, 0x99, 0xb1, 0x20, 0xa2, 0x67,
+                0x20, 0x09, 0x7e, 0xf3, 0xd5, 0xc6, 0xe1, 0xc8, 0xa9, 0x77, 0xf3, 0xc1, 0x08, 0xc6, 0xe3, 0x4d,
+                0xd1, 0x15, 0x0f, 0x21, 0x11, 0x9f, 0xba, 0xb6, 0x3f, 0x17, 0x43, 0x88, 0xca, 0x63, 0xd8, 0xe2,
+                0x7f, 0x71, 0x2b, 0x0a, 0xb3, 0xc4, 0xf5, 0x98, 0xf3, 0x21, 0x70, 0x68, 0xf4, 0xd9, 0xf8, 0xa2,
+                0xfb, 0xf0, 0x30, 0xb5, 0xd9, 0x0a, 0xd1, 0xa2, 0xb5, 0x05, 0xcf, 0x1a, 0xf0, 0x1e, 0x02, 0xe5,
+                0xfe, 0x5b, 0x2c, 0x10, 0xef, 0x79, 0xbe, 0xc5, 0x82, 0x33, 0x2f, 0x82, 0x90, 0xf3, 0xe9, 0x8c,
+                0x53, 0x67, 0x6d, 0x82, 0x53, 0xd7, 0x84, 0xc2, 0xbb, 0xcb, 0x86, 0xee, 0x01, 0x52, 0xf8, 0x09,
+                0xdf, 0x72, 0xc0, 0x2c, 0x39, 0x95, 0xb8, 0x48, 0x24, 0xf0, 0xc8, 0x75, 0xe5, 0xb8, 0x36, 0x1e,
+                0x40, 0xc9, 0xb7, 0xb4, 0x8e, 0x17, 0x2d, 0xa1, 0x8c, 0xf3, 0x00, 0xa6, 0xa3, 0xe2, 0xf9, 0xcc,
+                0xc3, 0x5d, 0xe1, 0x6b, 0x22, 0xb7, 0x87, 0xe5, 0xc1, 0xad, 0x13, 0xce, 0x57, 0xcf, 0xb7, 0x41,
+                0x77, 0x4c, 0xbf, 0x3a, 0x14, 0x00, 0xa8, 0x73, 0xbc, 0x61, 0xfc, 0x34, 0xf6, 0x66, 0xf4, 0x8d,
+                0x10, 0xdd, 0x3c, 0x7e, 0x5c, 0xf5, 0x5e, 0x38, 0x8d, 0x42, 0x3a, 0x16, 0x3b, 0xeb, 0x34, 0x5b,
+                0x6f, 0x50, 0x5a, 0x2f, 0xe1, 0x6e, 0x1e, 0x74, 0x71, 0x94, 0xeb, 0x71, 0x12, 0x42, 0x59, 0x44,
+                0x0b, 0xe6, 0x6c, 0xb0, 0x00, 0x43, 0x60, 0xdb, 0xa2, 0x72, 0x20, 0xb7, 0xd2, 0x6d, 0x24, 0xd5,
+                0x96, 0xe7, 0xf6, 0xd0, 0xa1, 0x26, 0xdc, 0xe6, 0x81, 0x9e, 0x9a, 0xc4, 0x34, 0x72, 0xcb, 0xca,
+                0xda, 0x01, 0xe9, 0x67, 0x92, 0x53, 0x21, 0x63, 0xbd, 0x8b, 0x41, 0x09, 0x26, 0x02, 0x0a, 0x66,
+                0xaa, 0xaf, 0x42, 0x8a, 0xdf, 0x0f, 0x78, 0xd5, 0x4c, 0x72, 0x52, 0x81, 0x75, 0xd9, 0xa6, 0x36,
+                0xd2, 0xc4, 0x5c, 0x0a, 0x0a, 0xcf, 0xf7, 0xb8, 0xba, 0x71, 0x04, 0xe9, 0xce, 0xad, 0xd1, 0xac,
+                0xb1, 0x20, 0xaf, 0x35, 0x6c, 0x9b, 0xc4, 0xe2, 0xad, 0x78, 0x03, 0x82, 0x71, 0xc6, 0xbc, 0xd9,
+                0x6d, 0x96, 0x47, 0x0b, 0x46, 0xf9, 0x76, 0x9c, 0xbe, 0x19, 0x56, 0x33, 0x7f, 0x6c, 0x03, 0x95,
+                0x2f, 0x63, 0x77, 0xa3, 0xe2, 0x3b, 0xc9, 0x7a, 0x88, 0x49, 0xae, 0xd9, 0x0d, 0x88, 0xef, 0x91,
+                0xeb, 0x41, 0x66, 0xf7, 0x72, 0x55, 0xd8, 0x75, 0x90, 0x16, 0x14, 0x38, 0xc9, 0xdd, 0x06, 0x7e,
+                0xf9, 0xe4, 0x6a, 0xfa, 0x6b, 0x0d, 0x9e, 0x72, 0xd1, 0x53, 0x5a, 0x4f, 0xca, 0xd9, 0x63, 0xa7,
+                0xa5, 0x78, 0xcd, 0x71, 0x90, 0xa5, 0x70, 0xa8, 0xff, 0x3e, 0x96, 0xd6, 0x71, 0x6a, 0x76, 0x23,
+                0x53, 0xdb, 0x54, 0xec, 0xf1, 0xb7, 0x9b, 0x29, 0x5e, 0xe5, 0xed, 0x08, 0x27, 0x7c, 0x79, 0xf8,
+                0xde, 0xaf, 0x17, 0x4b, 0xf2, 0xc5, 0x76, 0x0d, 0xc0, 0xdf, 0x56, 0x35, 0xa3, 0x33, 0x59, 0xde,
+                0x77, 0x02, 0x8a, 0x17, 0x9d, 0xf5, 0x20, 0xe5, 0x75, 0x4c, 0x6d, 0x62, 0x60, 0x3a, 0x89, 0xc3,
+                0xbd, 0xfa, 0x9d, 0x7c, 0x9e, 0xbc, 0x9a, 0xda, 0x3d, 0x89, 0x3f, 0xca, 0xcd, 0x14, 0xe6, 0xaf,
+                0xf2, 0xa6, 0x8c, 0x07, 0xf3, 0x39, 0xa3, 0x57, 0x32, 0xc5, 0xa9, 0x07, 0x9f, 0xed, 0x24, 0xcc,
+                0xfa, 0x10, 0x74, 0xe0, 0x41, 0x6a, 0x23, 0x4c, 0x65, 0xd5, 0x2b, 0x46, 0xbc, 0x4b, 0x67, 0xb7,
+                0x1f, 0x93, 0x75, 0xa0, 0x49, 0xda, 0x85, 0x45, 0x66, 0x63, 0x9a, 0x28, 0xec, 0xd1, 0x61, 0xd7,
+                0xbb, 0xf8, 0x0a, 0x4a, 0x77, 0xec, 0xd1, 0xd3, 0x63, 0x7a, 0xad, 0xf0, 0xc8, 0x84, 0x2b, 0x04,
+                0x95, 0xbc, 0x7e, 0x5c, 0xb4, 0x25, 0x72, 0x83, 0x90, 0xcf, 0x56, 0x1c, 0x8d, 0xf9, 0x9c, 0x8d,
+                0x23, 0xbf, 0xce, 0xdf, 0xd2, 0x87, 0xe8, 0x35, 0xf9, 0xdc, 0xee, 0x37, 0x49, 0xc7, 0xf8, 0xd2,
+                0xcc, 0xb5, 0x00, 0xb1, 0xaf, 0x77, 0xae, 0x38, 0xb9, 0x73, 0xde, 0x56, 0xf8, 0x21, 0xf8, 0x72,
+                0x50, 0x17, 0x5e, 0x2e, 0x3d, 0x35, 0xa1, 0xfb, 0x7b, 0xc0, 0xca, 0x05, 0xa8, 0x26, 0xb0, 0x39,
+                0xe8, 0xd7, 0x42, 0x4e, 0x73, 0x51, 0x6d, 0xd8, 0x61, 0x6d, 0x58, 0x91, 0x91, 0x76, 0xe1, 0xda,
+                0x8c, 0xff, 0x9b, 0x3e, 0x14, 0x8f, 0x9d, 0x39, 0x7d, 0xbd, 0xda, 0xfe, 0x49, 0x32, 0x4a, 0xcd,
+                0x71, 0x74, 0x7a, 0x4d, 0x52, 0x1f, 0x3b, 0xcd, 0x1b, 0x35, 0xc1, 0x07, 0xed, 0x5a, 0xc0, 0x07,
+                0x2c, 0xfa, 0x75, 0x0d, 0x30, 0xf6, 0x36, 0xa0, 0xe6, 0x22, 0x59, 0xd7, 0xbd, 0x83, 0xda, 0x51,
+                0x92, 0x2c, 0x33, 0x35, 0x81, 0x7b, 0xf5, 0xa2, 0x7a, 0xcf, 0xa5, 0xbf, 0xee, 0x64, 0xb5, 0x36,
+                0x29, 0x2f, 0xe5, 0xb1, 0xca, 0xc6, 0xfe, 0x4b, 0x96, 0xd9, 0x36, 0x6e, 0xed, 0x41, 0x07, 0xf2,
+                0x81, 0x7b, 0x7b, 0x5a, 0x5a, 0x3c, 0x6f, 0x82, 0x90, 0xa8, 0x8c, 0x72, 0x62, 0xcb, 0xb5, 0x2a,
+                0xb8, 0x59, 0xa7, 0xc6, 0xe2, 0xe9, 0x2d, 0x93, 0x04, 0xb4, 0x53, 0x38, 0x2f, 0xa3, 0xa8, 0xec,
+                0xa4, 0xe3, 0x18, 0x1a, 0xa5, 0x43, 0x12, 0x1e, 0x00, 0x53, 0xc9, 0xd1, 0x88, 0x50, 0x3d, 0x29,
+                0x94, 0xe5, 0x92, 0xa3, 0x62, 0x82, 0x24, 0xa7, 0x2c, 0xf9, 0xf3, 0x4f, 0xe8, 0x20, 0x9f, 0xab,
+                0xf2, 0x24, 0x55, 0x0b, 0x4e, 0x52, 0x1b, 0xc7, 0x95, 0x56, 0xaa, 0x2f, 0x21, 0x0b, 0x83, 0x03,
+                0xce, 0xe8, 0x8d, 0xbd, 0x62, 0xfc, 0x39, 0x99, 0x90, 0xf2, 0x55, 0xe8, 0x97, 0xeb, 0x9f, 0x8e,
+                0x36, 0x95, 0x9e, 0xaa, 0xe7, 0xa9, 0xdc, 0x4a, 0x9f, 0x5b, 0xde, 0xf8, 0x35, 0xdf, 0xba, 0xbc,
+                0x25, 0xdf, 0x1a, 0xce, 0x4c, 0xca, 0x75, 0x9d, 0xf9, 0x5b, 0xbb, 0xae, 0xbf, 0xbf, 0x5c, 0xea,
+                0xfc, 0xe9, 0xed, 0xd7, 0x7f, 0xbd, 0x39, 0x7b, 0xf7, 0xf5, 0xd3, 0xfb, 0x8b, 0x77, 0xbf, 0xfd,
+                0xfe, 0x09, 0x30, 0x3a, 0x70, 0x04, 0xcc, 0xa2, 0x22, 0x77, 0xc2, 0xe7, 0xd7, 0x5f, 0x6f, 0x6c,
+                0x87, 0x3e, 0x77, 0xc2, 0x4d, 0x8d, 0x2f, 0x5d, 0x6a, 0x29, 0x28, 0xaf, 0x81, 0x18, 0x9e, 0xde,
+                0x4a, 0x8a, 0x32, 0x33, 0x52, 0xeb, 0xd3, 0xcb, 0x2d, 0x4c, 0x68, 0x95, 0xdb, 0xba, 0xf5, 0x31,
+                0xbc, 0xa2, 0x28, 0xb9, 0x87, 0xca, 0xe9, 0xca, 0xef, 0x2c, 0xaa, 0x77, 0x06, 0xc9, 0x30, 0x72,
+                0x52, 0x7f, 0xed, 0xf8, 0x9e, 0x36, 0x8c, 0x33, 0xbd, 0xc4, 0x5b, 0x0f, 0x54, 0x54, 0x8b, 0xc9,
+                0xb7, 0x63, 0xc8, 0x25, 0xdd, 0x45, 0x4d, 0x4f, 0xe2, 0x65, 0xc4, 0xfa, 0x9b, 0xf3, 0xf2, 0x1b,
+                0xf3, 0xf8, 0x15, 0x7a, 0xbe, 0x60, 0xe3, 0xff, 0x01, 0x0f, 0xd4, 0xbe, 0x63, 0x82, 0x30, 0x00,
+                0x00,
+            };
+            const unsigned char asset_1[] = {
+                0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xd5, 0x3d, 0xfd, 0x73, 0xdb, 0x38,
+                0xae, 0xbf, 0xf7, 0xaf, 0x60, 0xf3, 0xe6, 0x56, 0x72, 0xe3, 0x38, 0x4e, 0x9a, 0xf6, 0xfa, 0x92,
+                0x4b, 0x77, 0xd2, 0x34, 0xbb, 0xcd, 0x5e, 0xb6, 0xc9, 0x24, 0xe9, 0xf6, 0xde, 0x75, 0x32, 0x19,
+                0x59, 0xa2, 0x6d, 0x6d, 0x65, 0xc9, 0x27, 0xc9, 0xf9, 0xd8, 0x6d, 0xfe, 0xf7, 0x03, 0x40, 0x4a,
+                0x22, 0x25, 0x52, 0x56, 0xd2, 0xed, 0xc7, 0xeb, 0xec, 0xd6, 0xb6, 0x44, 0x02, 0x20, 0x08, 0x80,
+                0x00, 0x08, 0xb2, 0x2b, 0x8b, 0x8c, 0xb3, 0x2c, 0x4f, 0x43, 0x3f, 0x5f, 0xd9, 0x79, 0x74, 0xe5,
+                0xa5, 0xec, 0xf2, 0xd2, 0xbb, 0xf6, 0xc2, 0x9c, 0xa7, 0x6c, 0x97, 0xb9, 0xf9, 0x34, 0xcc, 0xd8,
+                0x0f, 0x3f, 0x30, 0xfc, 0x1c, 0x94, 0x6f, 0x7a, 0xec, 0xd3, 0x27, 0x36, 0x5e, 0xc4, 0x7e, 0x1e,
+                0x26, 0xb1, 0x68, 0xb4, 0x97, 0x4e, 0xfa, 0xec, 0xd2, 0x4b, 0x27, 0x8b, 0x19, 0x8f, 0xf3, 0xac,
+                0xcf, 0x4e, 0xfa, 0x6c, 0xc2, 0x63, 0x9e, 0x7a, 0x79, 0x02, 0xed, 0xff, 0x7c, 0xc4, 0xe0, 0x4f,
+                0xd9, 0xc5, 0x0b, 0x92, 0x79, 0xee, 0x5e, 0x79, 0xd1, 0x82, 0xc3, 0x3b, 0x96, 0xf2, 0x7c, 0x91,
+                0xc6, 0x8c, 0x7e, 0xb3, 0x30, 0xce, 0x72, 0x2f, 0xf6, 0x79, 0x32, 0x66, 0x27, 0xec, 0x47, 0xf9,
+                0x70, 0x9b, 0xc5, 0xfc, 0x9a, 0x9d, 0xb8, 0x15, 0xd2, 0x94, 0x67, 0x49, 0x74, 0x25, 0xbb, 0xd3,
+                0x57, 0x09, 0x6f, 0x87, 0xdd, 0xe1, 0xff, 0x84, 0x50, 0x02, 0xc6, 0xbe, 0xee, 0x09, 0x12, 0x0d,
+                0x7f, 0xef, 0xb2, 0x93, 0x34, 0x99, 0x85, 0x19, 0xef, 0xf5, 0x9a, 0xe0, 0xfa, 0xd0, 0xe5, 0x77,
+                0xee, 0xe7, 0x05, 0xc5, 0x1a, 0xd5, 0xe3, 0x45, 0x34, 0x0e, 0xa3, 0x88, 0x07, 0x15, 0xe5, 0x79,
+                0x7a, 0x0b, 0x7f, 0x67, 0x39, 0x9f, 0xbb, 0xe5, 0x68, 0x07, 0x31, 0xbf, 0x29, 0x06, 0x87, 0x94,
+                0x30, 0xdf, 0xcb, 0xfd, 0x29, 0x73, 0x25, 0xad, 0x08, 0xde, 0x25, 0x32, 0x25, 0x91, 0x1a, 0x0e,
+                0xf1, 0x7e, 0x19, 0x8a, 0x0f, 0x2b, 0xf9, 0x34, 0x4d, 0xae, 0x57, 0x2e, 0x1e, 0x8a, 0x86, 0xc0,
+                0xc1, 0x98, 0x17, 0x51, 0x2e, 0x39, 0x08, 0xdf, 0x06, 0x41, 0x12, 0x73, 0x60, 0x79, 0xc1, 0x4f,
+                0xf9, 0x54, 0x52, 0xb2, 0x2d, 0x67, 0x4d, 0x7b, 0x3a, 0xc8, 0xa7, 0x3c, 0x76, 0x4b, 0xc6, 0xf4,
+                0x4b, 0xfa, 0xcb, 0x29, 0xc0, 0x3f, 0x84, 0xad, 0xa2, 0x1e, 0xa6, 0xa0, 0x62, 0x96, 0x37, 0x9f,
+                0x47, 0xb7, 0x26, 0x11, 0xc2, 0xe9, 0xfa, 0x70, 0xd1, 0xeb, 0x09, 0x76, 0xc2, 0x10, 0x09, 0x1c,
+                0xcc, 0xed, 0xa3, 0xbb, 0x9d, 0x47, 0x7e, 0xe4, 0x65, 0x19, 0x7b, 0x93, 0xe7, 0xf3, 0x49, 0xb0,
+                0x37, 0x0f, 0xe5, 0x6c, 0xf9, 0x09, 0xc8, 0x4e, 0xba, 0xf0, 0x01, 0xae, 0x3b, 0x4d, 0xb2, 0xbc,
+                0xcf, 0xf2, 0xe4, 0x23, 0x8f, 0xd5, 0xc9, 0x24, 0x41, 0x9e, 0x42, 0xbf, 0x37, 0xdc, 0x0b, 0x78,
+                0x9a, 0x01, 0x2d, 0x28, 0x1d, 0xf2, 0x97, 0x2b, 0xb1, 0xe0, 0x9f, 0xf5, 0x75, 0x76, 0x12, 0x25,
+                0x39, 0xbb, 0x0a, 0xe1, 0x7d, 0xca, 0x63, 0x6a, 0xed, 0xa5, 0x9c, 0xe5, 0xde, 0x64, 0xc2, 0x03,
+                0x76, 0x1d, 0xe6, 0x53, 0xe6, 0x31, 0x3f, 0x0a, 0x81, 0x5a, 0x76, 0xf8, 0x9a, 0x79, 0x71, 0x00,
+                0xc2, 0xeb, 0xa7, 0xdc, 0xcb, 0xc2, 0x78, 0x52, 0x0c, 0x11, 0xb8, 0xdd, 0x57, 0x61, 0x02, 0xc3,
+                0x58, 0xc6, 0xd3, 0x2b, 0xd0, 0xaf, 0x20, 0x4d, 0xe6, 0x19, 0xfb, 0xcf, 0x82, 0x2f, 0x00, 0x5c,
+                0x81, 0x21, 0x9f, 0x7a, 0x39, 0x9b, 0x00, 0xde, 0x6c, 0x31, 0x87, 0xdf, 0x3c, 0xe0, 0xc1, 0x40,
+                0xa7, 0x5e, 0x62, 0xdc, 0x65, 0xbf, 0x7a, 0xf9, 0x74, 0x90, 0x02, 0xda, 0x64, 0xe6, 0xc2, 0x4c,
+                0x24, 0x67, 0xa0, 0xc6, 0xf1, 0xc4, 0x7d, 0xfa, 0xbc, 0x37, 0xc8, 0x16, 0xa3, 0x4c, 0xfc, 0xda,
+                0xec, 0xb3, 0x8d, 0xa1, 0x32, 0x2c, 0x02, 0x51, 0xd1, 0x06, 0x60, 0x86, 0x3b, 0x4d, 0xee, 0xc0,
+                0x63, 0x07, 0x3f, 0xb7, 0xd7, 0xd7, 0x1d, 0xb6, 0xca, 0x90, 0x99, 0xb5, 0x56, 0xd7, 0xc8, 0x3a,
+                0xe7, 0x3a, 0xb3, 0xb7, 0xc0, 0xfe, 0x67, 0xbf, 0xfd, 0x0c, 0xcd, 0x2a, 0xb0, 0xab, 0xcc, 0x59,
+                0xcf, 0xae, 0x26, 0x8e, 0xa9, 0x69, 0xee, 0xe5, 0xbc, 0xd9, 0x18, 0x9f, 0x9a, 0x9a, 0xef, 0x47,
+                0xdc, 0x4b, 0x1b, 0xcd, 0x7d, 0x7c, 0x6a, 0x6a, 0x7e, 0xca, 0x67, 0xc9, 0x55, 0x13, 0x7c, 0x4a,
+                0x8f, 0x4d, 0x1d, 0x70, 0xee, 0xb3, 0x46, 0xfb, 0x39, 0x3e, 0x55, 0x9a, 0x87, 0x63, 0x30, 0x7f,
+                0x75, 0x19, 0x2b, 0xe1, 0x80, 0x6d, 0x3d, 0xc7, 0x97, 0x08, 0x26, 0x5d, 0xf0, 0x9d, 0x66, 0x8b,
+                0xbc, 0x78, 0x8d, 0x9f, 0x86, 0xf7, 0x8a, 0xa4, 0x0e, 0x32, 0x9e, 0xbb, 0xce, 0xbf, 0xd6, 0xde,
+                0x9c, 0x9f, 0x9f, 0xfc, 0xfc, 0x7a, 0xed, 0xfc, 0xf8, 0x9f, 0x07, 0x6f, 0x9d, 0xbe, 0x02, 0x46,
+                0x99, 0xe4, 0x4a, 0xf5, 0x78, 0x04, 0xf6, 0xbd, 0x9d, 0xb4, 0xb1, 0x07, 0x6d, 0x5a, 0x68, 0x73,
+                0x9c, 0x3a, 0x60, 0xf1, 0x37, 0xcc, 0xe3, 0x65, 0x08, 0x42, 0x7b, 0xe3, 0xd2, 0xdf, 0x7d, 0xd0,
+                0x88, 0x20, 0x9f, 0xf6, 0xd9, 0x94, 0x87, 0x93, 0x29, 0xe8, 0x9e, 0xaf, 0xf2, 0x84, 0x54, 0x93,
+                0x2d, 0xd2, 0xa8, 0x60, 0x29, 0xf6, 0x46, 0xc5, 0x6e, 0x74, 0xaa, 0x90, 0x41, 0x6b, 0x18, 0xb4,
+                0x97, 0xfa, 0xd3, 0x13, 0x2f, 0xf5, 0x66, 0x19, 0xda, 0x0a, 0xd0, 0x12, 0xd7, 0x21, 0x7c, 0x30,
+                0x76, 0xfa, 0xac, 0x04, 0xbf, 0xa7, 0xf4, 0x95, 0x96, 0x1f, 0x40, 0xec, 0xd4, 0x49, 0x0e, 0xdc,
+                0x30, 0xf8, 0x9a, 0xc4, 0x06, 0x48, 0x69, 0xd0, 0x89, 0x36, 0xb4, 0x35, 0x0f, 0xa3, 0xce, 0x36,
+                0xaa, 0x0e, 0x04, 0x0a, 0x7b, 0x52, 0x88, 0x92, 0xf8, 0xd5, 0xa5, 0x1f, 0x18, 0x11, 0xe8, 0xe4,
+                0xae, 0xae, 0xd6, 0x4c, 0x4a, 0xef, 0xbe, 0x33, 0x62, 0xe4, 0xac, 0x65, 0xc0, 0x68, 0xac, 0xdf,
+                0x9d, 0x1e, 0xb9, 0xaa, 0x85, 0xe9, 0xe9, 0xfa, 0x48, 0xa0, 0x7a, 0x9a, 0x3c, 0x5b, 0xc7, 0x40,
+                0x6d, 0x61, 0x14, 0xc2, 0x94, 0x26, 0x0b, 0x78, 0x26, 0xba, 0x9b, 0xc7, 0x80, 0xe0, 0x05, 0x89,
+                0x1d, 0xe1, 0x8b, 0xc6, 0x3a, 0x02, 0x09, 0xc0, 0x8e, 0x41, 0x53, 0xd0, 0x8e, 0x88, 0x48, 0x59,
+                0x6d, 0xe6, 0x00, 0x81, 0xfa, 0x1d, 0x01, 0xf9, 0x8e, 0x2e, 0x36, 0xe6, 0x69, 0x13, 0x76, 0x53,
+                0x55, 0xff, 0xce, 0x13, 0x26, 0x2c, 0xf1, 0x17, 0x55, 0xf3, 0x09, 0xcf, 0x2f, 0xdb, 0x29, 0x94,
+                0xfd, 0x4a, 0x8f, 0x96, 0xc8, 0xeb, 0xb3, 0xab, 0x24, 0x0c, 0xd8, 0xb0, 0xfa, 0x2c, 0xfc, 0xa5,
+                0x27, 0xcc, 0xad, 0x1b, 0x78, 0x31, 0x46, 0x70, 0x86, 0x60, 0x8c, 0xb7, 0x21, 0x8f, 0x02, 0x36,
+                0xe6, 0xe0, 0x7f, 0x89, 0x71, 0x1a, 0x90, 0x0f, 0xa6, 0x29, 0x1f, 0xf7, 0x6b, 0x40, 0xf0, 0xcf,
+                0x54, 0x98, 0xf7, 0xed, 0x86, 0xc1, 0xd7, 0x5a, 0xde, 0xf5, 0x74, 0x0b, 0x2d, 0x07, 0x00, 0xf8,
+                0x15, 0xe3, 0xdc, 0x33, 0x4d, 0x11, 0x1a, 0x86, 0x2f, 0x31, 0x39, 0x1d, 0xcd, 0x9a, 0x3a, 0x17,
+                0x75, 0x52, 0xbe, 0xd2, 0x2c, 0x10, 0xda, 0xaf, 0xce, 0x7f, 0x1c, 0x38, 0xb9, 0x0b, 0xee, 0x57,
+                0x1c, 0x72, 0xe9, 0xb9, 0xfc, 0xe5, 0x23, 0x15, 0xa8, 0x00, 0xed, 0xe0, 0xf7, 0x2c, 0x89, 0x55,
+                0x47, 0xd9, 0x32, 0xec, 0x4b, 0xf0, 0x82, 0x7d, 0xee, 0x2e, 0xe6, 0x5f, 0x66, 0xce, 0x2d, 0x02,
+                0x4c, 0x83, 0xaf, 0x8d, 0xc0, 0x2a, 0xc3, 0x44, 0x21, 0x88, 0x31, 0xd2, 0x68, 0xb6, 0x2f, 0x6d,
+                0x0c, 0x47, 0xb0, 0x5f, 0x44, 0xa8, 0xee, 0xc3, 0x6a, 0x72, 0x78, 0xbf, 0xb6, 0x84, 0x91, 0xef,
+                0xfd, 0xb5, 0x75, 0x89, 0x22, 0x81, 0xaf, 0x3d, 0x52, 0x0a, 0x4a, 0xbe, 0xd9, 0x04, 0x83, 0x74,
+                0x5f, 0x5e, 0xf3, 0x51, 0x96, 0xf8, 0x1f, 0xc1, 0xf7, 0x37, 0x0c, 0x1d, 0xc5, 0xff, 0x3d, 0x1f,
+                0x9d, 0x89, 0x06, 0x32, 0x2e, 0x2b, 0x41, 0xdc, 0x69, 0x61, 0xf2, 0x7e, 0x12, 0xc7, 0x5c, 0x44,
+                0xff, 0xad, 0xd1, 0x72, 0x9f, 0x79, 0x51, 0x94, 0x5c, 0xbf, 0x2f, 0xf0, 0x66, 0x8d, 0xf0, 0x79,
+                0x96, 0x04, 0xdc, 0x10, 0x37, 0xce, 0x3d, 0xf0, 0x59, 0x4e, 0x92, 0x28, 0x6a, 0xc6, 0x14, 0xf4,
+                0x3e, 0x08, 0x33, 0x5f, 0xd0, 0x00, 0xe1, 0x6e, 0x3d, 0x22, 0xa2, 0x16, 0x1e, 0x44, 0xf2, 0x32,
+                0x1e, 0x2f, 0x22, 0x7b, 0x2d, 0x8e, 0xaf, 0x37, 0xd7, 0xe9, 0x84, 0xae, 0xf5, 0x27, 0x3f, 0x36,
+                0x9e, 0x6c, 0xab, 0xa4, 0x09, 0x2e, 0x27, 0x60, 0x0c, 0x34, 0xe6, 0x96, 0x3e, 0x18, 0x0d, 0xf4,
+                0x31, 0x8c, 0xb4, 0x67, 0x98, 0xc5, 0x1a, 0x31, 0x20, 0x9e, 0x69, 0xee, 0x3e, 0xd5, 0xe6, 0xcf,
+                0x8f, 0x92, 0x8c, 0xb7, 0x80, 0xde, 0xbd, 0x0f, 0xe8, 0xa1, 0x06, 0x5a, 0x3c, 0x83, 0xbf, 0x40,
+                0x35, 0x7e, 0x05, 0x58, 0xad, 0x48, 0x94, 0x66, 0xad, 0xd8, 0xb2, 0xeb, 0x90, 0x52, 0x48, 0x66,
+                0xb0, 0x34, 0x22, 0x0f, 0xc2, 0xc9, 0x8d, 0xed, 0x86, 0x3a, 0xa0, 0x2c, 0x25, 0x11, 0x1f, 0x44,
+                0xc9, 0xc4, 0x5d, 0x39, 0x43, 0xda, 0xd8, 0xc9, 0xf1, 0xd1, 0xd1, 0x4a, 0x4d, 0xfe, 0x95, 0x1c,
+                0x06, 0x58, 0x90, 0xf7, 0x95, 0x68, 0xb7, 0x35, 0x43, 0x91, 0xb2, 0xb6, 0x98, 0xc3, 0xcb, 0x37,
+                0x5e, 0x1c, 0x44, 0x28, 0x91, 0x10, 0x21, 0x1f, 0xc6, 0x60, 0x08, 0xae, 0xbc, 0xc8, 0x05, 0xb6,
+                0xef, 0xbe, 0xac, 0xda, 0xb8, 0xbd, 0x7e, 0x43, 0x0f, 0x06, 0x87, 0x6f, 0xcf, 0x0f, 0x4e, 0x7f,
+                0xdb, 0x3b, 0xba, 0x44, 0x5a, 0x6d, 0x18, 0xa4, 0xb4, 0x57, 0x3c, 0x69, 0xb6, 0x1b, 0xa5, 0xdc,
+                0xfb, 0xb8, 0xd3, 0x64, 0xd4, 0x66, 0x27, 0x46, 0x9d, 0x1d, 0x1d, 0xbf, 0xff, 0xff, 0xc6, 0xac,
+                0x4b, 0x24, 0xfa, 0x0b, 0x70, 0xec, 0x69, 0x93, 0x63, 0x28, 0xcd, 0x8f, 0x4d, 0xfa, 0xde, 0x33,
+                0x98, 0xe5, 0x9a, 0xce, 0x6c, 0x18, 0x48, 0xb4, 0xa0, 0xd7, 0xd3, 0x26, 0x2d, 0xd3, 0xf5, 0xfe,
+                0xe0, 0xd5, 0xd9, 0xf1, 0xfe, 0x3f, 0x0f, 0xce, 0x57, 0x1e, 0x3e, 0x11, 0x1d, 0x67, 0x54, 0xbc,
+                0x2e, 0xc2, 0x7c, 0xb0, 0x8e, 0x83, 0xda, 0x8a, 0xd0, 0xda, 0x6f, 0x90, 0xc4, 0x33, 0x9e, 0x65,
+                0xde, 0x04, 0x27, 0xc3, 0xe5, 0x57, 0xd5, 0x1c, 0x27, 0xf1, 0xfb, 0xec, 0x57, 0xf1, 0x0a, 0x9e,
+                0x0f, 0x02, 0x2f, 0xf7, 0x96, 0x82, 0x42, 0x2b, 0x89, 0x70, 0x74, 0x28, 0xc7, 0x64, 0x3b, 0x97,
+                0xf5, 0x25, 0x3b, 0xd8, 0xec, 0xbc, 0x2f, 0xcc, 0xe3, 0xb2, 0xde, 0x3c, 0x4d, 0x29, 0x67, 0x2c,
+                0x7a, 0xab, 0x33, 0xe2, 0x94, 0x2c, 0x64, 0xd4, 0xc8, 0xf9, 0x0c, 0x89, 0x54, 0x84, 0xbf, 0xbb,
+                0xb8, 0x0e, 0xb7, 0xbf, 0xb0, 0xc6, 0x3e, 0x4c, 0x95, 0x02, 0x3e, 0xf6, 0x16, 0x51, 0xbe, 0xbd,
+                0xac, 0xed, 0x9d, 0xb6, 0x56, 0x95, 0xb4, 0x98, 0x96, 0x92, 0xca, 0x74, 0x34, 0x96, 0x04, 0xec,
+                0x58, 0x5a, 0x92, 0x7a, 0xe3, 0x16, 0x64, 0xef, 0x8d, 0x9e, 0x4d, 0x89, 0x51, 0xbc, 0x33, 0xe6,
+                0x55, 0x2d, 0x82, 0xf5, 0x27, 0xbb, 0xdb, 0xb1, 0x36, 0xf6, 0xeb, 0xc2, 0xa6, 0xd2, 0x33, 0xb7,
+                0x8f, 0xbb, 0x70, 0x6a, 0x3a, 0xac, 0xd3, 0xa8, 0xa0, 0x8a, 0xa7, 0x2a, 0xf6, 0x46, 0x5c, 0x8c,
+                0x42, 0x73, 0x4e, 0x8e, 0xa4, 0xa0, 0xd2, 0x40, 0x22, 0xcf, 0x5f, 0x2b, 0xce, 0x91, 0x4b, 0x2e,
+                0x4a, 0x4d, 0x24, 0xea, 0x8b, 0xfa, 0x2e, 0xdb, 0xec, 0x3d, 0x6a, 0x31, 0x7d, 0x4f, 0x6d, 0xfd,
+                0x2d, 0x23, 0x32, 0x8d, 0xaa, 0x12, 0xd4, 0x29, 0xf7, 0x3f, 0xd2, 0x10, 0xb4, 0xe1, 0xa8, 0x7e,
+                0xeb, 0x80, 0xb6, 0x9f, 0x5c, 0xd7, 0x34, 0xc8, 0x42, 0x67, 0xaf, 0xbd, 0x34, 0x76, 0xeb, 0x03,
+                0x33, 0x72, 0x00, 0x9d, 0x43, 0xab, 0x5b, 0xac, 0x9a, 0x2f, 0x69, 0xe1, 0xea, 0x73, 0x27, 0x1f,
+                0x0b, 0x5e, 0x64, 0xef, 0xc3, 0x7c, 0xea, 0x3a, 0x7f, 0x3a, 0x3d, 0x9b, 0xff, 0x5f, 0x0e, 0x09,
+                0x64, 0xe9, 0x97, 0xb3, 0xe3, 0xb7, 0xc0, 0xa4, 0x34, 0xab, 0x80, 0x3f, 0x88, 0x23, 0x6d, 0x29,
+                0x78, 0x6d, 0x59, 0x79, 0x17, 0x7f, 0x8c, 0x93, 0xeb, 0x98, 0xbd, 0x3f, 0x63, 0x12, 0xe1, 0x36,
+                0x5b, 0x61, 0xab, 0xac, 0x89, 0xfd, 0xae, 0xc6, 0x84, 0xfd, 0x86, 0x7f, 0x69, 0xb1, 0x8e, 0x24,
+                0xfc, 0x81, 0x53, 0x77, 0xa0, 0x5b, 0xb8, 0x5e, 0x21, 0x39, 0xae, 0xbb, 0xc7, 0x16, 0x1c, 0xb8,
+                0x40, 0x74, 0xc0, 0xa1, 0xca, 0xb6, 0x74, 0x65, 0x6b, 0x2d, 0xd4, 0x38, 0x41, 0xc5, 0x4b, 0x9b,
+                0xd3, 0x9e, 0x21, 0x55, 0xaa, 0x05, 0x16, 0xe0, 0xae, 0xdb, 0x00, 0xd8, 0x22, 0x11, 0xf5, 0xa7,
+                0x45, 0x69, 0xda, 0x40, 0xd6, 0x14, 0x6f, 0xb3, 0x26, 0x2e, 0xba, 0x53, 0x61, 0x10, 0x86, 0x25,
+                0x8a, 0xab, 0xf7, 0x77, 0x2f, 0xbd, 0xc2, 0x1f, 0xf0, 0x4b, 0xdf, 0x6c, 0x7f, 0xea, 0xc5, 0x13,
+                0x24, 0x0c, 0xcd, 0x42, 0xbc, 0x80, 0x08, 0xec, 0xd3, 0x27, 0x86, 0x0d, 0xe1, 0xa7, 0x88, 0x82,
+                0x71, 0x23, 0x5d, 0x7c, 0xd9, 0x86, 0x17, 0xa0, 0xab, 0x51, 0x24, 0xa3, 0x65, 0x6d, 0x64, 0x16,
+                0x6b, 0x6d, 0x96, 0xf5, 0x25, 0x53, 0x23, 0x9d, 0x36, 0x88, 0x40, 0x73, 0xd9, 0xfe, 0xd3, 0x27,
+                0x7d, 0x28, 0xfa, 0xfb, 0x81, 0x07, 0x63, 0xb9, 0xc2, 0x78, 0x6b, 0x57, 0xd5, 0x48, 0xf9, 0x78,
+                0x69, 0xef, 0x69, 0x16, 0xfe, 0xd1, 0xec, 0x4c, 0x4f, 0x97, 0xf6, 0xc5, 0xfc, 0x4f, 0xa3, 0x2b,
+                0x25, 0xae, 0x8c, 0xe2, 0x53, 0x76, 0x64, 0x5a, 0x8f, 0x1d, 0xdb, 0x44, 0x29, 0x6d, 0x3e, 0x67,
+                0xa6, 0xda, 0xec, 0x0c, 0x06, 0xfb, 0xed, 0x1e, 0x3b, 0x10, 0xf3, 0x6c, 0x08, 0x21, 0x7b, 0x07,
+                0xbf, 0x5e, 0x34, 0x1d, 0xea, 0xbb, 0xec, 0x6f, 0xbd, 0xab, 0x70, 0x42, 0xbb, 0xf7, 0xcd, 0xec,
+                0x41, 0x23, 0x43, 0x40, 0x29, 0x6f, 0x00, 0xb3, 0xb6, 0x51, 0xdf, 0x35, 0xc6, 0xcd, 0x15, 0xd3,
+                0x9e, 0x33, 0xed, 0x89, 0x18, 0x5e, 0x20, 0xaf, 0x2f, 0x43, 0xd4, 0xd2, 0x95, 0x15, 0xd3, 0x2b,
+                0x1b, 0x40, 0x7a, 0x59, 0x87, 0x2a, 0xb3, 0x2a, 0x62, 0x24, 0xdc, 0x4d, 0xc6, 0xe3, 0x4c, 0xf7,
+                0x30, 0xaa, 0x58, 0x83, 0x7c, 0xe2, 0xe5, 0x4b, 0x7e, 0x31, 0x50, 0xb7, 0xec, 0x34, 0xa0, 0xe4,
+                0xe7, 0x20, 0xe2, 0xf1, 0x04, 0x08, 0x5b, 0x55, 0x9b, 0xad, 0xb2, 0x02, 0xe3, 0xdf, 0x98, 0xb9,
+                0xbd, 0x4a, 0xe6, 0xef, 0x8b, 0xd9, 0xbc, 0xb9, 0x71, 0xf1, 0x05, 0x28, 0x94, 0x38, 0xba, 0xd2,
+                0xd4, 0x4c, 0xe3, 0xdf, 0x87, 0xa6, 0x31, 0x08, 0x90, 0x1b, 0xc1, 0x72, 0x11, 0xd2, 0xb4, 0xc0,
+                0xc7, 0x3f, 0x6c, 0x78, 0x59, 0xb8, 0xba, 0x5a, 0xd7, 0x3f, 0x44, 0x85, 0xd2, 0xb0, 0xbb, 0x5b,
+                0xef, 0xf5, 0x21, 0xbc, 0x18, 0x84, 0x76, 0xdb, 0x5c, 0xb0, 0x21, 0xec, 0xe4, 0x40, 0xdf, 0x19,
+                0xed, 0x60, 0xca, 0xd1, 0x9a, 0xe8, 0x5b, 0x95, 0x0d, 0xd1, 0x2f, 0x04, 0x92, 0x3e, 0x6d, 0x52,
+                0x2e, 0xbe, 0xe8, 0xa9, 0xbe, 0x9b, 0xdc, 0x05, 0x07, 0xb2, 0xb6, 0xf5, 0xa9, 0xb3, 0x16, 0x8d,
+                0x85, 0x65, 0x1a, 0x6d, 0xa9, 0x24, 0xe6, 0x0c, 0xa8, 0x68, 0x61, 0x2d, 0x86, 0x40, 0x6a, 0xa0,
+                0x97, 0x5e, 0x90, 0x95, 0xd6, 0xb4, 0xec, 0xb1, 0x81, 0xaf, 0x15, 0xfb, 0x04, 0x83, 0xeb, 0xb6,
+                0x94, 0x76, 0x36, 0xbd, 0x51, 0xe6, 0xd6, 0x95, 0x72, 0x4d, 0x61, 0x48, 0x8f, 0xbd, 0x64, 0xc3,
+                0xc1, 0x46, 0xa7, 0xde, 0x92, 0x4b, 0x6b, 0x2a, 0xcf, 0x8a, 0xfe, 0xc6, 0x21, 0xa2, 0xdf, 0x5d,
+                0xee, 0x9e, 0xb7, 0x93, 0xdf, 0x57, 0x68, 0xea, 0xab, 0x08, 0x90, 0xef, 0x94, 0xcd, 0x6f, 0xee,
+                0x67, 0x41, 0xdf, 0x71, 0x18, 0x17, 0xae, 0x81, 0x98, 0xae, 0xc5, 0x3c, 0x40, 0x0b, 0x42, 0xf2,
+                0x5e, 0x97, 0x00, 0x9a, 0x29, 0xf0, 0x2a, 0xe0, 0xc3, 0xa2, 0x8b, 0xcd, 0xe9, 0x5b, 0x63, 0x1b,
+                0x2a, 0x78, 0x50, 0xb1, 0xbf, 0x56, 0x0a, 0x6a, 0x83, 0x50, 0xde, 0xb4, 0xf3, 0x4b, 0x23, 0x0a,
+                0x1f, 0x9e, 0xe5, 0xa9, 0x7b, 0x3f, 0xdd, 0x67, 0xce, 0x70, 0x7d, 0xe8, 0x34, 0xf0, 0xd2, 0xc4,
+                0xcf, 0xbc, 0x1b, 0x77, 0xd8, 0xd7, 0x6d, 0x24, 0x08, 0x09, 0x56, 0xda, 0x38, 0x85, 0xed, 0xb4,
+                0x1a, 0xa4, 0x5a, 0x7a, 0xdb, 0x8b, 0xaf, 0xbc, 0xec, 0x94, 0xaa, 0xa8, 0x78, 0xb1, 0x48, 0x61,
+                0x24, 0x16, 0xfa, 0x2c, 0x9d, 0x8c, 0x3c, 0xd7, 0x4f, 0x22, 0x43, 0x06, 0xdd, 0xa1, 0x77, 0x88,
+                0x0c, 0x1b, 0xb0, 0x1f, 0xd8, 0xe6, 0xb3, 0x67, 0x44, 0x40, 0x9f, 0x9e, 0xd1, 0xc3, 0x97, 0x2f,
+                0x5f, 0xb2, 0x17, 0x3d, 0xfb, 0xbb, 0x8d, 0xe7, 0x86, 0x97, 0xe5, 0xdb, 0xcd, 0xad, 0xf2, 0xed,
+                0x7a, 0xd9, 0xa8, 0xe7, 0xd4, 0x92, 0xb9, 0x44, 0x26, 0x11, 0xef, 0x8e, 0x16, 0xe3, 0x31, 0x4f,
+                0xfb, 0x6c, 0x1e, 0xde, 0xf0, 0xe8, 0x14, 0x4b, 0x2a, 0xbe, 0xc4, 0xa6, 0x07, 0x95, 0xb5, 0x89,
+                0x64, 0xfb, 0x6b, 0xe0, 0xf0, 0x6f, 0xa8, 0x3b, 0x02, 0xb3, 0x71, 0xfb, 0x6b, 0xe6, 0x4d, 0x80,
+                0xc2, 0x5d, 0x26, 0xf6, 0xc8, 0x06, 0xe3, 0x34, 0x99, 0x81, 0x2f, 0x93, 0xee, 0x43, 0x30, 0xea,
+                0x22, 0x28, 0x0c, 0x7c, 0xdf, 0x85, 0x71, 0xfe, 0xc2, 0x1d, 0xf6, 0xfa, 0x4c, 0x7f, 0xb2, 0xd1,
+                0x78, 0xb2, 0xd9, 0x78, 0xf2, 0xb4, 0x67, 0x88, 0x57, 0x05, 0x52, 0x34, 0x4a, 0xce, 0x9b, 0x9f,
+                0x5f, 0xbf, 0x72, 0x50, 0xf2, 0xd5, 0x6e, 0x4f, 0x37, 0xdd, 0xad, 0x3e, 0x6d, 0x24, 0xf4, 0xa8,
+                0xd5, 0x86, 0xd9, 0xfc, 0xa7, 0xc9, 0x35, 0x8d, 0xf3, 0x00, 0x73, 0x44, 0xae, 0xf3, 0x2e, 0xce,
+                0x16, 0xf3, 0x79, 0x92, 0xa2, 0xf3, 0x8f, 0x72, 0x85, 0x6b, 0xd2, 0xcc, 0xcb, 0x07, 0x4e, 0xab,
+                0xe3, 0x2d, 0xd8, 0x30, 0x87, 0x80, 0xec, 0xbd, 0xb4, 0xf0, 0x05, 0x25, 0x3f, 0x45, 0x89, 0x87,
+                0xa4, 0xbc, 0x90, 0xa4, 0xec, 0x58, 0xfa, 0xbd, 0x29, 0xac, 0x7f, 0xbd, 0xe3, 0xc6, 0x66, 0x4b,
+                0x4f, 0x6c, 0x6c, 0xc3, 0xb8, 0xf1, 0x7c, 0x49, 0x47, 0x2b, 0xca, 0xcd, 0xe1, 0x12, 0x62, 0x7f,
+                0x0a, 0x69, 0x1f, 0xa7, 0xc6, 0xed, 0xcd, 0xad, 0x96, 0x6e, 0xf1, 0x7e, 0x14, 0xce, 0x33, 0x43,
+                0xa7, 0x36, 0xc6, 0xc4, 0x67, 0xf9, 0x6d, 0xc4, 0x0d, 0xbd, 0x9e, 0x6e, 0xb6, 0xa2, 0x02, 0xb7,
+                0xd8, 0xd4, 0xe9, 0x79, 0x6b, 0xa7, 0x24, 0x49, 0x03, 0x43, 0xaf, 0xad, 0x36, 0x66, 0xc4, 0x87,
+                0x71, 0x6e, 0xea, 0xb3, 0xd5, 0x3e, 0x28, 0xd4, 0x12, 0x53, 0x37, 0x33, 0x2f, 0xd0, 0x21, 0x12,
+                0xbe, 0x21, 0xfa, 0xde, 0x9b, 0x26, 0x98, 0x3e, 0x32, 0x77, 0x0f, 0xdf, 0x8b, 0x86, 0x7a, 0x1b,
+                0xd9, 0x79, 0x75, 0xb7, 0x98, 0x85, 0x27, 0x60, 0x95, 0x4c, 0x60, 0x32, 0x62, 0x77, 0x17, 0x38,
+                0x72, 0x62, 0x9e, 0xb0, 0xcd, 0xa1, 0x91, 0x1e, 0x9c, 0x81, 0x4e, 0xf4, 0xd0, 0x54, 0x3d, 0x31,
+                0x9a, 0xe9, 0xc1, 0xfe, 0x1e, 0xc6, 0x1c, 0x87, 0xff, 0x3e, 0x30, 0xa2, 0x28, 0xe6, 0x0b, 0x95,
+                0x57, 0x4a, 0xee, 0x5e, 0x9a, 0x7a, 0xb7, 0xa5, 0x89, 0x14, 0x68, 0xfa, 0xc5, 0xd4, 0xf6, 0xec,
+                0x44, 0x08, 0x50, 0x4f, 0xd8, 0x96, 0x09, 0x51, 0x28, 0xa6, 0x18, 0xd1, 0x1c, 0xc6, 0x76, 0x24,
+                0x28, 0x09, 0x76, 0x14, 0x24, 0x27, 0x16, 0x04, 0x59, 0x29, 0x0f, 0x54, 0xb0, 0x80, 0x16, 0xcf,
+                0x82, 0x43, 0x4a, 0x8e, 0x51, 0xac, 0x02, 0xee, 0x83, 0xb9, 0x4d, 0x25, 0x94, 0x73, 0xf0, 0x18,
+                0x5f, 0x8b, 0x27, 0x6e, 0xcf, 0x82, 0x14, 0xfd, 0xfe, 0x90, 0x12, 0x72, 0xb2, 0xef, 0x40, 0x7c,
+                0xba, 0x92, 0x20, 0xac, 0x13, 0xf6, 0x88, 0x10, 0x64, 0x01, 0xb8, 0xd0, 0x7d, 0x26, 0xbf, 0x50,
+                0x5c, 0x80, 0xdf, 0x70, 0x45, 0xbe, 0x30, 0x97, 0x44, 0x84, 0x60, 0x9f, 0x79, 0x31, 0xa8, 0x5f,
+                0xbd, 0xb9, 0x99, 0x0c, 0x98, 0xb7, 0x00, 0xeb, 0xa1, 0x77, 0xd9, 0x87, 0x0b, 0xfd, 0xbd, 0x29,
+                0x16, 0x10, 0xe2, 0x62, 0xf4, 0xfd, 0x2b, 0x90, 0x1e, 0x8a, 0x5d, 0x21, 0x80, 0x40, 0xe8, 0x3d,
+                0xa5, 0xab, 0x58, 0x5e, 0xf4, 0x15, 0xc8, 0xcb, 0x45, 0x54, 0x6e, 0x84, 0x74, 0xba, 0x77, 0x06,
+                0x51, 0xb2, 0x6d, 0xc7, 0xa9, 0x60, 0xc7, 0xa4, 0x10, 0x22, 0x64, 0x8c, 0x6b, 0xd9, 0x7b, 0x82,
+                0x66, 0x83, 0x2c, 0xc5, 0xb5, 0xd4, 0x41, 0xd7, 0x66, 0x9b, 0xb8, 0xb8, 0x3e, 0x8f, 0x27, 0x3b,
+                0x23, 0x2f, 0xe3, 0xcf, 0xb7, 0xc8, 0x7f, 0x80, 0xf9, 0x71, 0x6b, 0xa6, 0xc3, 0xc3, 0xa1, 0x96,
+                0x76, 0xdb, 0x0a, 0x1c, 0xa7, 0x84, 0x4a, 0x85, 0x21, 0x94, 0x00, 0x54, 0x96, 0x76, 0x72, 0x52,
+                0x06, 0xf3, 0x45, 0x36, 0x75, 0x91, 0x22, 0x29, 0x17, 0x65, 0x1a, 0x97, 0x84, 0xa6, 0xf4, 0x1a,
+                0x4d, 0xe8, 0xee, 0x5a, 0x16, 0x4b, 0x51, 0xe0, 0x20, 0xcf, 0x59, 0xe0, 0xbe, 0x9d, 0x2b, 0x11,
+                0xf6, 0xcc, 0xa6, 0x04, 0x79, 0x8d, 0x7e, 0x71, 0xe2, 0x53, 0xed, 0xff, 0x00, 0x8b, 0xe8, 0x73,
+                0x7e, 0x10, 0x71, 0xfc, 0xe5, 0x3a, 0xa2, 0x41, 0x7d, 0x7d, 0x16, 0x4f, 0xcb, 0x80, 0xab, 0x74,
+                0x28, 0x37, 0xb4, 0x6a, 0xcb, 0x6a, 0xfd, 0x7c, 0xa2, 0x7a, 0x54, 0x66, 0x58, 0x65, 0x80, 0xd6,
+                0x02, 0x4c, 0xae, 0xa9, 0xad, 0xd0, 0xc4, 0xb0, 0xf2, 0x1b, 0x12, 0x53, 0x82, 0x0c, 0xf3, 0xb8,
+                0x9f, 0xc4, 0x39, 0x46, 0x79, 0xce, 0x66, 0xe0, 0x18, 0x9c, 0x9d, 0xc7, 0xd0, 0xde, 0x96, 0x92,
+                0x97, 0x50, 0x6a, 0x58, 0xf2, 0x9b, 0x41, 0x06, 0x5a, 0xc0, 0x5d, 0x8d, 0x13, 0xeb, 0x95, 0x93,
+                0xd2, 0xaf, 0x8d, 0x6b, 0x5d, 0xf1, 0x43, 0x7a, 0x4d, 0x60, 0x78, 0x86, 0x83, 0xac, 0x3e, 0xb3,
+                0x68, 0x01, 0xf9, 0xca, 0xa5, 0x77, 0xf0, 0x89, 0x0d, 0x6f, 0x7e, 0xfa, 0x69, 0x48, 0x7f, 0x2c,
+                0xd0, 0x4e, 0xf1, 0x10, 0x0a, 0x88, 0x2c, 0xfc, 0xa7, 0x10, 0x65, 0x27, 0xa2, 0xb0, 0x5b, 0xc9,
+                0x47, 0xda, 0xd5, 0xa1, 0xc5, 0xca, 0xb0, 0x9f, 0x50, 0xb3, 0x04, 0xe5, 0x9a, 0xb6, 0x2a, 0xbe,
+                0x1a, 0xd6, 0x2c, 0x75, 0x51, 0x31, 0xf8, 0x35, 0x5e, 0x6e, 0x5c, 0x96, 0x15, 0x23, 0x96, 0xdf,
+                0x2a, 0xbd, 0x0e, 0x2b, 0x85, 0x7c, 0x61, 0xed, 0x48, 0xd1, 0xb5, 0x29, 0x0a, 0x40, 0x23, 0x33,
+                0x44, 0x57, 0x96, 0x80, 0xee, 0x62, 0x96, 0xac, 0x67, 0x54, 0x52, 0xd3, 0x76, 0x8c, 0x42, 0xd2,
+                0x75, 0x60, 0x70, 0xec, 0x88, 0xa8, 0x2d, 0xfb, 0x68, 0x50, 0x66, 0x88, 0xbf, 0xcb, 0x27, 0x1a,
+                0x03, 0x26, 0x33, 0x84, 0x08, 0x6c, 0x42, 0xe1, 0x93, 0x22, 0x19, 0xeb, 0xec, 0x7f, 0x9f, 0x03,
+                0xd3, 0xff, 0xbe, 0x69, 0x6f, 0xbe, 0xef, 0xcd, 0x6d, 0xc8, 0x8e, 0x0e, 0xdf, 0x1e, 0x5c, 0xee,
+                0xef, 0x9d, 0x9c, 0x7d, 0xa8, 0x1b, 0x64, 0x5c, 0x7b, 0x36, 0x7b, 0x17, 0xc8, 0x2b, 0x87, 0x14,
+                0xd0, 0xb1, 0x23, 0xf8, 0x25, 0x09, 0xe3, 0x56, 0x0c, 0xbf, 0x1c, 0x1f, 0xbe, 0x35, 0xa3, 0x78,
+                0xda, 0x01, 0xc5, 0x0c, 0x63, 0xad, 0xa3, 0x10, 0x3e, 0x6c, 0x4c, 0xb7, 0x38, 0xe3, 0xca, 0xf2,
+                0xed, 0x65, 0x53, 0xc3, 0x2a, 0xa8, 0xad, 0x84, 0x28, 0x9b, 0x20, 0x16, 0x7d, 0xf6, 0x51, 0x2c,
+                0x89, 0x1f, 0x61, 0x49, 0x7c, 0x81, 0x07, 0xf0, 0x5c, 0x8c, 0x4d, 0x37, 0x9e, 0xf5, 0xe0, 0xd1,
+                0xea, 0x6a, 0x9f, 0xa1, 0x50, 0xed, 0xb2, 0x2d, 0xdb, 0x82, 0x84, 0xa8, 0x84, 0x6d, 0x77, 0x71,
+                0x7e, 0x20, 0x44, 0x65, 0x3f, 0xd2, 0x4c, 0x6d, 0x63, 0x8c, 0xf4, 0xa4, 0x84, 0xd6, 0xeb, 0x54,
+                0x03, 0x81, 0x32, 0xc3, 0xf3, 0x23, 0x60, 0xf2, 0x6b, 0x80, 0xeb, 0x22, 0xf0, 0x56, 0xd1, 0xaa,
+                0xaf, 0x7c, 0x77, 0x26, 0x2d, 0x1f, 0x8b, 0x00, 0x03, 0xa5, 0xac, 0xcf, 0xd2, 0x85, 0x55, 0xcf,
+                0xdb, 0xd5, 0xe8, 0x9e, 0x8a, 0xd3, 0xd9, 0xc8, 0xd9, 0x65, 0x1f, 0xfb, 0xbb, 0x44, 0x6f, 0x87,
+                0x41, 0xce, 0x93, 0xe8, 0x16, 0x85, 0x93, 0x06, 0x0a, 0x46, 0xd0, 0xdf, 0xb0, 0x59, 0x33, 0x14,
+                0xb1, 0xe4, 0x8a, 0x9f, 0x27, 0xae, 0xf0, 0x7a, 0x3f, 0xf8, 0x43, 0x70, 0xc6, 0xca, 0xef, 0xc2,
+                0x0b, 0x6b, 0x11, 0x1c, 0xf4, 0x27, 0xa8, 0xd9, 0xe6, 0x0e, 0x7c, 0xff, 0x07, 0x60, 0xc2, 0xcf,
+                0x55, 0xdc, 0x25, 0xb6, 0x39, 0x2d, 0x52, 0x71, 0x14, 0x94, 0x0a, 0x46, 0x1b, 0xc2, 0xbb, 0xb6,
+                0x41, 0x13, 0x21, 0x10, 0x7e, 0xd4, 0x32, 0xff, 0xdf, 0xda, 0xd7, 0x93, 0x41, 0x19, 0xac, 0xbd,
+                0x58, 0x22, 0x88, 0x50, 0x1e, 0x06, 0x21, 0xbf, 0x9d, 0xf3, 0xda, 0xda, 0x41, 0x6e, 0xa3, 0xad,
+                0xfd, 0x38, 0xf2, 0x1a, 0x31, 0x60, 0x61, 0x73, 0xac, 0x9d, 0x90, 0x7f, 0x87, 0x81, 0x69, 0x89,
+                0x6a, 0x37, 0xec, 0x55, 0x74, 0x67, 0xe9, 0xfb, 0x62, 0x49, 0x5f, 0xcb, 0xc2, 0x48, 0x36, 0x78,
+                0x59, 0xd7, 0xa1, 0xad, 0xe7, 0x32, 0x9b, 0xe8, 0x6f, 0x60, 0x4e, 0x1e, 0x5b, 0x96, 0xf2, 0x80,
+                0x1b, 0x60, 0x3a, 0x28, 0x9a, 0x39, 0x05, 0x18, 0x9e, 0x06, 0x16, 0x01, 0x9d, 0x0d, 0x6c, 0x68,
+                0x23, 0xc8, 0x92, 0xf7, 0x50, 0x7a, 0xde, 0x83, 0xa0, 0x12, 0x18, 0x12, 0x84, 0xe1, 0x9f, 0xd9,
+                0x09, 0x90, 0x33, 0x8a, 0x09, 0x2a, 0xfc, 0x6a, 0xd3, 0xc7, 0xa2, 0x29, 0x7b, 0x69, 0xb5, 0x6b,
+                0x85, 0xda, 0xa6, 0x3c, 0xcb, 0x93, 0xd4, 0x1a, 0x61, 0x90, 0x25, 0xf6, 0xae, 0xec, 0xef, 0xa5,
+                0xd7, 0xcd, 0x76, 0xcb, 0xac, 0xc2, 0x6a, 0x21, 0x77, 0xcd, 0xbc, 0x81, 0x0a, 0x75, 0xc4, 0x27,
+                0x61, 0x7c, 0x02, 0xfe, 0x70, 0x1b, 0xea, 0x14, 0x9d, 0xbe, 0xfa, 0x12, 0xe9, 0x7b, 0x92, 0x57,
+                0x7d, 0xd6, 0x7c, 0xa5, 0x48, 0xb6, 0xe5, 0xf5, 0x8b, 0xf6, 0xd7, 0xa5, 0x84, 0xb6, 0x90, 0x85,
+                0x03, 0xb4, 0x92, 0x2d, 0x8c, 0x96, 0xe0, 0x41, 0xd7, 0x35, 0xb1, 0x95, 0x19, 0x65, 0x29, 0x2d,
+                0xd8, 0x0c, 0xab, 0x05, 0xc6, 0x12, 0x32, 0xb3, 0x29, 0x3a, 0x3c, 0xdd, 0x3f, 0x3a, 0xd8, 0x6e,
+                0x15, 0x02, 0x2f, 0xf5, 0x5b, 0xd6, 0x0a, 0xfd, 0xf7, 0xe6, 0x05, 0xf9, 0xe0, 0x9b, 0x30, 0xbd,
+                0x14, 0xcd, 0x9c, 0x1c, 0x5a, 0x18, 0x41, 0xa6, 0x1a, 0x57, 0x38, 0xf3, 0x02, 0x58, 0x1d, 0xe8,
+                0xa6, 0x75, 0x5e, 0xf8, 0xe7, 0xf6, 0x66, 0x96, 0x32, 0xcb, 0xf6, 0xb1, 0xa3, 0xb3, 0xb6, 0x7d,
+                0xcf, 0x3e, 0x27, 0xc7, 0x47, 0xff, 0x67, 0xef, 0x27, 0x2b, 0xbc, 0x68, 0x25, 0x2e, 0x96, 0xe1,
+                0x6f, 0x33, 0xb6, 0xd3, 0x83, 0xfd, 0xf3, 0xed, 0x25, 0xaa, 0x0d, 0xca, 0x73, 0x9f, 0x69, 0x55,
+                0x7f, 0x3f, 0xbd, 0xf8, 0x7e, 0xa7, 0x15, 0xa7, 0xe8, 0xe7, 0xe3, 0xb7, 0x7f, 0xc5, 0x0c, 0x09,
+                0x6d, 0x4e, 0x32, 0xde, 0x66, 0x89, 0xbe, 0x87, 0x21, 0xef, 0x9d, 0xbf, 0xb1, 0x8f, 0xb7, 0xf4,
+                0x88, 0xd0, 0xd5, 0x0f, 0x71, 0xcc, 0xe4, 0xc2, 0x09, 0x9f, 0x3f, 0xdc, 0x20, 0x47, 0xdf, 0x66,
+                0x39, 0x9a, 0x3c, 0xc3, 0xee, 0x32, 0x65, 0xf7, 0xf1, 0x02, 0x03, 0xe0, 0x96, 0xc1, 0xdc, 0x8b,
+                0x87, 0xd4, 0x18, 0x1d, 0x49, 0x05, 0xb6, 0xbd, 0xf5, 0xdd, 0xd2, 0xb9, 0xe8, 0x33, 0x57, 0xf8,
+                0x45, 0x3f, 0x60, 0x28, 0xf2, 0x23, 0x73, 0xe2, 0x24, 0xfe, 0x83, 0xa7, 0x89, 0x03, 0x8b, 0xa8,
+                0xc3, 0xaf, 0x78, 0x9c, 0x04, 0x81, 0xf3, 0x8d, 0x26, 0xec, 0xfc, 0xe0, 0x5f, 0xe7, 0xdb, 0x2d,
+                0x2c, 0x7f, 0x48, 0x2c, 0xd2, 0x81, 0xa0, 0x6a, 0x4d, 0x9e, 0x7a, 0xc1, 0xef, 0x28, 0x05, 0x9a,
+                0x4e, 0x2f, 0xeb, 0x54, 0x24, 0xc0, 0xd4, 0x5e, 0xcf, 0x2e, 0xda, 0xd5, 0xa7, 0xcd, 0x3d, 0x28,
+                0xda, 0xe4, 0xa9, 0x17, 0x67, 0x11, 0x6e, 0x73, 0xdf, 0x2b, 0x24, 0xd1, 0xac, 0x59, 0x42, 0x55,
+                0x63, 0x6b, 0xba, 0xd1, 0xaa, 0x56, 0x21, 0xb6, 0xce, 0x36, 0x5e, 0x0c, 0x97, 0xd1, 0x01, 0xde,
+                0xd6, 0x5e, 0x14, 0x4e, 0x30, 0xbc, 0x17, 0x0c, 0x42, 0x6e, 0x0f, 0x9e, 0xa1, 0xf0, 0xf8, 0x1c,
+                0x0b, 0x8f, 0x51, 0x76, 0xdc, 0xf2, 0x15, 0xc6, 0xba, 0x4e, 0x4a, 0xe7, 0xae, 0x51, 0xa6, 0x22,
+                0x3e, 0xce, 0x9d, 0x25, 0x28, 0xc6, 0x09, 0x5d, 0xa8, 0xe1, 0xd6, 0x44, 0x33, 0xcc, 0xbd, 0x28,
+                0xf4, 0x19, 0x81, 0x71, 0x7a, 0x65, 0x4a, 0x7c, 0x88, 0xd9, 0x71, 0x87, 0x61, 0x9e, 0x56, 0x1d,
+                0xd8, 0x16, 0x3d, 0x9e, 0xdf, 0xb0, 0x22, 0x81, 0x1b, 0xd2, 0xfc, 0x2d, 0x43, 0xfd, 0x19, 0xf1,
+                0xa8, 0x2a, 0x97, 0x42, 0x0a, 0x5e, 0x82, 0x18, 0x2e, 0xb1, 0x19, 0x05, 0x52, 0xdc, 0x3f, 0x70,
+                0x4b, 0x32, 0x71, 0x8f, 0x56, 0x24, 0xea, 0x44, 0xbd, 0xc6, 0x43, 0x54, 0xdc, 0x52, 0xdb, 0xd8,
+                0x1d, 0xf9, 0x83, 0xb0, 0x76, 0x70, 0x88, 0x97, 0xe8, 0xdf, 0xdd, 0x7d, 0x57, 0x71, 0xda, 0x0c,
+                0x68, 0x33, 0x14, 0xea, 0x86, 0x80, 0x4c, 0xc9, 0x4f, 0x30, 0x25, 0xbf, 0x64, 0x0e, 0x1f, 0x63,
+                0xc2, 0xfe, 0xb3, 0xac, 0xc8, 0xb7, 0x55, 0xed, 0xad, 0xfb, 0xaa, 0x36, 0xf1, 0xe6, 0x6c, 0x96,
+                0x24, 0xf9, 0x34, 0x8c, 0x27, 0x07, 0xb1, 0x37, 0x8a, 0xa8, 0x22, 0x57, 0xd5, 0x43, 0x8c, 0x9b,
+                0x86, 0xed, 0x60, 0x82, 0xd4, 0xbb, 0x16, 0x7b, 0x2e, 0xc0, 0xc0, 0x42, 0x8e, 0x1f, 0xec, 0x28,
+                0x7d, 0x09, 0x81, 0x6a, 0xdb, 0x2c, 0x59, 0x12, 0xf8, 0xb5, 0x90, 0x63, 0xd9, 0x1c, 0xb8, 0x53,
+                0x4e, 0x80, 0xb6, 0x84, 0x17, 0xc0, 0xe7, 0x8d, 0x9d, 0x47, 0x56, 0x1f, 0x1c, 0x5e, 0x6f, 0x5a,
+                0x5e, 0xa3, 0x1b, 0x0b, 0xaf, 0x9f, 0x5a, 0x5e, 0x17, 0xde, 0x38, 0x34, 0xd9, 0x6a, 0x69, 0x02,
+                0xde, 0x20, 0xee, 0x76, 0xdb, 0x5a, 0x80, 0xf3, 0x04, 0xaf, 0x9f, 0x5b, 0x5e, 0xe3, 0x52, 0x0d,
+                0xaf, 0xff, 0x6e, 0xa3, 0x90, 0x54, 0x14, 0x1a, 0xbc, 0xb0, 0x34, 0x28, 0x93, 0x3d, 0x38, 0xcc,
+                0xad, 0x16, 0x36, 0x50, 0x66, 0x1a, 0xd3, 0xb6, 0x32, 0x3d, 0xdc, 0x67, 0xd5, 0x97, 0xd1, 0x22,
+                0xc7, 0xbb, 0x3d, 0x9c, 0xec, 0x3f, 0x0b, 0x2f, 0xe5, 0xce, 0x45, 0x1b, 0x18, 0x4a, 0x3f, 0x5b,
+                0xe0, 0x50, 0x72, 0x99, 0x00, 0x82, 0x03, 0x14, 0x21, 0x1c, 0xb5, 0xb2, 0x09, 0x4b, 0x73, 0x78,
+                0x7a, 0xcf, 0x43, 0xbb, 0x7d, 0x59, 0x4d, 0xc4, 0xd3, 0x46, 0x7d, 0x1a, 0xd6, 0xbf, 0x6a, 0xc7,
+                0x6c, 0xcb, 0xd2, 0x5e, 0xb7, 0x5e, 0xbc, 0x8f, 0xe5, 0x31, 0xef, 0xe6, 0x54, 0x7e, 0xdb, 0x28,
+                0xe5, 0xa5, 0xad, 0xa7, 0x72, 0xd1, 0x12, 0x44, 0x0e, 0xce, 0x80, 0xaf, 0x07, 0x97, 0xaf, 0x0f,
+                0x7e, 0xda, 0x7b, 0x77, 0x74, 0x5e, 0x3f, 0xff, 0xcb, 0xaf, 0x42, 0x9f, 0xef, 0x89, 0x2a, 0x6f,
+                0xe3, 0xf9, 0x5f, 0x32, 0x07, 0xf0, 0xca, 0x50, 0xad, 0x26, 0x50, 0x86, 0x01, 0x1f, 0xd1, 0xad,
+                0x4f, 0xb6, 0x16, 0x42, 0x15, 0xce, 0x43, 0x79, 0x6e, 0x6e, 0x68, 0x7c, 0xdd, 0xd2, 0x5f, 0x94,
+                0x78, 0xbe, 0x8a, 0x90, 0x89, 0x81, 0xe5, 0x1c, 0xf3, 0x22, 0xe3, 0xfb, 0x05, 0x9c, 0x82, 0xc9,
+                0xe4, 0x78, 0x14, 0xfb, 0x94, 0x75, 0xa4, 0xd5, 0xc1, 0x6b, 0x95, 0xeb, 0x55, 0x09, 0x76, 0xfb,
+                0xe9, 0x6b, 0x2b, 0x34, 0x43, 0x5d, 0x39, 0x9a, 0xce, 0xfa, 0x79, 0x23, 0x79, 0x0a, 0x03, 0x6f,
+                0x1c, 0x13, 0xad, 0x32, 0xcb, 0x89, 0x95, 0x3a, 0xf8, 0xc6, 0xf9, 0x02, 0x84, 0xae, 0x1f, 0x84,
+                0xa0, 0x43, 0x57, 0xb2, 0xf8, 0xbf, 0xb0, 0x46, 0x4a, 0xe1, 0x7b, 0x12, 0xab, 0x07, 0x3b, 0x04,
+                0x94, 0xbf, 0xe0, 0x90, 0x42, 0x91, 0x76, 0x2e, 0xca, 0x12, 0x43, 0x58, 0x59, 0x51, 0x72, 0xfa,
+                0x4c, 0x0a, 0x48, 0xf3, 0x68, 0x42, 0x9f, 0x5d, 0x8e, 0x2c, 0xc2, 0x46, 0x9f, 0x56, 0x41, 0x93,
+                0xdf, 0xec, 0x5c, 0x4a, 0x6a, 0x27, 0x20, 0xab, 0xd3, 0x41, 0xa7, 0xa2, 0x5c, 0x58, 0x79, 0x57,
+                0xee, 0x6f, 0x7b, 0x41, 0x70, 0x00, 0xa1, 0x4e, 0x7e, 0x14, 0x66, 0x39, 0xde, 0x9b, 0xe4, 0x3a,
+                0x57, 0x61, 0x16, 0x8e, 0xc2, 0x28, 0xcc, 0x6f, 0x7d, 0x62, 0x13, 0xde, 0xac, 0x64, 0xd8, 0x2b,
+                0x20, 0x2f, 0xa1, 0x04, 0x33, 0x0d, 0x83, 0xa0, 0x79, 0xf5, 0x58, 0x25, 0xa8, 0x54, 0xa4, 0x2a,
+                0x16, 0x46, 0xe7, 0xca, 0x5e, 0xde, 0x76, 0xd7, 0x67, 0xf5, 0x13, 0x67, 0xda, 0x24, 0x1e, 0xca,
+                0xc2, 0x4f, 0x58, 0xa2, 0x3f, 0x63, 0x0e, 0x4b, 0xdb, 0x33, 0xa8, 0x0a, 0x49, 0x35, 0x8c, 0xa3,
+                0x0a, 0xe3, 0xbf, 0x93, 0x64, 0xd6, 0x82, 0x70, 0x64, 0x43, 0x38, 0x6a, 0x20, 0x04, 0xb7, 0xab,
+                0x02, 0xa6, 0x21, 0xd4, 0x8e, 0x31, 0xa1, 0x10, 0x85, 0x5e, 0x24, 0xeb, 0x7a, 0x99, 0xb8, 0xe6,
+                0xad, 0x3e, 0xab, 0xe2, 0x25, 0xdd, 0x30, 0xd2, 0x3c, 0x2a, 0xa5, 0xbe, 0xcc, 0xfc, 0x54, 0xb9,
+                0x06, 0xa1, 0x79, 0xf9, 0x0e, 0xdd, 0x79, 0x88, 0xda, 0x44, 0x78, 0x0c, 0xd3, 0x5c, 0x3f, 0x4f,
+                0xa3, 0x19, 0x64, 0xb4, 0x3b, 0xf4, 0x69, 0x78, 0x4f, 0xfc, 0x95, 0xc5, 0xc9, 0x73, 0xc3, 0x55,
+                0x28, 0x5f, 0x7f, 0x5e, 0x6b, 0xdc, 0x3b, 0x13, 0xfa, 0x24, 0x88, 0x03, 0x85, 0x25, 0x4e, 0xd9,
+                0x9b, 0x37, 0x2a, 0x69, 0xee, 0x76, 0x6a, 0xbc, 0x14, 0x67, 0xe7, 0x76, 0x15, 0xf6, 0xe8, 0x05,
+                0xee, 0xf4, 0xde, 0x78, 0x8c, 0x47, 0x51, 0xe2, 0xe2, 0xe4, 0xa6, 0x7a, 0x71, 0x0d, 0x75, 0x1c,
+                0x64, 0xd5, 0x59, 0x20, 0x71, 0x9e, 0x53, 0xa8, 0x67, 0x66, 0xde, 0xc6, 0x13, 0x97, 0x59, 0x6a,
+                0x2b, 0x22, 0x3d, 0x2a, 0x0c, 0xaf, 0x32, 0x87, 0xc0, 0x60, 0xc2, 0x00, 0x8e, 0xa9, 0x78, 0x59,
+                0x67, 0xda, 0xdd, 0xbd, 0xee, 0xf3, 0xb3, 0x0d, 0xa6, 0x38, 0x86, 0x4a, 0x64, 0x58, 0xce, 0x77,
+                0xc9, 0xf2, 0x63, 0x8d, 0x52, 0x39, 0x3f, 0x05, 0x6d, 0xb5, 0x8a, 0x6f, 0xf9, 0x18, 0x97, 0xcb,
+                0xe6, 0x11, 0x5d, 0xb9, 0x0e, 0xfc, 0x49, 0x70, 0xf9, 0x76, 0x01, 0x43, 0xb0, 0xb2, 0x2f, 0x44,
+                0xb7, 0x7a, 0x5a, 0x72, 0xe3, 0xc3, 0x85, 0x3a, 0xb9, 0x77, 0x8f, 0x9a, 0x67, 0x34, 0xaf, 0x68,
+                0x09, 0xc2, 0x15, 0xf4, 0x0c, 0x82, 0x29, 0x85, 0x08, 0xf1, 0x4a, 0xdc, 0x17, 0x3a, 0x98, 0x79,
+                0x73, 0x77, 0x8e, 0xd3, 0x33, 0xc7, 0xe3, 0x0a, 0xbd, 0x9d, 0x06, 0xa0, 0x52, 0x7f, 0x64, 0x55,
+                0x39, 0xc4, 0xa3, 0x58, 0x47, 0x4d, 0x7d, 0x1e, 0x4b, 0x60, 0x83, 0xa9, 0x07, 0x3c, 0x30, 0x02,
+                0x08, 0xcb, 0x92, 0x44, 0xa4, 0x02, 0x2f, 0x71, 0xb1, 0x62, 0xa4, 0x14, 0x9f, 0xdc, 0x09, 0x66,
+                0xc9, 0xb8, 0x1c, 0x33, 0x98, 0xff, 0x92, 0x5e, 0x93, 0x81, 0x07, 0x14, 0x0a, 0x01, 0x86, 0x9a,
+                0xa0, 0x4c, 0x6c, 0xee, 0xcf, 0x8d, 0x22, 0xd2, 0x8d, 0xff, 0xc8, 0x87, 0xbb, 0xa6, 0x01, 0x13,
+                0x0a, 0x67, 0x39, 0x83, 0x42, 0x4b, 0x65, 0xfb, 0xf9, 0x1e, 0xb9, 0xd7, 0x5a, 0x28, 0x24, 0xd9,
+                0x05, 0x3a, 0xdb, 0x62, 0x90, 0xd2, 0x7e, 0xcd, 0xc9, 0xc4, 0x1a, 0x7c, 0xb0, 0x33, 0xbe, 0x48,
+                0xb7, 0xd4, 0xee, 0xaf, 0x8b, 0x7b, 0x2d, 0x67, 0x68, 0x1d, 0x69, 0xb7, 0x89, 0x40, 0xc7, 0x76,
+                0xf2, 0xb9, 0x72, 0xdc, 0x8a, 0x1b, 0x8d, 0x85, 0xd9, 0x0a, 0xdc, 0xde, 0x92, 0x35, 0x54, 0x74,
+                0x73, 0x2b, 0x26, 0xf4, 0x59, 0xfc, 0xe0, 0x63, 0x9e, 0x42, 0xc4, 0x1a, 0x20, 0x6d, 0x57, 0x00,
+                0xd0, 0x4b, 0x59, 0x31, 0x18, 0x77, 0x39, 0xa6, 0xa4, 0x91, 0x2c, 0xa9, 0xc5, 0x93, 0x2d, 0xcb,
+                0x2e, 0x81, 0xa3, 0x36, 0x1d, 0x6e, 0x7e, 0x13, 0xe5, 0xf2, 0x14, 0xae, 0x84, 0xb1, 0xd3, 0xd0,
+                0x8f, 0xbc, 0x70, 0xbe, 0xe5, 0xc5, 0x90, 0xaa, 0x4b, 0xae, 0xa8, 0x86, 0x76, 0x85, 0x96, 0x34,
+                0x52, 0xa9, 0xb0, 0xab, 0x28, 0xdf, 0x54, 0x95, 0xfa, 0x8a, 0xaa, 0x63, 0xdd, 0x9a, 0x0a, 0x88,
+                0xb6, 0xa2, 0x72, 0x16, 0x9b, 0x9b, 0xb3, 0x66, 0xfa, 0x59, 0x8a, 0x6b, 0x58, 0x9b, 0x92, 0x6b,
+                0x19, 0x82, 0x9c, 0x94, 0x85, 0x7b, 0xa8, 0x83, 0x1b, 0x46, 0xf0, 0x45, 0xa4, 0x60, 0x72, 0xc0,
+                0xe4, 0x08, 0xcb, 0xc3, 0x52, 0xea, 0x08, 0xbb, 0x1d, 0xaa, 0x97, 0x65, 0x79, 0x14, 0x58, 0x39,
+                0x98, 0xbd, 0x80, 0x25, 0x78, 0xad, 0x11, 0x3d, 0x68, 0xc2, 0x2b, 0xde, 0x5a, 0xe5, 0x54, 0x42,
+                0x4c, 0xf9, 0x3c, 0xf2, 0x7c, 0x4e, 0x07, 0xde, 0x65, 0x8f, 0x07, 0x88, 0xa9, 0x14, 0x39, 0xcc,
+                0x4a, 0xe2, 0xc9, 0x67, 0x00, 0x89, 0xde, 0x0a, 0x66, 0xea, 0xb9, 0xa1, 0x3c, 0x4a, 0xb4, 0xf6,
+                0xc6, 0x68, 0x44, 0x3b, 0xe0, 0xd4, 0x03, 0xb1, 0x66, 0xee, 0x42, 0x9f, 0x0c, 0x51, 0x8e, 0xca,
+                0x1b, 0x37, 0x7f, 0x48, 0x00, 0x62, 0x9a, 0xc1, 0xcf, 0x0a, 0x23, 0x1e, 0x6c, 0x53, 0xe6, 0xb5,
+                0xdc, 0x04, 0x56, 0xaf, 0x41, 0x54, 0xb5, 0x41, 0xe5, 0x61, 0xab, 0x8c, 0x56, 0x86, 0x4f, 0x0e,
+                0x6b, 0xf9, 0x69, 0xcb, 0x72, 0x1a, 0x10, 0x69, 0x33, 0x2c, 0x68, 0x09, 0x3f, 0x2d, 0x3c, 0x77,
+                0x9a, 0x26, 0xda, 0xe8, 0x42, 0x99, 0x9c, 0xcd, 0x8a, 0xfe, 0x22, 0x2e, 0x6a, 0x1d, 0x00, 0x55,
+                0xe7, 0x04, 0x37, 0x7a, 0xd8, 0x7c, 0x3d, 0x05, 0xce, 0xe2, 0x99, 0xcb, 0x9b, 0xe2, 0xa0, 0xa6,
+                0x84, 0x05, 0x31, 0x4e, 0x18, 0x05, 0xc0, 0x7f, 0x79, 0x2a, 0xcb, 0x7c, 0x52, 0xf3, 0x06, 0x93,
+                0x5a, 0xea, 0x62, 0x2b, 0x0f, 0xaa, 0x15, 0x47, 0xd8, 0xea, 0xc0, 0x3e, 0x40, 0x97, 0x0b, 0xf4,
+                0x5e, 0xf6, 0x72, 0xf0, 0x4b, 0x47, 0x0b, 0x70, 0x63, 0xa9, 0x4a, 0x7a, 0x0d, 0xd6, 0x07, 0x47,
+                0xe4, 0x02, 0x15, 0x68, 0xa2, 0x75, 0xcb, 0xa9, 0xcf, 0x02, 0xbc, 0x14, 0x02, 0x44, 0xe2, 0xda,
+                0xf1, 0x3e, 0x48, 0x55, 0x82, 0x9b, 0xd5, 0xd5, 0x76, 0xab, 0x5c, 0x7a, 0x02, 0x3b, 0x4c, 0xb0,
+                0xb1, 0xc9, 0x8f, 0x1d, 0x10, 0x44, 0x78, 0x67, 0x3e, 0xa9, 0x35, 0x67, 0xcd, 0x41, 0x9b, 0x8a,
+                0xcd, 0x78, 0xc4, 0x67, 0x97, 0xbe, 0x97, 0x06, 0xf6, 0x4a, 0xea, 0x95, 0x20, 0xbc, 0xaa, 0x5f,
+                0x5b, 0x54, 0x76, 0xc3, 0x22, 0x3f, 0x13, 0xdb, 0xfb, 0xc2, 0xaf, 0xb1, 0xa2, 0xbc, 0x69, 0xc1,
+                0xe7, 0x19, 0xb1, 0xdd, 0x40, 0xa8, 0x00, 0x51, 0xef, 0x9b, 0xf3, 0x5f, 0xf1, 0x58, 0xfa, 0xca,
+                0x0f, 0xff, 0xb3, 0x31, 0x1c, 0x0e, 0x9f, 0xef, 0xac, 0x18, 0x9b, 0xe2, 0x2d, 0x2f, 0xa0, 0x98,
+                0xd5, 0x2d, 0x2f, 0x16, 0x03, 0xd8, 0x74, 0x80, 0xab, 0xfb, 0x3f, 0x0d, 0x03, 0x30, 0x46, 0x75,
+                0x5d, 0x6a, 0xfa, 0x88, 0x2c, 0x91, 0xda, 0xb7, 0x8d, 0x1a, 0xde, 0xda, 0xb9, 0x4c, 0xa9, 0x3d,
+                0x0c, 0xfc, 0xd1, 0x0d, 0x74, 0x57, 0x80, 0x84, 0x3c, 0x49, 0x6f, 0xd7, 0xc2, 0x9c, 0xcf, 0x8c,
+                0x9d, 0xe8, 0xbc, 0x80, 0x36, 0x33, 0xe0, 0x0b, 0x94, 0xb7, 0x35, 0xeb, 0xa3, 0x96, 0x37, 0x41,
+                0xd3, 0x70, 0x07, 0xb5, 0xf5, 0x5c, 0xa7, 0x62, 0x39, 0x57, 0x4d, 0x31, 0xa8, 0x1e, 0x67, 0x16,
+                0xa7, 0xc1, 0x2d, 0xdc, 0xfd, 0x36, 0xb1, 0xe6, 0xb2, 0x00, 0xd2, 0x30, 0xaf, 0x15, 0x57, 0x84,
+                0x8b, 0x23, 0xec, 0x44, 0xc1, 0xfc, 0x5e, 0xe7, 0xc6, 0x37, 0xc6, 0x9b, 0x6d, 0xa4, 0xa5, 0x69,
+                0xb4, 0x46, 0x18, 0x46, 0xff, 0x1d, 0x2d, 0xa7, 0x8c, 0x8b, 0x8d, 0x97, 0x05, 0x49, 0x80, 0xa2,
+                0xc9, 0x79, 0x32, 0x2f, 0xaf, 0x01, 0xd7, 0x5e, 0xbc, 0x51, 0x8e, 0x98, 0x37, 0x02, 0x3e, 0x6b,
+                0x36, 0xb0, 0x9e, 0x2b, 0xc6, 0xbb, 0x59, 0x94, 0xb4, 0xad, 0xfb, 0xd8, 0x70, 0x33, 0x47, 0xdd,
+                0x01, 0xc4, 0x43, 0xdc, 0x32, 0x69, 0xac, 0xf9, 0xf7, 0xf6, 0xdc, 0x72, 0xfd, 0xda, 0x0d, 0x7d,
+                0x09, 0x2e, 0xe1, 0x19, 0x6f, 0xe8, 0x78, 0xd4, 0xaa, 0xd0, 0x8d, 0x34, 0x4d, 0x7d, 0x40, 0xc5,
+                0xed, 0x22, 0x5d, 0xae, 0x99, 0x51, 0xf3, 0xd7, 0x48, 0x4b, 0xb3, 0xaf, 0x2d, 0xd7, 0x2d, 0x5a,
+                0xb6, 0xa4, 0x62, 0x54, 0x9a, 0x3e, 0x43, 0x3f, 0x1a, 0x33, 0xa2, 0xce, 0xfa, 0x1f, 0x49, 0x32,
+                0x3b, 0xd4, 0xaf, 0xf2, 0xb1, 0x8e, 0x55, 0x24, 0xf7, 0xd7, 0x4c, 0xc9, 0xfd, 0xb3, 0xf3, 0x83,
+                0x13, 0x3a, 0x8d, 0x3f, 0x7c, 0x66, 0x96, 0x4f, 0xd1, 0x75, 0xd7, 0xd6, 0xd7, 0x24, 0xf2, 0x1a,
+                0x2f, 0x96, 0x24, 0xff, 0xee, 0x61, 0x29, 0xec, 0xc9, 0x3f, 0x5b, 0x96, 0xb6, 0xe2, 0xd4, 0xf1,
+                0x22, 0x6f, 0x65, 0x95, 0x32, 0xd6, 0xd5, 0x0e, 0x63, 0xfd, 0x0e, 0x47, 0x78, 0x8a, 0xc9, 0x9b,
+                0xae, 0x63, 0xec, 0xb6, 0xcf, 0xf3, 0x9d, 0x8d, 0xb2, 0xd6, 0xaf, 0x79, 0x8a, 0x9e, 0xf6, 0xaa,
+                0x7d, 0x1e, 0x46, 0xae, 0x7d, 0x74, 0x6c, 0x5d, 0xe5, 0xc3, 0x13, 0x06, 0xbe, 0x0a, 0x1d, 0xe1,
+                0xff, 0x9b, 0x53, 0xbb, 0x54, 0xe6, 0x24, 0x05, 0x25, 0x4e, 0x16, 0xd9, 0x72, 0x96, 0x8a, 0xac,
+                0x48, 0x71, 0x0d, 0xcd, 0xda, 0xc6, 0x37, 0x4d, 0xbc, 0xdb, 0x16, 0xcb, 0x72, 0x5c, 0x6f, 0xe9,
+                0xdf, 0xdf, 0xb9, 0xdf, 0x98, 0xbe, 0xfb, 0x21, 0x5d, 0xf3, 0xac, 0xeb, 0xa0, 0xe8, 0x22, 0x9e,
+                0xef, 0x7d, 0x92, 0xf6, 0x1b, 0xf7, 0x80, 0xdb, 0xbc, 0x62, 0x79, 0x63, 0x78, 0xcb, 0xde, 0x46,
+                0x1d, 0xf6, 0xa9, 0x8c, 0x66, 0x1b, 0xf9, 0xa3, 0x6a, 0x8d, 0x2f, 0x13, 0x69, 0xfa, 0x5a, 0x12,
+                0x06, 0x5d, 0x33, 0xef, 0xda, 0x5d, 0xfd, 0x3b, 0x8f, 0xba, 0x7a, 0xe9, 0x86, 0x34, 0x76, 0x90,
+                0x5c, 0xc7, 0x78, 0xda, 0x14, 0x53, 0x5a, 0x8b, 0x34, 0xea, 0x63, 0xe5, 0x21, 0x8f, 0xbd, 0x99,
+                0x61, 0x1f, 0x26, 0x88, 0x5a, 0x0e, 0x9d, 0x7a, 0x6a, 0x6a, 0x2b, 0x10, 0x79, 0x2a, 0x0c, 0xdd,
+                0x8b, 0x7f, 0xde, 0xa0, 0x18, 0xa3, 0x09, 0xbc, 0xec, 0x52, 0x90, 0x82, 0xc1, 0xb9, 0x6c, 0x65,
+                0x5a, 0xfd, 0x4a, 0x0a, 0x46, 0x49, 0x70, 0xab, 0x39, 0x8a, 0x41, 0xa4, 0xd3, 0x40, 0x3e, 0xbb,
+                0x71, 0x47, 0x91, 0xba, 0xaa, 0x61, 0x6e, 0xd9, 0x55, 0xe0, 0x29, 0x48, 0x41, 0x0e, 0x9e, 0xfd,
+                0xf6, 0x73, 0x33, 0x13, 0xd2, 0x71, 0x46, 0x1f, 0xd7, 0x5d, 0x2e, 0x73, 0x02, 0x58, 0xa4, 0x2b,
+                0x6b, 0x59, 0xd7, 0x1f, 0xdb, 0x62, 0x96, 0x22, 0x62, 0x01, 0xcd, 0x28, 0x33, 0x9e, 0xf5, 0x74,
+                0x21, 0x3c, 0xaa, 0x6e, 0xd5, 0xcc, 0xe6, 0x80, 0xc9, 0x74, 0x6a, 0xac, 0xba, 0x4e, 0x9e, 0x5a,
+                0x0c, 0x46, 0x51, 0x32, 0xd2, 0xef, 0x58, 0x97, 0x19, 0x44, 0x78, 0xde, 0xec, 0xad, 0x2d, 0x04,
+                0xaa, 0x2c, 0xc1, 0xff, 0x52, 0x44, 0x8e, 0x47, 0xf8, 0x6f, 0x9c, 0xe1, 0x33, 0x04, 0xd1, 0xeb,
+                0x33, 0x07, 0x7d, 0xd9, 0xcb, 0xf2, 0xc6, 0x9a, 0x92, 0x75, 0xb8, 0x4c, 0xd0, 0x9d, 0x4b, 0xd6,
+                0xab, 0x2c, 0xa5, 0xcc, 0xd2, 0x88, 0xcf, 0xf9, 0x6c, 0xae, 0x67, 0x6d, 0xc7, 0x71, 0x73, 0x86,
+                0x1e, 0x70, 0x58, 0xda, 0x2e, 0x5f, 0x8d, 0x74, 0x5d, 0xb1, 0x47, 0xe2, 0xe7, 0xc5, 0xce, 0x38,
+                0x6a, 0xe7, 0x2b, 0x2c, 0x54, 0x41, 0xfb, 0x46, 0xff, 0x36, 0x10, 0x1d, 0xea, 0x55, 0xfb, 0xe8,
+                0xe7, 0xb0, 0xb1, 0xf3, 0xa0, 0x76, 0xfb, 0x55, 0xfd, 0x78, 0x35, 0xb5, 0x99, 0xd6, 0x22, 0x94,
+                0x7b, 0x9d, 0x9a, 0x36, 0x9f, 0x98, 0x6e, 0x08, 0x63, 0xad, 0x38, 0x8c, 0xb8, 0x2a, 0xcb, 0xc3,
+                0x14, 0xaa, 0x6b, 0xe7, 0xa4, 0xd5, 0x1d, 0x9c, 0xb8, 0xc9, 0x23, 0xbb, 0xce, 0x69, 0x4d, 0x9b,
+                0x7a, 0x77, 0xf2, 0xd6, 0xa0, 0x77, 0xb2, 0xee, 0x6f, 0xe9, 0xc6, 0x4a, 0x95, 0xcc, 0xab, 0x36,
+                0x2d, 0x5a, 0x3b, 0x68, 0x82, 0x5c, 0x17, 0x30, 0x35, 0x1d, 0x09, 0x8b, 0x94, 0xe4, 0x8c, 0x2d,
+                0xe9, 0x5d, 0x96, 0x33, 0xbe, 0x3b, 0x3d, 0x2c, 0x27, 0xa7, 0x11, 0x75, 0x0f, 0xf2, 0x04, 0x6f,
+                0x12, 0x42, 0xbd, 0x70, 0xca, 0x4b, 0x0d, 0x9c, 0x66, 0x42, 0xbc, 0x48, 0x52, 0xab, 0xad, 0x40,
+                0x87, 0xc4, 0x8f, 0xc4, 0xcf, 0x79, 0xbe, 0x96, 0xe5, 0x20, 0xd3, 0xb3, 0xfa, 0x46, 0x8e, 0x55,
+                0x35, 0x05, 0x65, 0x4b, 0xf4, 0x90, 0x88, 0xb1, 0xe9, 0xa1, 0x9f, 0xcc, 0x6f, 0xbf, 0xfe, 0x14,
+                0x51, 0x87, 0xb8, 0xa8, 0xbe, 0xa2, 0x13, 0x4a, 0xa3, 0x04, 0xd3, 0x02, 0x5f, 0x6d, 0x62, 0x85,
+                0xd8, 0xe7, 0xc9, 0x2b, 0xb4, 0x91, 0x66, 0x83, 0x68, 0x2b, 0xa2, 0x51, 0x07, 0x41, 0x76, 0xd0,
+                0x58, 0x0a, 0x29, 0xca, 0x3a, 0x84, 0xc3, 0x64, 0x1a, 0xe9, 0xe0, 0x3a, 0x0d, 0xf3, 0xfb, 0xd6,
+                0x77, 0x20, 0x29, 0x1f, 0x70, 0xdb, 0x6a, 0xbf, 0x80, 0x73, 0x98, 0xf3, 0x99, 0xfb, 0x27, 0x53,
+                0x24, 0x6a, 0x9b, 0xd1, 0x70, 0xee, 0x7a, 0x17, 0x6d, 0xfb, 0xea, 0xba, 0x10, 0xa8, 0x71, 0xc4,
+                0xe7, 0x6d, 0x80, 0x4a, 0x0b, 0x5a, 0x9f, 0x0e, 0x05, 0xc8, 0x72, 0xbb, 0x5a, 0x49, 0x92, 0xbc,
+                0x78, 0xb0, 0xb2, 0xac, 0x10, 0x86, 0x54, 0x31, 0x49, 0x5f, 0x35, 0xa7, 0xda, 0x9b, 0xce, 0x0e,
+                0x64, 0x6a, 0x1e, 0x74, 0xb3, 0x24, 0xae, 0xc3, 0x16, 0x48, 0xbd, 0x84, 0x4e, 0xaf, 0xf3, 0x83,
+                0x90, 0xf3, 0x3c, 0x9c, 0xf1, 0x04, 0xa2, 0x6b, 0xd7, 0x76, 0x1d, 0xb6, 0xa5, 0x7a, 0xaa, 0x6b,
+                0x91, 0xde, 0x5d, 0x5f, 0x57, 0x91, 0xfd, 0xe3, 0xe3, 0xa3, 0xd7, 0xc7, 0xef, 0xdf, 0x5e, 0x9e,
+                0x1e, 0x60, 0xc1, 0x67, 0xa3, 0x38, 0xd6, 0xdc, 0x0c, 0xeb, 0x42, 0xab, 0xfb, 0x52, 0x8d, 0x81,
+                0x21, 0x9e, 0x42, 0x78, 0x61, 0x6c, 0x41, 0x39, 0x92, 0xb6, 0x90, 0x19, 0xab, 0xa3, 0x37, 0x07,
+                0x00, 0xfe, 0xbf, 0x8b, 0xd1, 0xcf, 0x89, 0x80, 0x77, 0x00, 0x00,
+            };
+            const unsigned char asset_2[] = {
+                0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x9d, 0x57, 0xd9, 0x6e, 0xdb, 0x38,
+                0x14, 0x7d, 0xcf, 0x57, 0x70, 0x1a, 0x0c, 0x10, 0x17, 0x62, 0x2a, 0x29, 0xb6, 0xe3, 0xb1, 0x81,
+                0x00, 0x05, 0xe6, 0x61, 0x7e, 0x61, 0x1e, 0x29, 0x89, 0xb2, 0x89, 0xd0, 0xa4, 0x40, 0xd2, 0x4b,
+                0x3a, 0xe8, 0xbf, 0x0f, 0x49, 0x91, 0x12, 0xa9, 0xc5, 0x4e, 0xdb, 0x56, 0xae, 0xcc, 0xe5, 0x2e,
+                0xe7, 0x9e, 0xbb, 0xb8, 0xe0, 0xd5, 0x07, 0xf8, 0xef, 0x01, 0xe8, 0x3f, 0x47, 0x24, 0xf6, 0x84,
+                0x6d, 0x41, 0xba, 0x7b, 0xf8, 0xf9, 0xf0, 0xf0, 0x58, 0x72, 0xa6, 0x10, 0x61, 0x58, 0xb8, 0xed,
+                0x03, 0x26, 0xfb, 0x83, 0xda, 0x82, 0x2c, 0x4d, 0xff, 0xdc, 0xd9, 0x95, 0x8a, 0xc8, 0x86, 0xa2,
+                0x8f, 0x2d, 0x10, 0x98, 0x22, 0x45, 0xce, 0xd8, 0x5e, 0x7c, 0x6e, 0x28, 0x57, 0x67, 0x82, 0x2f,
+                0xb3, 0xf7, 0x2e, 0xa4, 0x52, 0x87, 0x2d, 0xd8, 0xf8, 0xef, 0xdf, 0xbe, 0x3a, 0xdd, 0x50, 0xb4,
+                0x47, 0xe1, 0xa6, 0xb9, 0xee, 0xc0, 0xd7, 0x6f, 0x76, 0xb7, 0xe1, 0x92, 0x28, 0xc2, 0x59, 0xa8,
+                0xc6, 0xac, 0x2b, 0x81, 0x98, 0xdf, 0xb1, 0x12, 0x41, 0xfa, 0xfc, 0x22, 0x8d, 0x09, 0x9d, 0x05,
+                0xcf, 0x8c, 0x1f, 0x88, 0x54, 0xce, 0x10, 0xa7, 0xb6, 0xb7, 0x63, 0x5e, 0xc2, 0x63, 0x25, 0xd0,
+                0x85, 0xb0, 0x7d, 0x02, 0xfc, 0x1b, 0x2c, 0x11, 0x3b, 0x23, 0x39, 0x27, 0x2a, 0x76, 0xd2, 0xa0,
+                0x60, 0x14, 0x73, 0xf1, 0x11, 0x5f, 0xc8, 0xa7, 0xcf, 0x9b, 0x15, 0x7e, 0xc6, 0xa2, 0xa6, 0xfc,
+                0x02, 0x35, 0x9e, 0xb2, 0x14, 0x9c, 0xd2, 0xc1, 0xfa, 0x75, 0x0b, 0x0e, 0xa4, 0xaa, 0x30, 0xeb,
+                0x40, 0x6b, 0x50, 0x55, 0x19, 0xd3, 0x28, 0xae, 0xb5, 0xa8, 0x69, 0xcc, 0x6a, 0x72, 0xc5, 0x95,
+                0x73, 0x97, 0x37, 0x36, 0xb8, 0xe6, 0xdd, 0x01, 0x9d, 0x8e, 0x81, 0xb0, 0x3b, 0x3d, 0x94, 0xce,
+                0x8d, 0x18, 0x49, 0x1f, 0xa6, 0xce, 0x9d, 0x33, 0x91, 0xa4, 0x20, 0x94, 0xa8, 0x8f, 0xd8, 0xc8,
+                0x69, 0xc1, 0x49, 0x70, 0xbe, 0xd3, 0xd4, 0xa9, 0x82, 0x44, 0xe1, 0xa3, 0x53, 0x54, 0xf0, 0x2b,
+                0x94, 0x07, 0x54, 0xf1, 0x8b, 0xb6, 0x15, 0x2c, 0x9b, 0xab, 0xf1, 0x52, 0xbf, 0x89, 0x7d, 0x81,
+                0x9e, 0xd2, 0x04, 0xb8, 0x7f, 0xcf, 0xf9, 0x62, 0x17, 0x51, 0x78, 0xd3, 0x7e, 0x2d, 0x4f, 0x42,
+                0x72, 0xb1, 0xd5, 0x70, 0x10, 0xa6, 0xb0, 0xd8, 0xcd, 0xf2, 0x69, 0xa4, 0x9e, 0x1c, 0xf7, 0x77,
+                0x43, 0x9d, 0x9f, 0x2f, 0x13, 0x37, 0x91, 0xbb, 0xd7, 0xab, 0x41, 0x85, 0xe4, 0xf4, 0xa4, 0xf0,
+                0xbd, 0x28, 0x94, 0x9c, 0x1a, 0x63, 0x87, 0xbe, 0xad, 0x9c, 0x6f, 0x0a, 0x5f, 0x15, 0xac, 0x70,
+                0xc9, 0x05, 0x6a, 0xe5, 0x32, 0xce, 0x9c, 0xcc, 0x5a, 0xa7, 0x2a, 0xbc, 0x38, 0xbb, 0x0a, 0x4e,
+                0xab, 0x60, 0x59, 0x92, 0x1f, 0x58, 0x13, 0x2f, 0xd7, 0xec, 0x68, 0xed, 0x6a, 0x49, 0xa3, 0xb5,
+                0x6a, 0x24, 0x0d, 0xa2, 0x69, 0xfb, 0xc4, 0x00, 0xc2, 0xbc, 0xdf, 0xe9, 0x77, 0xbb, 0x84, 0x6f,
+                0x55, 0x8f, 0x7d, 0xdf, 0x1e, 0x0c, 0x5d, 0x1d, 0x02, 0xce, 0x9f, 0xc7, 0xbf, 0xbf, 0x2f, 0x57,
+                0xeb, 0xd7, 0xf1, 0x71, 0x77, 0xd8, 0x03, 0xd6, 0x09, 0x27, 0x8c, 0x92, 0x29, 0xf1, 0x91, 0xf0,
+                0x98, 0x19, 0x86, 0x15, 0xd9, 0x7a, 0x96, 0x1a, 0xa6, 0x9c, 0x29, 0xce, 0x69, 0x81, 0xfc, 0x75,
+                0x9d, 0x51, 0x48, 0x63, 0x65, 0x32, 0x67, 0x77, 0x33, 0x5c, 0x83, 0x44, 0xb1, 0xc1, 0xf3, 0x70,
+                0x58, 0x7c, 0x6b, 0x74, 0x24, 0x54, 0x5b, 0xfd, 0x0f, 0xa6, 0x67, 0xac, 0x48, 0x89, 0x12, 0xf0,
+                0x5d, 0x10, 0x44, 0x13, 0x20, 0x35, 0xf7, 0xa1, 0xc4, 0x82, 0xd4, 0xa3, 0x70, 0x64, 0x9b, 0x48,
+                0xc6, 0x38, 0x74, 0x7a, 0xa9, 0x78, 0x27, 0x0a, 0x9e, 0xf4, 0x7d, 0x2d, 0x83, 0xe2, 0x52, 0x85,
+                0x01, 0x87, 0x47, 0x39, 0xb7, 0x35, 0xb3, 0x5c, 0xa0, 0xf2, 0x7d, 0x2f, 0xf8, 0x89, 0x55, 0x30,
+                0xe4, 0x59, 0xbe, 0x7a, 0x49, 0x80, 0xfb, 0x58, 0x1a, 0xb8, 0x36, 0x8e, 0x6d, 0x05, 0x17, 0x95,
+                0x16, 0xf4, 0x2b, 0x67, 0x05, 0xaa, 0xc8, 0x49, 0x6a, 0xae, 0x19, 0xdf, 0x2c, 0xe4, 0x05, 0x34,
+                0xa8, 0xcb, 0x37, 0xd9, 0x20, 0xe6, 0xd3, 0xc2, 0xd3, 0xcf, 0x10, 0x2c, 0x78, 0x62, 0xfa, 0xa5,
+                0x6e, 0x23, 0x0d, 0x37, 0xef, 0xe4, 0xc7, 0x28, 0xd9, 0x47, 0x26, 0xbc, 0xa1, 0x61, 0xa7, 0xd3,
+                0xe2, 0x3b, 0xa6, 0xc3, 0x69, 0xbb, 0xdf, 0xa6, 0x49, 0x9d, 0xbe, 0x96, 0x2d, 0x43, 0x89, 0xee,
+                0x93, 0x09, 0xb0, 0xff, 0xc1, 0x0b, 0x12, 0x6c, 0x94, 0xfe, 0x83, 0xae, 0x65, 0x18, 0xb4, 0xea,
+                0xa2, 0x4f, 0x28, 0x9d, 0xf6, 0xc8, 0x8b, 0x8e, 0x94, 0xb7, 0xc7, 0x63, 0xdd, 0x56, 0xe9, 0xd4,
+                0xa9, 0x30, 0xed, 0xec, 0x41, 0x2c, 0x04, 0x17, 0xbf, 0x61, 0x5e, 0x28, 0xe9, 0xd1, 0xe8, 0xd1,
+                0x59, 0x3a, 0x12, 0x13, 0xf4, 0x99, 0x41, 0x95, 0xf8, 0x44, 0xbf, 0xbc, 0x41, 0xd0, 0xbf, 0xf2,
+                0x04, 0xf8, 0x27, 0x7d, 0x5e, 0x6f, 0x7c, 0xb4, 0x7f, 0x40, 0xc2, 0x2a, 0xac, 0x7b, 0x62, 0x1e,
+                0xd9, 0x05, 0x4d, 0x95, 0xfc, 0x4c, 0x05, 0x5e, 0x79, 0xbd, 0x6d, 0xf3, 0x5c, 0x45, 0x33, 0x41,
+                0xcd, 0xc5, 0x71, 0xdb, 0xbe, 0x6a, 0x70, 0xf0, 0x13, 0xd4, 0xdb, 0x09, 0x30, 0x9f, 0x8b, 0x3e,
+                0xff, 0x3e, 0x77, 0x32, 0x48, 0xfa, 0xe5, 0x74, 0xe1, 0x40, 0xd3, 0xd5, 0xa2, 0x07, 0x41, 0x27,
+                0xde, 0xca, 0xe4, 0x5c, 0xfb, 0x11, 0x76, 0x03, 0x5f, 0x00, 0x7d, 0x1e, 0x99, 0x32, 0x68, 0x2e,
+                0x2c, 0xd7, 0x09, 0x68, 0x1f, 0xc7, 0x24, 0x43, 0x67, 0x45, 0x9a, 0x3b, 0xc1, 0x1f, 0x54, 0x60,
+                0x58, 0x50, 0x5e, 0xbe, 0xc7, 0x02, 0xfc, 0x4b, 0x00, 0xf3, 0x5c, 0xef, 0x0f, 0xcb, 0x5d, 0x3e,
+                0x59, 0xee, 0x98, 0x06, 0x0f, 0xd1, 0xc1, 0x4c, 0xe8, 0x4f, 0x4e, 0xf2, 0xe1, 0xe9, 0x35, 0x4b,
+                0x40, 0xfb, 0x2c, 0x22, 0x98, 0x1e, 0xeb, 0xba, 0x0e, 0x80, 0x41, 0x94, 0xec, 0xb5, 0x7b, 0x25,
+                0xee, 0xdb, 0xfe, 0xa0, 0x48, 0xad, 0x47, 0xfd, 0x70, 0x65, 0xea, 0xc0, 0xed, 0x66, 0xd0, 0x91,
+                0x2e, 0x0b, 0x98, 0x94, 0xcd, 0x51, 0xc9, 0xcd, 0xb4, 0xed, 0x2a, 0xec, 0xa3, 0xcf, 0x1b, 0x54,
+                0x5a, 0xb4, 0x26, 0xa6, 0x2f, 0xb7, 0x67, 0xfa, 0x96, 0x9c, 0x47, 0x7e, 0xbb, 0x45, 0xb5, 0x0a,
+                0x4a, 0x92, 0xf6, 0x92, 0x69, 0x1d, 0x5f, 0xbe, 0xdc, 0x36, 0xbf, 0xe0, 0x4a, 0xf1, 0x63, 0x98,
+                0x74, 0x37, 0x2d, 0xee, 0xca, 0x80, 0x83, 0xce, 0x85, 0x68, 0xb8, 0x2c, 0xd5, 0x07, 0xd5, 0x31,
+                0xd6, 0x8a, 0x48, 0x35, 0xd5, 0x3b, 0xac, 0x7b, 0x0d, 0x12, 0xda, 0xc4, 0xe8, 0x7d, 0x10, 0xce,
+                0x70, 0x2f, 0xf2, 0xdc, 0xd5, 0xb6, 0x3b, 0xcc, 0xb3, 0xef, 0x14, 0x0f, 0x10, 0xce, 0x5a, 0x49,
+                0x35, 0xaa, 0x30, 0xe4, 0x27, 0x7f, 0x6f, 0x32, 0x00, 0x83, 0x4c, 0xfe, 0xf7, 0x09, 0x6a, 0x98,
+                0x9a, 0xeb, 0xe2, 0x56, 0x8c, 0x56, 0x7a, 0x94, 0xed, 0x2e, 0xdb, 0xef, 0x40, 0x2a, 0xdc, 0x40,
+                0xcc, 0x2a, 0xfb, 0xad, 0xd5, 0x5e, 0x09, 0xfe, 0x9b, 0x99, 0x17, 0x56, 0xca, 0x97, 0xa5, 0x6b,
+                0x4f, 0xad, 0xbc, 0x13, 0xbd, 0x53, 0xe5, 0xba, 0x19, 0xdd, 0x87, 0xcb, 0x92, 0x35, 0xef, 0x58,
+                0x18, 0x7a, 0x84, 0x28, 0xb5, 0x73, 0x38, 0xc0, 0x48, 0xe2, 0x11, 0x26, 0xb2, 0x44, 0x14, 0x3f,
+                0xa5, 0x8b, 0xc1, 0x06, 0xe4, 0x5a, 0x85, 0xe9, 0xa2, 0x5a, 0x70, 0xab, 0x6d, 0x37, 0x31, 0x99,
+                0xe5, 0x7e, 0xca, 0x1c, 0x75, 0xb9, 0x6c, 0xbd, 0x48, 0xdc, 0x81, 0xe9, 0xa1, 0x3e, 0xf3, 0x53,
+                0x7d, 0x38, 0xb2, 0xce, 0x15, 0x87, 0xbe, 0x00, 0x84, 0x75, 0x67, 0x7d, 0x63, 0xcc, 0x0a, 0xa1,
+                0xa4, 0x64, 0x38, 0x84, 0x06, 0x11, 0x88, 0x9a, 0xd7, 0xe0, 0x16, 0x9a, 0xfb, 0x95, 0xd0, 0xd9,
+                0x9c, 0x99, 0xd9, 0x22, 0x33, 0x10, 0xb4, 0x6f, 0xf9, 0x68, 0x98, 0xae, 0x29, 0x76, 0x4b, 0x97,
+                0x83, 0x9e, 0x73, 0xa1, 0x4e, 0x82, 0x52, 0x1b, 0xdf, 0x08, 0x1c, 0x00, 0x4a, 0x7e, 0x58, 0x69,
+                0x2e, 0xb5, 0xf4, 0xd2, 0x67, 0x06, 0x88, 0xc8, 0x50, 0x79, 0xde, 0xc7, 0x33, 0x98, 0xff, 0xb5,
+                0xbd, 0x19, 0x12, 0xab, 0x3d, 0x1e, 0xcc, 0x6c, 0xb7, 0x86, 0x85, 0xe5, 0xec, 0x6d, 0xbb, 0x02,
+                0xdf, 0x8b, 0x2a, 0x9a, 0xba, 0x5c, 0x75, 0x41, 0x27, 0xc5, 0x23, 0xa4, 0xdc, 0x7a, 0x76, 0x6f,
+                0xdc, 0x7b, 0x99, 0xf0, 0x2d, 0xfe, 0x65, 0xd0, 0x71, 0x43, 0xb3, 0x02, 0x17, 0xe6, 0xef, 0x6e,
+                0x3c, 0xba, 0x4d, 0x8d, 0x53, 0xa1, 0xc8, 0x67, 0x33, 0x56, 0x41, 0x2b, 0xf7, 0xe6, 0x8f, 0x9a,
+                0x99, 0x81, 0xcb, 0xba, 0xce, 0x1b, 0xcc, 0xfa, 0x44, 0x1d, 0x65, 0x54, 0xe6, 0x3c, 0x61, 0xbc,
+                0xcf, 0xc5, 0xf0, 0x2c, 0xe9, 0x7f, 0xe6, 0x81, 0x3f, 0xc8, 0xb1, 0xe1, 0x42, 0x21, 0x66, 0x93,
+                0xec, 0xe7, 0xff, 0x2f, 0x64, 0x02, 0x79, 0xb6, 0x11, 0x00, 0x00,
+            };
+            const unsigned char asset_3[] = {
+                0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x4d, 0x90, 0x3b, 0x6f, 0xc3, 0x30,
+                0x0c, 0x84, 0xff, 0xca, 0x41, 0x59, 0x65, 0xbd, 0x2d, 0xc4, 0x41, 0x94, 0xa1, 0x53, 0x96, 0xac,
+                0x1d, 0xba, 0x15, 0x89, 0x6c, 0x19, 0x70, 0x1e, 0x68, 0x04, 0x2b, 0xc8, 0xaf, 0xaf, 0x68, 0x03,
+                0x45, 0x17, 0x12, 0xb8, 0xef, 0x8e, 0x24, 0xb8, 0x7f, 0xce, 0x03, 0x5e, 0xd7, 0xe9, 0xf6, 0x0c,
+                0x2c, 0xe5, 0xfc, 0xd8, 0x49, 0x59, 0x4a, 0x11, 0xc5, 0x8a, 0xfb, 0xcf, 0x20, 0x8d, 0x52, 0x4a,
+                0x56, 0x07, 0x43, 0x8a, 0xe3, 0x90, 0x72, 0x60, 0xde, 0x31, 0xcc, 0x63, 0x2c, 0x1f, 0xf7, 0x57,
+                0x60, 0x0a, 0x0a, 0xde, 0x81, 0xb4, 0x32, 0x5e, 0x72, 0x5a, 0xf0, 0x61, 0xff, 0xf8, 0xce, 0x09,
+                0x97, 0xc0, 0x4e, 0x95, 0x27, 0xef, 0x66, 0xef, 0x8e, 0xea, 0xcd, 0xd0, 0x8f, 0xd3, 0x14, 0xd8,
+                0xa6, 0xef, 0x7b, 0x26, 0xff, 0x99, 0xe0, 0x34, 0xb7, 0x1d, 0x3e, 0x61, 0x5a, 0x9c, 0xa1, 0x78,
+                0xa3, 0x85, 0x46, 0xa3, 0x44, 0xc7, 0x1b, 0x83, 0xc6, 0x50, 0x3d, 0xae, 0x8c, 0x08, 0x57, 0xa4,
+                0x55, 0x4a, 0xcd, 0x60, 0x86, 0x76, 0x4b, 0x8a, 0x42, 0x94, 0x31, 0x20, 0x39, 0xad, 0xf2, 0xea,
+                0xaf, 0x23, 0xc8, 0xbf, 0x4c, 0x7a, 0xe3, 0x04, 0xb3, 0x15, 0x2d, 0xb7, 0x56, 0xb4, 0xb0, 0x75,
+                0xb3, 0x17, 0xad, 0x86, 0x75, 0x24, 0x19, 0xd8, 0x8e, 0xdb, 0xed, 0xba, 0xee, 0xeb, 0xef, 0xe0,
+                0x18, 0x23, 0x1d, 0x4c, 0x7f, 0x38, 0xfc, 0x02, 0xd4, 0x7c, 0x94, 0xf7, 0x2f, 0x01, 0x00, 0x00,
+            };
+            const unsigned char asset_4[] = {
+                0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xd5, 0x5b, 0x0b, 0x74, 0x14, 0xd5,
+                0x19, 0x1e, 0x4c, 0x5b, 0x6a, 0xad, 0x05, 0x5b, 0x5b, 0xdb, 0x6a, 0x85, 0xd3, 0x56, 0xeb, 0xe3,
+                0x54, 0x3d, 0xb5, 0xf2, 0x10, 0x34, 0x08, 0x28, 0xa0, 0x80, 0xd5, 0x8a, 0x8a, 0xcf, 0x5a, 0x2a,
+                0x5a, 0x8b, 0xb5, 0x0f, 0x10, 0xad, 0x4a, 0x82, 0x22, 0x78, 0xaa, 0xd5, 0x82, 0x22, 0xa2, 0x58,
+                0x0a, 0xf5, 0x05, 0x8a, 0x08, 0x84, 0xec, 0x6e, 0x5e, 0xbb, 0xd9, 0xf7, 0x26, 0x9b, 0xdd, 0x6c,
+                0x92, 0x4d, 0xb2, 0x3b, 0xbb, 0xd9, 0x57, 0x08, 0x52, 0xda, 0x8a, 0xa5, 0x2d, 0xa0, 0xc0, 0xed,
+                0xff, 0xdd, 0x3b, 0xb3, 0x99, 0x9d, 0xcc, 0x66, 0x37, 0x10, 0x44, 0xf7, 0x9c, 0x7b, 0x6e, 0x76,
+                0x76, 0x66, 0xee, 0x77, 0xef, 0xfd, 0xef, 0xff, 0xf8, 0xfe, 0x3f, 0x92, 0x34, 0x44, 0x2a, 0x91,
+                0x2e, 0xba, 0x48, 0xa2, 0x7e, 0xa4, 0xf4, 0xd6, 0x59, 0x92, 0x34, 0x4a, 0x92, 0xa4, 0x91, 0x23,
+                0x95, 0xef, 0xc3, 0x25, 0xa9, 0x8b, 0xae, 0x0d, 0x1f, 0x2e, 0xbe, 0xdf, 0xfb, 0x39, 0x49, 0x5a,
+                0x4a, 0x37, 0x9c, 0x43, 0xf7, 0xd0, 0x23, 0xd2, 0xcf, 0x24, 0x71, 0x9d, 0x7f, 0xbe, 0x2f, 0x7d,
+                0x66, 0x3e, 0x8c, 0x59, 0x3f, 0x27, 0x7d, 0x06, 0x3f, 0xa9, 0x94, 0x7c, 0x7e, 0x26, 0x23, 0x3f,
+                0xd5, 0x9d, 0x8e, 0x25, 0xba, 0xbb, 0x3b, 0xbe, 0xf6, 0xd9, 0xc0, 0x9c, 0x3a, 0xa5, 0x3b, 0x15,
+                0x9b, 0x4b, 0xb8, 0x03, 0x99, 0xb4, 0xcc, 0xb2, 0x2d, 0x25, 0x2f, 0xfe, 0xf4, 0xca, 0x07, 0x2b,
+                0xd9, 0x91, 0x8a, 0x4e, 0x26, 0xcc, 0x1b, 0x09, 0xeb, 0x47, 0x39, 0xb8, 0x7b, 0xdb, 0xee, 0x9e,
+                0x9e, 0x9e, 0x2f, 0x7d, 0x9a, 0x70, 0x27, 0x93, 0xd1, 0x73, 0x85, 0x7c, 0xc8, 0xef, 0x6b, 0xb1,
+                0xa6, 0x53, 0x11, 0x16, 0xe9, 0x68, 0x62, 0xcd, 0x7e, 0x1b, 0x8b, 0x46, 0x82, 0x9a, 0x3d, 0x88,
+                0x3e, 0x70, 0xbc, 0x31, 0x27, 0x12, 0x89, 0xe1, 0x90, 0x8f, 0x74, 0x5a, 0x76, 0xe6, 0xae, 0x6f,
+                0x94, 0xc5, 0xe5, 0x16, 0xd6, 0xda, 0xec, 0x66, 0x3e, 0xb7, 0x99, 0x79, 0x9d, 0x26, 0xde, 0xfc,
+                0xbe, 0x5a, 0x9a, 0x4f, 0x54, 0xdc, 0x93, 0x91, 0x93, 0xc7, 0xe3, 0x2c, 0x93, 0x7c, 0x9c, 0xa0,
+                0xc8, 0xc7, 0x7a, 0xc2, 0xf1, 0x5f, 0x2d, 0xee, 0x44, 0x3c, 0xcc, 0xc2, 0xad, 0x3e, 0xd6, 0xe8,
+                0xa9, 0xce, 0x62, 0xd6, 0x37, 0xec, 0x45, 0xf6, 0x99, 0x8c, 0x7c, 0xdb, 0x27, 0x85, 0x7b, 0xc7,
+                0x8e, 0xce, 0x1f, 0xd0, 0xb9, 0x2b, 0xc7, 0xba, 0xe5, 0x93, 0x8f, 0x7c, 0x98, 0xb5, 0xcd, 0xef,
+                0xad, 0xd1, 0xe2, 0x0f, 0x1c, 0x4b, 0xcc, 0xb2, 0x2c, 0x7f, 0x85, 0xe4, 0xe3, 0x8e, 0x74, 0x3a,
+                0x56, 0x4d, 0xe3, 0x1d, 0x36, 0x92, 0x8f, 0x06, 0x8d, 0x7c, 0x14, 0xdb, 0x3a, 0xdb, 0xb5, 0x7b,
+                0x10, 0x9b, 0x36, 0xd8, 0xf2, 0x91, 0x4a, 0xc5, 0xc7, 0x67, 0x32, 0xd1, 0xd5, 0xf4, 0xfe, 0xff,
+                0x68, 0xd7, 0x3a, 0xd9, 0xd5, 0xc1, 0xda, 0xdb, 0x1a, 0x58, 0x23, 0xad, 0xe1, 0x40, 0x31, 0x6b,
+                0x5b, 0xa3, 0xb7, 0xba, 0xf7, 0x1c, 0xa4, 0x65, 0xeb, 0xe0, 0xc8, 0x47, 0xec, 0x3b, 0x24, 0x1f,
+                0x0b, 0xe9, 0x7d, 0x71, 0xbd, 0x7c, 0x44, 0x3b, 0x83, 0x45, 0xcb, 0x47, 0xb1, 0xad, 0x23, 0xdc,
+                0xd8, 0x3b, 0x46, 0x3a, 0x7e, 0xc9, 0x11, 0xea, 0x8f, 0x2f, 0x76, 0xa7, 0xe4, 0x59, 0x7d, 0xe5,
+                0x43, 0x66, 0x5d, 0xb1, 0xb6, 0x7e, 0xe5, 0xa3, 0xbe, 0xce, 0xcc, 0x3c, 0x8e, 0x23, 0xc7, 0xdf,
+                0xe0, 0xae, 0x62, 0xe9, 0x64, 0x54, 0xb5, 0x67, 0xef, 0x0c, 0xcc, 0x2e, 0xc6, 0x2e, 0xe6, 0xf2,
+                0x91, 0x92, 0xff, 0x9d, 0x83, 0xb9, 0xab, 0x9d, 0x85, 0x5b, 0xbc, 0xfd, 0xea, 0x0f, 0x34, 0x57,
+                0xbd, 0x89, 0xdd, 0x38, 0xcb, 0xc9, 0xa6, 0x4d, 0x75, 0xb3, 0x47, 0x1e, 0xb6, 0xf1, 0xef, 0xc5,
+                0x60, 0x0e, 0xfa, 0xeb, 0x59, 0x28, 0xe0, 0x64, 0x01, 0x5f, 0x1d, 0xf3, 0xb9, 0x2c, 0xac, 0x9d,
+                0x74, 0x95, 0x32, 0xf6, 0xc1, 0x54, 0x2a, 0xfa, 0xdd, 0xfe, 0x30, 0x67, 0x32, 0x91, 0xd3, 0x15,
+                0xf9, 0x88, 0xea, 0xe5, 0xa3, 0xb3, 0xdd, 0xcf, 0x02, 0x8d, 0xd6, 0xa2, 0xd7, 0xee, 0xf1, 0x72,
+                0x2b, 0x1b, 0x3d, 0xda, 0x9b, 0x6d, 0x8f, 0x3d, 0x52, 0x9c, 0x6c, 0x75, 0xc5, 0xc2, 0x39, 0x76,
+                0x38, 0x95, 0xe8, 0xd4, 0x9c, 0xe3, 0xe8, 0x6a, 0x03, 0xfd, 0x31, 0x14, 0xf2, 0x41, 0x7a, 0x6a,
+                0x1b, 0xdd, 0xf3, 0xb1, 0xb1, 0x7c, 0x58, 0x06, 0xbc, 0xf7, 0xb7, 0xdd, 0xea, 0xcc, 0xc1, 0x8f,
+                0xb6, 0x65, 0x53, 0x55, 0x41, 0x79, 0xc9, 0xe3, 0x4b, 0xa8, 0xed, 0x7f, 0xef, 0xc7, 0x62, 0xdf,
+                0xd0, 0xfa, 0x4e, 0x7d, 0xf4, 0x47, 0x42, 0xe8, 0x0f, 0xbf, 0xef, 0xe8, 0xf4, 0xc7, 0xeb, 0xeb,
+                0xab, 0xd9, 0xb8, 0x71, 0x02, 0xf7, 0x65, 0x97, 0x79, 0xd8, 0xd8, 0xb1, 0x5e, 0x76, 0xf7, 0x1c,
+                0x3b, 0xb3, 0xd7, 0xe5, 0x7f, 0xa6, 0x25, 0xe8, 0xd2, 0xe3, 0x6d, 0x81, 0x3c, 0xd0, 0xd9, 0x7b,
+                0x89, 0x7c, 0x8e, 0x2a, 0xfa, 0x1e, 0x23, 0x3b, 0xfe, 0xa4, 0x46, 0x0f, 0x0e, 0x01, 0xfe, 0x74,
+                0x4a, 0x66, 0x11, 0xd2, 0xb7, 0x81, 0xc6, 0xc1, 0xd5, 0x1f, 0x57, 0x4c, 0x70, 0x73, 0xfc, 0x2b,
+                0x9e, 0xab, 0x65, 0xeb, 0xd7, 0x56, 0xd3, 0x3c, 0xbc, 0xec, 0x27, 0xd7, 0xba, 0xd8, 0xf6, 0x2d,
+                0xc6, 0xfb, 0x19, 0xed, 0x0c, 0xe8, 0xf1, 0x3f, 0x5f, 0xe8, 0x9c, 0xd2, 0x3d, 0xad, 0xd0, 0xb3,
+                0x3e, 0x97, 0x79, 0x50, 0xb1, 0xbb, 0xed, 0x66, 0x5a, 0x73, 0x0f, 0xc7, 0xff, 0xda, 0x3a, 0x71,
+                0xd6, 0x37, 0x6d, 0xa8, 0x62, 0x93, 0x26, 0x79, 0xd8, 0xc4, 0x89, 0x1e, 0xba, 0xa6, 0xdf, 0x5f,
+                0x33, 0xed, 0x7d, 0x67, 0x2e, 0xfe, 0x4c, 0x6c, 0x1e, 0x30, 0x0a, 0xff, 0x29, 0x3a, 0x7b, 0x47,
+                0x2a, 0x36, 0x0e, 0x3a, 0x5c, 0xeb, 0x13, 0xd1, 0x7d, 0xef, 0xe1, 0x5e, 0xf8, 0x4d, 0xf9, 0xb0,
+                0x58, 0xab, 0xcd, 0x5c, 0x87, 0x3c, 0xfd, 0x54, 0x5d, 0xd1, 0xf8, 0xf1, 0x8c, 0x91, 0xdc, 0x6f,
+                0xdd, 0x5c, 0xc5, 0xa6, 0x92, 0x4e, 0xba, 0xf4, 0x52, 0x2f, 0x7b, 0xf6, 0x99, 0xde, 0xf7, 0x05,
+                0x1a, 0xea, 0xfa, 0xc8, 0x7b, 0x77, 0x2a, 0x3e, 0xe9, 0xfd, 0xf7, 0x43, 0x27, 0x41, 0xf7, 0x68,
+                0xae, 0xa7, 0xe9, 0xac, 0x4e, 0x50, 0xf1, 0x93, 0x3c, 0x3d, 0x8b, 0xeb, 0xa1, 0x26, 0x47, 0x5e,
+                0x2c, 0xb3, 0x66, 0xb9, 0xb2, 0x58, 0xfe, 0xf0, 0x50, 0x71, 0x32, 0xb6, 0x7d, 0xab, 0x25, 0xfb,
+                0x0c, 0xe6, 0xa2, 0xfd, 0xcd, 0x5c, 0x61, 0x61, 0x33, 0x67, 0x8a, 0x77, 0x3e, 0xf0, 0x6b, 0x3b,
+                0x73, 0xda, 0xcc, 0xdc, 0xa7, 0xd3, 0xe3, 0x4f, 0xa7, 0x3b, 0xbf, 0xdd, 0xdd, 0x2d, 0x8f, 0xd5,
+                0x5c, 0x33, 0x91, 0x3d, 0xfa, 0xa6, 0x56, 0x7e, 0x08, 0xff, 0xaf, 0xf0, 0x5b, 0xb8, 0xd5, 0x6b,
+                0x88, 0x03, 0xf6, 0x67, 0xea, 0x14, 0x77, 0x16, 0xcb, 0x55, 0x57, 0xb9, 0x59, 0x5d, 0x75, 0x61,
+                0x7d, 0xf4, 0x0e, 0xc9, 0x0a, 0xee, 0xc7, 0x3a, 0x1b, 0xd9, 0xb0, 0x1a, 0x8b, 0x85, 0xdb, 0x07,
+                0xdc, 0x73, 0xeb, 0x2d, 0x4e, 0x16, 0x0c, 0xb6, 0xe8, 0xf1, 0x7f, 0xc8, 0xcf, 0x67, 0x26, 0x76,
+                0xbf, 0x98, 0x4b, 0xec, 0x25, 0x63, 0x9d, 0x1f, 0x9b, 0x8a, 0xdf, 0x23, 0x1d, 0x81, 0xbc, 0x58,
+                0xfe, 0xf4, 0xc7, 0xba, 0xac, 0x1e, 0xb9, 0xe2, 0x0a, 0x0f, 0x9b, 0x30, 0xc1, 0xc3, 0xfe, 0xf4,
+                0x74, 0x1d, 0x97, 0xf1, 0x7c, 0xcf, 0xac, 0xfb, 0x4b, 0x0d, 0x7f, 0x06, 0x73, 0xcf, 0x77, 0x4f,
+                0x7d, 0xad, 0x99, 0xdd, 0x7e, 0x9b, 0x83, 0xdf, 0x37, 0x7d, 0x7a, 0x03, 0x73, 0xd8, 0x73, 0xe4,
+                0xdf, 0xab, 0xc8, 0xf7, 0xab, 0xd4, 0x3e, 0xd8, 0xb9, 0x53, 0xfe, 0xba, 0x31, 0xfe, 0xf8, 0x59,
+                0xaa, 0xae, 0xcf, 0x37, 0xce, 0x9a, 0xd5, 0x02, 0xcb, 0x0b, 0xcb, 0x6b, 0x99, 0xa5, 0xd2, 0x42,
+                0x63, 0x8a, 0x75, 0xbb, 0xe3, 0x76, 0x27, 0xdb, 0xf6, 0x9e, 0xf1, 0x5e, 0xbc, 0xb4, 0xb2, 0x96,
+                0xdf, 0x83, 0x35, 0xee, 0x6f, 0x9f, 0x9c, 0x36, 0x13, 0xbb, 0xf7, 0x1e, 0xb1, 0xbf, 0xa5, 0xa5,
+                0x5e, 0xb6, 0x61, 0x83, 0xb0, 0x5f, 0x14, 0xc3, 0xaf, 0x55, 0xf0, 0x37, 0xf7, 0x17, 0x87, 0x85,
+                0xc3, 0xe1, 0x2f, 0x70, 0xdb, 0x4c, 0x7e, 0x46, 0xbe, 0x31, 0x96, 0x3d, 0x29, 0xd6, 0xff, 0x9d,
+                0x0d, 0xd5, 0x59, 0xdd, 0x52, 0xbe, 0xc8, 0xca, 0x75, 0x3a, 0xe4, 0x03, 0x7f, 0x3b, 0xac, 0xb9,
+                0x7b, 0xf1, 0xdc, 0x33, 0xe2, 0x99, 0x39, 0x77, 0x39, 0x0a, 0xfb, 0xca, 0xe1, 0x26, 0xf6, 0xc4,
+                0x13, 0xa1, 0xac, 0x8c, 0x2e, 0x59, 0x12, 0x62, 0x89, 0x44, 0xe4, 0x21, 0xd8, 0x56, 0xf2, 0xc3,
+                0x43, 0x7e, 0xbf, 0xff, 0xf3, 0xfd, 0xfb, 0x0d, 0x22, 0xde, 0x80, 0xcf, 0x6a, 0xf4, 0xfe, 0xdf,
+                0xfd, 0xa6, 0x9e, 0x63, 0xc5, 0x5a, 0x69, 0xaf, 0xbf, 0xf9, 0x5a, 0x35, 0x9b, 0x36, 0x4d, 0xac,
+                0xdd, 0xcc, 0x19, 0x2e, 0xf6, 0xb7, 0xbf, 0xf6, 0x3e, 0xbf, 0xe4, 0x71, 0xe1, 0x3f, 0xfc, 0xe6,
+                0xd7, 0xf5, 0x05, 0xf1, 0xc3, 0xe7, 0xc6, 0xf8, 0xcb, 0x96, 0xf6, 0xce, 0x61, 0xc6, 0xf4, 0x06,
+                0xb7, 0xdd, 0xde, 0x51, 0x0a, 0xf9, 0x2e, 0x68, 0x03, 0x32, 0x72, 0x2d, 0x9e, 0x87, 0xef, 0x64,
+                0xf4, 0x7e, 0xc8, 0xe8, 0x8c, 0x19, 0xc6, 0x72, 0x8c, 0xb3, 0x7c, 0xef, 0x5c, 0x7b, 0x76, 0xdc,
+                0x79, 0xf7, 0xd9, 0xb9, 0x8c, 0x3d, 0x38, 0xbf, 0x9e, 0x7f, 0x7f, 0xb4, 0x80, 0xdf, 0x13, 0x24,
+                0x9f, 0x5b, 0x7b, 0x6e, 0x5f, 0x5d, 0xd3, 0x4a, 0x6b, 0xe5, 0x53, 0xcf, 0x7e, 0xcb, 0x25, 0x97,
+                0x34, 0x7c, 0xa7, 0x30, 0x7e, 0x1e, 0x87, 0xb0, 0xb6, 0x66, 0x63, 0x8c, 0x38, 0x83, 0xf7, 0x10,
+                0xc6, 0xfe, 0x70, 0x3c, 0x4f, 0x67, 0xe3, 0xf2, 0xcb, 0x85, 0xbd, 0x1a, 0x37, 0xce, 0xc3, 0xc6,
+                0x8c, 0x11, 0xf3, 0x59, 0x38, 0x3f, 0x3f, 0xfe, 0xe6, 0x26, 0x3b, 0xf7, 0x0d, 0xf5, 0x7a, 0x73,
+                0xfd, 0xba, 0xb6, 0x1e, 0x7a, 0xf6, 0x80, 0xb2, 0x26, 0xbb, 0xa8, 0x8d, 0xef, 0x49, 0xca, 0x3f,
+                0x22, 0x9c, 0x35, 0xa4, 0x87, 0x7e, 0x02, 0xbd, 0x94, 0x83, 0x5f, 0xf8, 0x9c, 0xdc, 0xc7, 0xd4,
+                0x8f, 0x01, 0xb9, 0x86, 0x1d, 0x2d, 0x7b, 0xac, 0xb0, 0xde, 0xaf, 0xdc, 0x66, 0x61, 0xb3, 0x6f,
+                0xce, 0xf5, 0xdb, 0xe0, 0x03, 0x41, 0x97, 0xea, 0xef, 0xc5, 0x5a, 0x21, 0xc6, 0x34, 0xf0, 0xd1,
+                0xc2, 0xa4, 0xf3, 0xcf, 0xa0, 0x67, 0xaf, 0xa2, 0xb6, 0x57, 0x9c, 0x6b, 0xdf, 0x47, 0x89, 0x2e,
+                0x79, 0x9f, 0x12, 0x07, 0xec, 0xd2, 0xc7, 0x32, 0xdc, 0xff, 0xa4, 0xdf, 0x62, 0xd1, 0x96, 0x3e,
+                0xe3, 0x6c, 0x7e, 0x5b, 0xe8, 0xf1, 0xd5, 0x2f, 0x16, 0xe7, 0xcf, 0xc1, 0xd6, 0x6a, 0xf1, 0x8f,
+                0x19, 0xe3, 0xc9, 0xf1, 0x77, 0x7c, 0x2e, 0x9c, 0x57, 0x7f, 0x3e, 0xff, 0xd2, 0xd7, 0xd3, 0x13,
+                0x39, 0x55, 0x8d, 0x9b, 0x6e, 0xbe, 0x39, 0xf0, 0x63, 0x7a, 0xc7, 0x8e, 0x89, 0x13, 0x85, 0x6d,
+                0x6b, 0x0e, 0x46, 0xf8, 0xdc, 0xf4, 0xf2, 0xc3, 0xf7, 0x46, 0xf1, 0xb5, 0xf5, 0x78, 0x5e, 0x5e,
+                0x25, 0x74, 0xe7, 0x96, 0x77, 0xab, 0x8a, 0xc2, 0x8f, 0x38, 0x65, 0xd2, 0xc4, 0x5e, 0x7b, 0x77,
+                0xcf, 0x5c, 0x47, 0x8e, 0x7f, 0x1c, 0x8b, 0x86, 0x8c, 0xb1, 0x93, 0x6c, 0xec, 0xde, 0xdd, 0x79,
+                0xb2, 0xc0, 0xde, 0x31, 0x92, 0xce, 0xa4, 0x8b, 0xb0, 0x8e, 0x19, 0x35, 0xca, 0x77, 0x36, 0xe1,
+                0x4f, 0x2d, 0x2e, 0x6f, 0x86, 0x4c, 0x26, 0x26, 0x4c, 0xb0, 0x7e, 0xd1, 0x88, 0x63, 0x52, 0xdf,
+                0x83, 0x98, 0x47, 0x8b, 0xe7, 0xc9, 0x27, 0xac, 0x5c, 0x06, 0x06, 0x12, 0x07, 0x22, 0x76, 0x59,
+                0xf4, 0xa8, 0x8d, 0xbd, 0xfb, 0x76, 0x95, 0x26, 0x1e, 0xaf, 0xa1, 0xd8, 0x2d, 0x9c, 0x67, 0xdd,
+                0x63, 0x6f, 0xa8, 0x3a, 0x12, 0x5c, 0x06, 0x5d, 0xdb, 0x2b, 0xfc, 0x1f, 0xf9, 0x46, 0x5c, 0xbb,
+                0xf8, 0x62, 0xff, 0xa9, 0xb4, 0x16, 0xd5, 0xca, 0x7e, 0x96, 0xe7, 0xf1, 0x43, 0xff, 0x81, 0x67,
+                0xf4, 0x31, 0x16, 0xf4, 0xdf, 0xf5, 0xd7, 0xbb, 0x8e, 0xca, 0x17, 0x45, 0x5c, 0x9f, 0x4e, 0x76,
+                0x1a, 0x62, 0x27, 0xbf, 0x7e, 0x25, 0xf8, 0x0c, 0xc8, 0x0d, 0xfd, 0xbd, 0x45, 0xf3, 0xdb, 0x07,
+                0xa4, 0x3b, 0xaf, 0x53, 0xf1, 0xd1, 0x1c, 0x3e, 0x4f, 0xf8, 0x97, 0x53, 0xdb, 0x43, 0xed, 0x34,
+                0x03, 0xfc, 0x3e, 0x3c, 0xd7, 0x12, 0xcc, 0xb5, 0x97, 0xb7, 0xde, 0xe2, 0xe0, 0x3a, 0xf1, 0x48,
+                0xb1, 0xfb, 0x48, 0x66, 0x52, 0x79, 0xb0, 0x83, 0x0b, 0x55, 0xf4, 0xdf, 0x68, 0x85, 0xd3, 0xd8,
+                0x87, 0x38, 0x10, 0x7b, 0xa0, 0xca, 0x92, 0xfe, 0x43, 0xd8, 0x6f, 0x20, 0x99, 0x5a, 0xd1, 0x17,
+                0x7f, 0xec, 0x0d, 0xbc, 0x13, 0xb1, 0x57, 0xaf, 0x6d, 0x37, 0xb3, 0x89, 0x57, 0xb8, 0xd9, 0x92,
+                0xc5, 0xd6, 0x23, 0xc6, 0x8f, 0xf7, 0x19, 0x60, 0x3f, 0x4c, 0x7e, 0xe3, 0xef, 0xc0, 0x43, 0x93,
+                0x3e, 0x9c, 0x4f, 0xdf, 0x2b, 0x81, 0x19, 0x5c, 0x58, 0x31, 0xdc, 0xc2, 0xd8, 0xb1, 0xee, 0xd3,
+                0x2f, 0xb8, 0x20, 0x74, 0x52, 0x8e, 0x0e, 0x4a, 0xc7, 0x1e, 0xc7, 0xbb, 0xe5, 0xce, 0x60, 0xd6,
+                0x3f, 0xbc, 0xe1, 0x06, 0xe1, 0xe3, 0x5e, 0x4d, 0x36, 0xf6, 0xed, 0xb7, 0xaa, 0x06, 0xce, 0x7f,
+                0x78, 0xaa, 0x7b, 0xf9, 0x8f, 0x1c, 0xbf, 0x38, 0x36, 0x5f, 0xf5, 0xbd, 0xfe, 0xfe, 0xf7, 0xf0,
+                0x97, 0xfb, 0xb5, 0x4d, 0x29, 0xf9, 0x15, 0xce, 0xdd, 0x68, 0x64, 0xc9, 0xe8, 0x43, 0xf1, 0xcd,
+                0x5d, 0x82, 0x5f, 0x6d, 0x57, 0x7c, 0x1e, 0xab, 0x46, 0x07, 0x7a, 0xd9, 0x7b, 0x9b, 0xaa, 0x8e,
+                0x8a, 0x7f, 0xca, 0x95, 0x9b, 0xf8, 0x59, 0x45, 0xf2, 0x7c, 0x43, 0x78, 0xbc, 0xc2, 0xe7, 0x1c,
+                0xfd, 0x6b, 0x01, 0xfc, 0x97, 0xab, 0xef, 0xe7, 0x71, 0xd2, 0xbb, 0x16, 0x1e, 0xeb, 0x01, 0x3f,
+                0xb8, 0x84, 0xa3, 0xe4, 0xff, 0xb4, 0x2d, 0x35, 0x10, 0x1e, 0x0a, 0x79, 0x24, 0xc8, 0x76, 0x77,
+                0x77, 0xe4, 0xc2, 0x82, 0xdc, 0x8f, 0x32, 0x86, 0x1a, 0x4b, 0x9a, 0x28, 0x4e, 0x42, 0xdc, 0x6d,
+                0xda, 0x56, 0x38, 0x5e, 0x41, 0xfc, 0x8c, 0xe7, 0xe0, 0xcf, 0xb4, 0x36, 0xbb, 0xf2, 0xeb, 0xf9,
+                0xb4, 0xbc, 0x46, 0x1d, 0xd3, 0x6a, 0x1d, 0x3c, 0x6e, 0x1f, 0x3a, 0x8c, 0x9f, 0x7f, 0xd8, 0xb9,
+                0x80, 0x23, 0x8f, 0x3c, 0x57, 0xb1, 0x26, 0x8a, 0x53, 0x43, 0xf4, 0x3b, 0x38, 0x38, 0xf8, 0x1b,
+                0x32, 0xd9, 0x6c, 0x70, 0xfa, 0x46, 0x7e, 0x4c, 0x8e, 0xcc, 0x93, 0x0e, 0x02, 0x1f, 0x4d, 0xcf,
+                0xae, 0xf3, 0xba, 0x4c, 0xeb, 0xbd, 0x0e, 0xd3, 0x72, 0xc2, 0xff, 0xe5, 0xde, 0xf1, 0xcb, 0x4f,
+                0xd0, 0xe2, 0xd9, 0xb8, 0x71, 0x63, 0xc9, 0x40, 0xe7, 0x00, 0xdf, 0x83, 0x9f, 0xe1, 0x48, 0x88,
+                0xcb, 0x2e, 0xce, 0x72, 0x9c, 0xe2, 0x9a, 0x54, 0xa2, 0xb3, 0x10, 0xaf, 0xc4, 0xf4, 0x1c, 0x34,
+                0x9e, 0x0d, 0xb7, 0xf8, 0xc8, 0x47, 0xab, 0x67, 0x8d, 0x9e, 0xdc, 0xb3, 0xe3, 0x71, 0x56, 0xbe,
+                0xae, 0xe2, 0x6b, 0x70, 0x9a, 0xcf, 0xf7, 0x3a, 0xcd, 0x6f, 0x69, 0xe7, 0xe2, 0x75, 0x58, 0x2e,
+                0xa6, 0xfb, 0x3a, 0x3c, 0x8e, 0xca, 0x19, 0x03, 0x92, 0xb5, 0x5c, 0xfb, 0x51, 0x54, 0xc3, 0xba,
+                0x63, 0x5d, 0x3b, 0xc8, 0xa7, 0x81, 0xed, 0xe8, 0x8f, 0xc7, 0xc8, 0x36, 0xc2, 0xc7, 0x71, 0x3a,
+                0x4d, 0x4f, 0x2b, 0xd7, 0xc2, 0x5a, 0x1c, 0x1e, 0x4f, 0xc5, 0xb9, 0x74, 0xcd, 0x41, 0xfb, 0xb4,
+                0x32, 0x1c, 0xde, 0xf8, 0x85, 0xa2, 0xd7, 0x3f, 0x13, 0xfb, 0xf3, 0xa0, 0x63, 0xed, 0xdb, 0xfe,
+                0x09, 0x59, 0x09, 0x59, 0x2c, 0x27, 0xd1, 0xdf, 0x7b, 0xf9, 0x35, 0x97, 0xe9, 0x8d, 0xc1, 0x38,
+                0x03, 0x6a, 0xac, 0x2f, 0x78, 0xc4, 0x4e, 0x16, 0x8d, 0x34, 0x93, 0xfd, 0xf1, 0x91, 0x1c, 0x78,
+                0xb8, 0x2e, 0x1f, 0x04, 0x5e, 0xeb, 0x63, 0xaf, 0xc3, 0xfc, 0x32, 0xc6, 0xf2, 0x39, 0x4c, 0xb3,
+                0xbd, 0x2e, 0xf3, 0x66, 0x9f, 0xa3, 0xf2, 0x0e, 0x87, 0xa3, 0xe2, 0x94, 0xc1, 0xc0, 0x1f, 0x6a,
+                0xaa, 0x5f, 0x09, 0xdd, 0xd1, 0xda, 0xe2, 0x3e, 0xdc, 0x44, 0xfe, 0x16, 0x7c, 0xb9, 0x58, 0xac,
+                0x95, 0xcf, 0xa7, 0x43, 0x63, 0x97, 0x8b, 0x68, 0x87, 0xa9, 0x75, 0xf9, 0x9c, 0xa6, 0xad, 0xd4,
+                0x2f, 0x23, 0x79, 0xbf, 0xb5, 0xc1, 0xb5, 0xfd, 0xa2, 0xca, 0xca, 0xca, 0xa1, 0xc7, 0x32, 0x97,
+                0x45, 0xe7, 0xa8, 0x4a, 0xcd, 0xbf, 0xe2, 0xfc, 0x02, 0x8b, 0x7a, 0x76, 0xc1, 0xad, 0x1a, 0x63,
+                0x35, 0x7f, 0x40, 0xbd, 0x5f, 0xe8, 0x14, 0xf3, 0x03, 0x1e, 0x87, 0x79, 0x72, 0x83, 0x75, 0xfb,
+                0x37, 0x8f, 0x47, 0xae, 0xd6, 0xef, 0x31, 0xaf, 0x15, 0xb1, 0x74, 0x94, 0xeb, 0x47, 0x55, 0xaf,
+                0x0b, 0x5e, 0xd7, 0xfc, 0x6f, 0x15, 0x27, 0xe9, 0x85, 0x85, 0xd0, 0x0d, 0x8d, 0x8e, 0x8a, 0xef,
+                0xea, 0x63, 0xb9, 0xe3, 0xf9, 0xa1, 0xd8, 0xa8, 0x8c, 0x62, 0x8c, 0x8f, 0x1b, 0xbc, 0x35, 0x11,
+                0xc2, 0xb9, 0x91, 0x7c, 0xfe, 0x72, 0x92, 0xd3, 0x59, 0xd0, 0x71, 0x7a, 0xfd, 0xfc, 0x69, 0xfc,
+                0x1c, 0x6b, 0xf9, 0x3c, 0x06, 0x79, 0x72, 0xfa, 0x88, 0xfe, 0x80, 0xd2, 0x27, 0x95, 0x5e, 0x12,
+                0xfd, 0x7e, 0xa5, 0x4f, 0x4a, 0x65, 0xbc, 0x97, 0x44, 0xbf, 0x5f, 0x92, 0x4a, 0xd1, 0x27, 0x95,
+                0x9e, 0x5e, 0x36, 0x82, 0xfa, 0x83, 0x4a, 0x4f, 0x97, 0xa5, 0x61, 0x12, 0x1e, 0xe5, 0x3d, 0x2e,
+                0x4b, 0xb4, 0x32, 0x49, 0xa5, 0xe7, 0x01, 0xd4, 0x24, 0xa5, 0x2f, 0x53, 0x7a, 0xa6, 0xf4, 0x0e,
+                0xa5, 0xf7, 0x48, 0x92, 0x0d, 0x7d, 0x50, 0xe9, 0xd7, 0x2a, 0xbd, 0x55, 0xf4, 0x43, 0x94, 0x1e,
+                0xcf, 0xd9, 0x94, 0xf7, 0xf0, 0x7e, 0xb4, 0x18, 0xa7, 0xa4, 0x44, 0xf4, 0x43, 0x97, 0x89, 0xfe,
+                0x2b, 0x1e, 0xd1, 0x9f, 0x91, 0x11, 0xfd, 0x45, 0x7b, 0x45, 0x3f, 0xe7, 0x10, 0xef, 0x87, 0x24,
+                0x18, 0xef, 0x4b, 0x18, 0x8d, 0xb3, 0x07, 0xfd, 0x73, 0x4a, 0x9f, 0x50, 0x7a, 0xc6, 0x7b, 0x49,
+                0xe9, 0x87, 0x74, 0x89, 0xbe, 0xe4, 0xcc, 0x32, 0xd1, 0x8f, 0xa0, 0xef, 0xb4, 0x2a, 0x25, 0x65,
+                0xe2, 0x7a, 0xa9, 0xb8, 0x6f, 0x18, 0x5f, 0xb2, 0x3d, 0x25, 0x62, 0x9d, 0xf7, 0x97, 0xf5, 0xae,
+                0x37, 0x7a, 0xd4, 0x69, 0xa1, 0x3a, 0x6b, 0x82, 0xb6, 0x4e, 0x6b, 0xf8, 0x71, 0x91, 0x83, 0x21,
+                0xe9, 0x74, 0xfc, 0xc7, 0xc7, 0xbb, 0xf6, 0x28, 0x9d, 0x8e, 0x5c, 0xf6, 0x49, 0xd7, 0x0e, 0xc1,
+                0x47, 0x07, 0xf7, 0xac, 0xe4, 0x6b, 0x2a, 0x8e, 0x61, 0x6d, 0xd8, 0x79, 0xda, 0xda, 0x9f, 0x6c,
+                0x9e, 0x90, 0xdb, 0x49, 0x13, 0xf7, 0x61, 0xe9, 0xfa, 0x21, 0xd4, 0x08, 0x1d, 0xab, 0xda, 0x1d,
+                0xcc, 0x95, 0xd7, 0x09, 0x90, 0x4f, 0xa9, 0xcf, 0x97, 0xb5, 0x90, 0x4f, 0x2d, 0xf6, 0x40, 0x5e,
+                0x37, 0x88, 0xb5, 0x37, 0xff, 0x53, 0xb9, 0xfd, 0xb6, 0x82, 0x79, 0x5c, 0x33, 0xeb, 0x8a, 0xf3,
+                0x7d, 0x38, 0x60, 0xc4, 0x71, 0x15, 0xfa, 0xf4, 0x24, 0x22, 0xe7, 0xf0, 0xda, 0x19, 0x8a, 0xaf,
+                0x54, 0xff, 0x09, 0x7e, 0x5e, 0x93, 0xaf, 0xf8, 0x9c, 0x59, 0xa8, 0xc9, 0xae, 0xae, 0xc1, 0x73,
+                0xc5, 0x8c, 0x19, 0x8f, 0xc7, 0x87, 0x69, 0x6b, 0x5f, 0xf8, 0xfa, 0x92, 0xcf, 0x86, 0xf8, 0x04,
+                0x7b, 0xda, 0x9b, 0x4b, 0x2c, 0xde, 0x47, 0xeb, 0x12, 0xfe, 0xd2, 0xde, 0x4c, 0x26, 0xfc, 0xd5,
+                0x22, 0xd6, 0x97, 0xe7, 0x9e, 0xe1, 0xd3, 0xc2, 0x9f, 0x35, 0xaa, 0xa3, 0xa8, 0x31, 0x9b, 0xd9,
+                0x95, 0x57, 0x7a, 0x38, 0x8f, 0x83, 0xbf, 0x0d, 0x63, 0x55, 0x8a, 0x2f, 0x90, 0xff, 0x6d, 0x23,
+                0x3f, 0xb3, 0xa3, 0xad, 0x51, 0x59, 0x83, 0xe8, 0x63, 0xb9, 0x71, 0x68, 0xfc, 0x6c, 0xac, 0x2f,
+                0x6a, 0x1b, 0x39, 0xd7, 0x98, 0x14, 0x35, 0x05, 0x88, 0xc7, 0x8a, 0xad, 0x23, 0x00, 0x0f, 0x6f,
+                0xb8, 0xee, 0x41, 0x87, 0x91, 0xbf, 0xbe, 0x13, 0x1c, 0xa8, 0xc2, 0xcf, 0xde, 0xa8, 0xca, 0x2f,
+                0xe2, 0xbd, 0x50, 0xc0, 0x51, 0xf4, 0x7a, 0x5a, 0xb6, 0x5b, 0xd8, 0xf8, 0xf1, 0x5e, 0x9e, 0xf3,
+                0x9c, 0x3e, 0xdd, 0xc5, 0x56, 0xbd, 0x50, 0xdb, 0x6f, 0xbd, 0x97, 0xd8, 0x4f, 0xf9, 0x3e, 0xe4,
+                0x35, 0x51, 0x23, 0xa4, 0x72, 0x03, 0x18, 0xfb, 0x48, 0xea, 0x10, 0xc0, 0x5b, 0x22, 0x77, 0x82,
+                0x3c, 0x02, 0xf2, 0x96, 0xd7, 0xce, 0x74, 0xf1, 0x7c, 0x4f, 0x2f, 0x9f, 0x99, 0x93, 0x37, 0xde,
+                0xc7, 0xf5, 0x53, 0x32, 0x76, 0x29, 0x6a, 0xc1, 0xd4, 0xfa, 0x45, 0x35, 0xb6, 0xf7, 0xeb, 0x6a,
+                0x92, 0x6c, 0x35, 0x66, 0x76, 0xff, 0x3c, 0x3b, 0x5f, 0xe3, 0x7c, 0xe3, 0xe3, 0x1e, 0xac, 0xbd,
+                0x9a, 0x3b, 0x06, 0xaf, 0x34, 0xeb, 0x06, 0x27, 0xfb, 0xc5, 0x1c, 0x07, 0xcf, 0xdf, 0xa1, 0xce,
+                0x44, 0x53, 0xb3, 0x15, 0x82, 0x4c, 0x2b, 0x75, 0x3a, 0x07, 0xbb, 0xd3, 0xd1, 0x25, 0xe0, 0x45,
+                0xd5, 0xd8, 0xbc, 0x59, 0x97, 0x5f, 0x41, 0xbe, 0x47, 0xdd, 0xdb, 0xbf, 0xbc, 0x62, 0xcc, 0x8f,
+                0x83, 0x7b, 0xc0, 0xef, 0xab, 0x56, 0xd6, 0xe6, 0x60, 0x42, 0xce, 0x13, 0x6b, 0x61, 0xad, 0xf1,
+                0x6a, 0xb9, 0xcc, 0xb7, 0x90, 0x5b, 0xe6, 0x7a, 0x99, 0xd6, 0x5c, 0x1f, 0x5b, 0xb7, 0xb5, 0x78,
+                0xfb, 0xac, 0xed, 0x94, 0x29, 0x6e, 0x76, 0xd3, 0x8d, 0x2e, 0x2e, 0xe3, 0x58, 0x63, 0x7d, 0x1e,
+                0x6d, 0xd3, 0x46, 0xc1, 0xc7, 0xa3, 0x9e, 0x42, 0x9f, 0xf7, 0x9b, 0xf3, 0x73, 0x07, 0x03, 0xb7,
+                0x5e, 0xb1, 0xad, 0x5d, 0xe5, 0x23, 0xcb, 0x08, 0xc3, 0x6f, 0x8d, 0xea, 0x0e, 0x48, 0x1e, 0xb6,
+                0xa2, 0x26, 0x4d, 0x3f, 0x3f, 0xe4, 0x52, 0xc1, 0x15, 0x55, 0x6c, 0xa9, 0xe2, 0x79, 0x6e, 0xd4,
+                0x37, 0xbc, 0xf1, 0xb7, 0xde, 0xb1, 0x50, 0x3b, 0x80, 0xf1, 0x91, 0x77, 0xef, 0xbb, 0x3e, 0x55,
+                0x6c, 0xd1, 0xa2, 0x66, 0x2e, 0x1f, 0xcb, 0xff, 0x1c, 0x62, 0xe9, 0x44, 0xec, 0xa6, 0x4c, 0x2a,
+                0xba, 0xc2, 0xa8, 0x76, 0x18, 0xb1, 0x6d, 0x4c, 0xce, 0xcd, 0x4f, 0x54, 0x9b, 0xcc, 0x3c, 0x7f,
+                0xa8, 0xea, 0x17, 0x70, 0xf7, 0x0b, 0xe6, 0xd7, 0x73, 0xbe, 0x0d, 0x3d, 0xf2, 0xe6, 0xab, 0x57,
+                0x89, 0x3c, 0x28, 0xd6, 0xbc, 0x0f, 0xaf, 0x4c, 0xe7, 0x08, 0xb5, 0x1f, 0xe0, 0xe6, 0x71, 0xcf,
+                0x94, 0x29, 0x8d, 0x9b, 0x5b, 0x5a, 0xa2, 0x93, 0xf3, 0xc4, 0xa6, 0xf3, 0x70, 0xe6, 0xb5, 0xcf,
+                0x63, 0x9e, 0x3f, 0xbd, 0xbe, 0x2f, 0x37, 0xb6, 0x76, 0x4d, 0x0d, 0x9b, 0x3c, 0x59, 0xe4, 0x9a,
+                0xaf, 0xb9, 0xc6, 0xc5, 0xe7, 0xa7, 0xcf, 0x35, 0x23, 0x3e, 0x4c, 0x74, 0xb5, 0x67, 0xf7, 0x7e,
+                0xc5, 0x8a, 0xd6, 0x7d, 0x84, 0xe1, 0x30, 0x35, 0xcf, 0xb4, 0x69, 0xde, 0x33, 0x90, 0x73, 0x85,
+                0xce, 0xd1, 0xe4, 0x89, 0xaf, 0xe6, 0x39, 0x4a, 0x0d, 0x17, 0xb2, 0xfc, 0xd9, 0x5a, 0xf6, 0xab,
+                0x3c, 0xdc, 0x34, 0xf2, 0x7a, 0x37, 0x6b, 0x72, 0x49, 0x4b, 0x97, 0xf4, 0x9e, 0x11, 0x70, 0xf4,
+                0xba, 0x5a, 0x8d, 0x7f, 0xa1, 0x36, 0x63, 0xd4, 0x28, 0xdf, 0x75, 0x74, 0xef, 0xbe, 0x05, 0x0b,
+                0x82, 0x1f, 0x8a, 0x33, 0x10, 0x7d, 0x5a, 0x8d, 0x8f, 0x78, 0x6d, 0xa6, 0x8e, 0xdf, 0x7f, 0xf4,
+                0x0f, 0x36, 0x9e, 0x9f, 0xc8, 0x77, 0xf6, 0xa0, 0x6b, 0x54, 0xfe, 0x73, 0xe3, 0x9b, 0x42, 0x26,
+                0x50, 0xdb, 0x95, 0xcb, 0x55, 0xc5, 0x7a, 0x32, 0x99, 0xae, 0x0b, 0x90, 0x1f, 0xc7, 0x79, 0x1b,
+                0x3b, 0xd6, 0x3d, 0xf5, 0xbe, 0xfb, 0x9a, 0xf6, 0xdd, 0x7f, 0x7f, 0xa0, 0x6b, 0xd6, 0xac, 0x5e,
+                0x0e, 0x4a, 0xe4, 0x72, 0xe5, 0x43, 0xad, 0x9a, 0x1c, 0x21, 0x72, 0x82, 0xaf, 0xbe, 0x9c, 0x3f,
+                0x2f, 0x85, 0xfa, 0x39, 0xe4, 0xf9, 0x55, 0xbd, 0xdf, 0xa7, 0x46, 0x22, 0x23, 0x77, 0xf4, 0xf4,
+                0xc4, 0xcf, 0x24, 0xfd, 0x32, 0x8a, 0xf3, 0xef, 0x29, 0x79, 0x97, 0xc2, 0xb1, 0x9f, 0x47, 0xad,
+                0x9d, 0xd6, 0x63, 0x9e, 0xee, 0x0c, 0xa6, 0xd4, 0xb8, 0x18, 0xed, 0xfa, 0xeb, 0x5c, 0x3c, 0x67,
+                0x57, 0x54, 0x3d, 0x67, 0x9f, 0x9c, 0x57, 0xb4, 0x61, 0xf7, 0xee, 0xf6, 0x6f, 0xd1, 0xb9, 0x5a,
+                0xaa, 0xe4, 0x4e, 0xd6, 0xc0, 0xae, 0xa9, 0x63, 0x8d, 0x1f, 0xef, 0x38, 0x85, 0x30, 0xac, 0x1e,
+                0x37, 0xce, 0x79, 0xb2, 0x36, 0xcf, 0x2b, 0x93, 0x7d, 0xc5, 0xfb, 0xc0, 0x27, 0x97, 0x96, 0x7a,
+                0x98, 0xbd, 0xae, 0x70, 0xdd, 0x8f, 0xdf, 0x53, 0x93, 0xc3, 0xc5, 0xe2, 0x2c, 0xef, 0xda, 0xb5,
+                0xeb, 0x34, 0xc8, 0x34, 0xf4, 0xbd, 0x96, 0x03, 0x87, 0xdd, 0xd5, 0xfa, 0x1f, 0xb4, 0x1f, 0x5f,
+                0xd5, 0xcc, 0x7f, 0x0d, 0xe2, 0x6b, 0xc8, 0xf2, 0x55, 0x57, 0x8a, 0x1c, 0x59, 0xf9, 0xa2, 0xc2,
+                0x79, 0xcd, 0x88, 0xb6, 0x96, 0x55, 0xf8, 0x99, 0xdf, 0xef, 0x87, 0x83, 0x7b, 0x91, 0xeb, 0x5e,
+                0x03, 0x1d, 0x40, 0x76, 0xf0, 0x61, 0xc4, 0xf6, 0xe0, 0x55, 0x90, 0x4f, 0xbd, 0xe6, 0x1a, 0x37,
+                0xb7, 0x6f, 0x85, 0x6a, 0x81, 0x71, 0xc6, 0x8b, 0xe5, 0x9f, 0x33, 0x99, 0xcc, 0x89, 0xf9, 0x6a,
+                0x9e, 0x55, 0x3b, 0xac, 0xb7, 0xf9, 0xa8, 0x85, 0x04, 0xc7, 0x00, 0x1f, 0x04, 0x75, 0x34, 0x9c,
+                0x97, 0x8d, 0x84, 0xfa, 0xf0, 0xb2, 0x38, 0x73, 0xf4, 0x9b, 0x85, 0x9e, 0x79, 0xc8, 0xe5, 0xda,
+                0x3e, 0x42, 0xcf, 0xbb, 0x16, 0xe2, 0x5c, 0xd5, 0x3c, 0x27, 0x38, 0x25, 0xe8, 0x42, 0xf8, 0xd0,
+                0x79, 0x72, 0xc0, 0x2c, 0x45, 0xbf, 0xc9, 0xd1, 0x10, 0x6b, 0x6f, 0x6d, 0xe0, 0x79, 0x6e, 0x6d,
+                0xbd, 0xa6, 0xcf, 0x69, 0xba, 0xd3, 0xe5, 0xb2, 0x7c, 0xc3, 0xe3, 0xac, 0x5c, 0xe5, 0x73, 0x58,
+                0xa6, 0x73, 0xee, 0xc7, 0x6e, 0xba, 0x80, 0xae, 0xc7, 0xdc, 0x6e, 0xcb, 0x39, 0xfd, 0xc5, 0x2b,
+                0x45, 0xf2, 0x8a, 0x07, 0xfb, 0xc9, 0x57, 0x1e, 0xe0, 0xdc, 0xa1, 0xc3, 0xfc, 0x32, 0x5f, 0x3b,
+                0x47, 0x45, 0xb6, 0xa6, 0x13, 0x1c, 0x57, 0x21, 0x3e, 0x86, 0xe6, 0xbc, 0x07, 0x67, 0x00, 0x67,
+                0xb9, 0xbd, 0xd5, 0x7b, 0xb0, 0x39, 0x60, 0xff, 0xb8, 0x48, 0x5f, 0xe4, 0x43, 0x6a, 0x6e, 0xaf,
+                0xb3, 0x72, 0x11, 0xc6, 0x00, 0x07, 0xa4, 0xf2, 0xb0, 0x45, 0xf3, 0x63, 0xf6, 0xca, 0xf3, 0x30,
+                0x3f, 0xec, 0x23, 0xb8, 0x78, 0xd4, 0xbc, 0xa0, 0x66, 0x4f, 0x37, 0xce, 0x3e, 0x5a, 0xc7, 0x00,
+                0x78, 0x26, 0x8a, 0x31, 0x1e, 0xa4, 0xef, 0x57, 0xab, 0x7b, 0x7d, 0xd4, 0xfc, 0x96, 0xbf, 0x7a,
+                0x18, 0x78, 0x2d, 0x91, 0x23, 0x33, 0x33, 0x9f, 0xdb, 0xb2, 0x93, 0xec, 0x81, 0x0d, 0x5c, 0x3e,
+                0xb5, 0xb9, 0x34, 0xd6, 0x78, 0xbf, 0x7f, 0xdb, 0x31, 0xfd, 0x9f, 0x0f, 0x92, 0x99, 0x9b, 0xb0,
+                0x4f, 0x03, 0xe1, 0xa5, 0x07, 0x87, 0xa7, 0x61, 0xa5, 0x8c, 0xed, 0x1f, 0xc1, 0x98, 0x8d, 0x9a,
+                0x34, 0x8c, 0xed, 0xa7, 0x66, 0x93, 0x86, 0x32, 0x49, 0x1a, 0xba, 0x9f, 0x9a, 0x4d, 0x92, 0x4a,
+                0xca, 0x25, 0xe9, 0x74, 0x6a, 0x23, 0xa8, 0x9d, 0x42, 0xed, 0x34, 0x6a, 0xa3, 0xa9, 0x5d, 0x88,
+                0x6b, 0xf4, 0xfb, 0x30, 0x6a, 0x77, 0x51, 0x6b, 0xb5, 0x49, 0x43, 0x5e, 0xb1, 0x49, 0x27, 0x5c,
+                0x86, 0xc7, 0x6d, 0xd2, 0xb0, 0x9d, 0x49, 0x7a, 0x95, 0x68, 0x27, 0x27, 0x92, 0xd2, 0x89, 0xd4,
+                0x8f, 0x60, 0xc9, 0x12, 0xc6, 0x92, 0x65, 0x62, 0xe0, 0x73, 0x14, 0x5a, 0x62, 0xa4, 0x96, 0xa7,
+                0x38, 0xca, 0xcc, 0x8f, 0xf2, 0xbf, 0x30, 0xcb, 0x70, 0xa6, 0x06, 0x5a, 0x4b, 0x4e, 0x7e, 0x48,
+                0x5d, 0xb4, 0x23, 0x70, 0x38, 0xda, 0x11, 0x44, 0x3d, 0xc7, 0xc2, 0xe2, 0x6a, 0xb9, 0x63, 0xcb,
+                0xbb, 0xe2, 0xed, 0x7b, 0x44, 0xed, 0x76, 0x95, 0xa6, 0x3e, 0x3c, 0xd2, 0x03, 0xdb, 0xda, 0x17,
+                0x5f, 0xfb, 0xb7, 0xe0, 0x83, 0xa4, 0x92, 0x1d, 0x6d, 0xbc, 0x76, 0x3a, 0x4f, 0x9c, 0xc3, 0xf3,
+                0xc3, 0x19, 0x79, 0x8e, 0x5a, 0x0b, 0xb6, 0x23, 0x25, 0xcf, 0x48, 0xa5, 0xa2, 0xef, 0xc8, 0x91,
+                0xc0, 0x41, 0xe8, 0x1d, 0x35, 0xce, 0xae, 0x78, 0xcf, 0xc2, 0xeb, 0x73, 0x5e, 0xd3, 0xf8, 0xa1,
+                0xa8, 0xed, 0x46, 0xcd, 0x09, 0x7c, 0x5b, 0x25, 0x57, 0xf9, 0x7a, 0x5b, 0xc8, 0x38, 0x4e, 0x46,
+                0x2e, 0x1b, 0xbe, 0x25, 0x7c, 0x0e, 0xe4, 0xf5, 0x78, 0xdd, 0x14, 0xd7, 0x7f, 0xf2, 0xf3, 0xc9,
+                0x64, 0xc7, 0x4f, 0xe1, 0xb7, 0xc3, 0x96, 0xaa, 0x73, 0x7b, 0xe4, 0x21, 0x1b, 0x7b, 0x58, 0x53,
+                0x6b, 0x09, 0x3b, 0x09, 0x9f, 0x1f, 0x3e, 0xe2, 0xc2, 0x05, 0x36, 0xb6, 0xe1, 0x4d, 0x9b, 0x92,
+                0x17, 0xe3, 0xf5, 0x8f, 0x8d, 0xf4, 0xec, 0xf7, 0x30, 0x8f, 0x60, 0xa3, 0xf0, 0xf1, 0xcb, 0x1e,
+                0xb3, 0xb2, 0x27, 0x16, 0x5b, 0xf9, 0x78, 0xf0, 0xa5, 0x60, 0x67, 0x7e, 0xfb, 0x40, 0x7d, 0xd6,
+                0xef, 0x5e, 0x5c, 0xe6, 0x65, 0x2f, 0xbe, 0xd8, 0xca, 0xc8, 0x47, 0xbb, 0x97, 0x7c, 0xb3, 0x1f,
+                0x2a, 0xf6, 0xb9, 0xb4, 0x35, 0x24, 0xfc, 0x13, 0xd4, 0xab, 0xe2, 0x3e, 0xf8, 0xbd, 0x77, 0xff,
+                0xc2, 0x41, 0xef, 0xa9, 0x67, 0x0b, 0x7e, 0x6f, 0x53, 0x6a, 0x02, 0xcc, 0x3c, 0x2f, 0xb6, 0x74,
+                0x69, 0xcb, 0xa1, 0xc9, 0x93, 0x1b, 0x56, 0xfa, 0xfd, 0xe1, 0x33, 0xb1, 0xb7, 0xa8, 0x8d, 0x85,
+                0x9f, 0x80, 0x7b, 0x10, 0x23, 0x69, 0xe3, 0xe7, 0x6b, 0x67, 0xba, 0xd9, 0x2d, 0xb3, 0x1d, 0x5c,
+                0xef, 0xc4, 0x65, 0x1e, 0x23, 0x1f, 0x48, 0xa7, 0xe3, 0xb3, 0xe7, 0xdc, 0x15, 0x7c, 0x70, 0xf5,
+                0xea, 0xd6, 0x28, 0xcd, 0xff, 0x6c, 0xc4, 0x29, 0xb1, 0x68, 0xe8, 0x23, 0x35, 0xee, 0xd4, 0xc7,
+                0x21, 0x5e, 0x57, 0x8d, 0xea, 0xf7, 0xed, 0x25, 0x99, 0xb8, 0x93, 0x7c, 0xaf, 0x4d, 0xd8, 0x2f,
+                0xf2, 0x73, 0xa6, 0x8c, 0x19, 0xe3, 0x99, 0xac, 0xe8, 0xd7, 0xc8, 0xda, 0x57, 0x6b, 0xd8, 0xdc,
+                0xbb, 0xed, 0x06, 0xf5, 0xc9, 0xcd, 0xe2, 0x7f, 0x88, 0x12, 0xf2, 0x18, 0xcc, 0x19, 0x7b, 0x06,
+                0xde, 0x81, 0xd6, 0x6e, 0x0a, 0xea, 0x2b, 0x14, 0x3f, 0xb9, 0x62, 0xfb, 0xd6, 0x6a, 0x8a, 0x8d,
+                0x6a, 0xb8, 0xcd, 0x09, 0x92, 0x5d, 0x44, 0x7c, 0xab, 0xd6, 0xf1, 0xd3, 0x5e, 0x65, 0x1a, 0x9d,
+                0xa6, 0x1f, 0x68, 0xe3, 0x79, 0x6d, 0x4d, 0x39, 0xfc, 0xfc, 0x94, 0xd8, 0x57, 0x4d, 0x1e, 0xd0,
+                0xf3, 0x21, 0xd9, 0xd7, 0xdd, 0x24, 0x4b, 0xff, 0x45, 0x6e, 0xc4, 0x57, 0x5f, 0x39, 0x91, 0xf4,
+                0xdf, 0x62, 0xe4, 0xfc, 0x3c, 0x4e, 0xd3, 0x4c, 0xad, 0xdc, 0xb6, 0xb5, 0xb8, 0x5f, 0xa0, 0x3d,
+                0xd8, 0x49, 0x32, 0x7b, 0x40, 0xc1, 0x7d, 0x08, 0x76, 0x8d, 0xfa, 0x2d, 0xc8, 0xa5, 0x80, 0x4f,
+                0x87, 0x3e, 0x0e, 0x5a, 0x37, 0x1b, 0x32, 0x8d, 0xa1, 0x80, 0xed, 0x97, 0x14, 0xe7, 0xad, 0xf1,
+                0x3a, 0x2a, 0x7f, 0x0e, 0xfb, 0x30, 0x10, 0x7d, 0xca, 0xf6, 0x51, 0xf3, 0x48, 0xd2, 0x61, 0xb2,
+                0xe2, 0xfb, 0xa9, 0xd9, 0x60, 0xc9, 0x60, 0xd1, 0x69, 0x65, 0xca, 0xc1, 0xfb, 0xd2, 0xdf, 0xe5,
+                0xe4, 0xcd, 0x95, 0x9f, 0x46, 0xad, 0x54, 0x69, 0x17, 0x52, 0x2b, 0xa3, 0xb3, 0x4d, 0x8a, 0xec,
+                0xff, 0x73, 0xe3, 0x2d, 0xbf, 0xee, 0x3a, 0x00, 0x00,
+            };
+            const unsigned char asset_5[] = {
+                0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x75, 0x52, 0x7b, 0x4c, 0x93, 0x57,
+                0x14, 0xbf, 0x08, 0x94, 0xb7, 0xc0, 0x60, 0x13, 0x1d, 0x6e, 0x10, 0x22, 0xc3, 0x38, 0x48, 0x01,
+                0x61, 0x58, 0x11, 0x41, 0xcb, 0x80, 0x69, 0x79, 0x96, 0x4d, 0x16, 0xcd, 0x28, 0x6d, 0x51, 0x02,
+                0x8e, 0x57, 0xb1, 0x80, 0x30, 0x0b, 0x18, 0x8c, 0x0b, 0xd9, 0x3e, 0x14, 0x88, 0x38, 0x88, 0x46,
+                0xb6, 0x19, 0x9c, 0x1b, 0xca, 0xab, 0xb4, 0x30, 0xda, 0xd2, 0x27, 0x6d, 0x69, 0x81, 0x3e, 0x28,
+                0x7d, 0xd8, 0x7e, 0xfd, 0x0a, 0x3a, 0xe6, 0x0c, 0xc3, 0xcd, 0x44, 0x02, 0xb2, 0xdb, 0xfd, 0xb7,
+                0x3f, 0x76, 0x73, 0xef, 0x39, 0xf7, 0xfc, 0xee, 0xf9, 0x9d, 0x73, 0xef, 0x39, 0xf7, 0x7a, 0x6e,
+                0x76, 0x86, 0x9f, 0xf7, 0x3e, 0x6f, 0x00, 0x80, 0x5f, 0x56, 0x26, 0x31, 0x1f, 0xea, 0x00, 0xe7,
+                0xf2, 0x74, 0x85, 0x32, 0x2a, 0xda, 0xbf, 0x00, 0x2a, 0xb7, 0xf3, 0x69, 0xa4, 0x34, 0x00, 0x1e,
+                0x7f, 0xeb, 0xb3, 0x45, 0x71, 0x87, 0x76, 0x18, 0x35, 0x33, 0x9f, 0x04, 0x40, 0x63, 0x24, 0x00,
+                0xac, 0xab, 0x00, 0x6c, 0x42, 0x88, 0xf5, 0x0c, 0x80, 0x3a, 0x3c, 0x00, 0x6b, 0xc5, 0x00, 0x10,
+                0x6e, 0x01, 0xb0, 0xa7, 0xaa, 0x8f, 0x9b, 0x97, 0x0c, 0x80, 0x8b, 0x2a, 0xf7, 0x34, 0x39, 0x1d,
+                0x3a, 0xf0, 0x55, 0x0b, 0x02, 0xe5, 0xfc, 0xb8, 0x50, 0xc6, 0x11, 0xca, 0x46, 0x94, 0x4a, 0xc9,
+                0xa2, 0x56, 0xb2, 0xa0, 0x51, 0xea, 0x0d, 0x6c, 0x91, 0x8c, 0x2d, 0x9a, 0xfd, 0x57, 0xca, 0xd8,
+                0xc2, 0xd9, 0x31, 0xb1, 0x78, 0x88, 0xa7, 0x36, 0x63, 0x98, 0x74, 0x51, 0xc7, 0x57, 0xa8, 0x26,
+                0xc4, 0xce, 0xa3, 0x71, 0xc1, 0xec, 0x84, 0x48, 0xc6, 0xe3, 0xf1, 0xd8, 0x22, 0x29, 0x3c, 0x5a,
+                0xb2, 0xd9, 0xd8, 0x22, 0xc5, 0xce, 0xce, 0x8e, 0xd9, 0xfc, 0x6c, 0xc9, 0x6a, 0x33, 0x59, 0xad,
+                0x16, 0x0c, 0x83, 0xe6, 0xb2, 0x75, 0xd5, 0x64, 0xb7, 0x2b, 0xe3, 0xe3, 0x17, 0x8c, 0x66, 0x93,
+                0x1d, 0x33, 0xa3, 0xa8, 0xd9, 0x8e, 0x99, 0xd0, 0x95, 0xd9, 0xc4, 0x44, 0x69, 0x52, 0x92, 0x79,
+                0x65, 0x05, 0x82, 0x16, 0xbb, 0x5d, 0x4d, 0xa1, 0x6a, 0x7a, 0x7b, 0x2d, 0x16, 0x8b, 0x09, 0xc3,
+                0x16, 0xdb, 0xdb, 0xe5, 0x44, 0xa2, 0x4e, 0xa9, 0xb4, 0x5a, 0xad, 0xd0, 0xb4, 0x38, 0x1c, 0x30,
+                0x82, 0xc9, 0x66, 0x87, 0x9e, 0xce, 0x8d, 0x53, 0x3a, 0xd3, 0x41, 0x67, 0x9d, 0x4e, 0x67, 0x44,
+                0x51, 0xd5, 0xb2, 0x09, 0x22, 0x7a, 0x9b, 0xcd, 0x88, 0x42, 0x1c, 0x75, 0xa6, 0xc0, 0x30, 0xbd,
+                0xe5, 0xc9, 0x32, 0xa4, 0xc0, 0x81, 0x3a, 0x96, 0x6d, 0xa8, 0x6a, 0xc9, 0x68, 0x42, 0x31, 0xa3,
+                0xcd, 0x06, 0x03, 0xa2, 0x28, 0x0a, 0xef, 0xbf, 0x64, 0x45, 0x9d, 0x71, 0x9e, 0xd8, 0xd4, 0x06,
+                0xd3, 0xe4, 0xf0, 0xd8, 0xd4, 0xdd, 0x81, 0x49, 0xa9, 0x82, 0xaf, 0x50, 0x0b, 0xd5, 0x0b, 0xb3,
+                0x1a, 0xfd, 0x54, 0xff, 0x9d, 0x19, 0x7a, 0xe9, 0xbc, 0xc1, 0xc8, 0x63, 0xb5, 0x72, 0x46, 0xd8,
+                0x53, 0x62, 0x99, 0xc1, 0x6a, 0x53, 0xea, 0x0c, 0xbc, 0xaf, 0x58, 0xec, 0x19, 0x89, 0x24, 0x3b,
+                0x47, 0x58, 0xf4, 0x39, 0x57, 0x2a, 0xd7, 0x98, 0x2c, 0xb0, 0x62, 0xfc, 0x86, 0xcb, 0x6c, 0xa1,
+                0x94, 0x3b, 0x34, 0x2c, 0xa4, 0xd1, 0x05, 0x8d, 0x4d, 0xfc, 0xda, 0xba, 0x09, 0xc9, 0xac, 0xd6,
+                0x6c, 0x11, 0x28, 0xd4, 0xbc, 0xe6, 0x2b, 0xbc, 0x96, 0x36, 0x7e, 0x63, 0x13, 0x67, 0x72, 0x9a,
+                0x33, 0xc6, 0x11, 0x54, 0x56, 0xcb, 0xae, 0xb4, 0x68, 0x7a, 0x7a, 0xb8, 0x30, 0x57, 0xfd, 0x65,
+                0x7e, 0x7d, 0xc3, 0xc4, 0xf4, 0x8c, 0x90, 0x4a, 0x63, 0x0b, 0xc4, 0xfc, 0x3a, 0x26, 0xff, 0xfe,
+                0xa0, 0x64, 0x41, 0xcb, 0x91, 0xc8, 0x27, 0xf8, 0x22, 0x71, 0x4e, 0x2e, 0x67, 0x94, 0x0d, 0x2b,
+                0x39, 0x33, 0x37, 0x0f, 0x0b, 0xce, 0x79, 0x34, 0x2a, 0x4d, 0x49, 0x99, 0xbc, 0xf7, 0xfd, 0xa2,
+                0xd1, 0x0c, 0x1b, 0x34, 0x2d, 0x57, 0xc9, 0xb5, 0x7a, 0xd9, 0xa2, 0x8e, 0x2b, 0x91, 0xab, 0x97,
+                0x8c, 0xb0, 0xce, 0xa5, 0x47, 0x59, 0x11, 0xb0, 0xa3, 0x64, 0x46, 0x7e, 0x76, 0x01, 0x28, 0xeb,
+                0x2b, 0x89, 0xf7, 0xee, 0x7a, 0xfa, 0x7a, 0xdb, 0xfc, 0xf8, 0x5a, 0xe1, 0xfb, 0x01, 0xc8, 0x9f,
+                0xbf, 0xff, 0xfd, 0xe6, 0x44, 0x8b, 0x6f, 0xf6, 0x28, 0xf6, 0xc1, 0xae, 0x77, 0x96, 0x93, 0xa2,
+                0x5d, 0xa2, 0x32, 0xdc, 0x37, 0x5f, 0x7e, 0xf1, 0x33, 0x29, 0x83, 0xb8, 0xff, 0x75, 0xd1, 0x25,
+                0x63, 0xe4, 0xf1, 0xed, 0xee, 0xf7, 0x3c, 0xa9, 0x17, 0xda, 0xcb, 0x15, 0x11, 0x3f, 0xdc, 0x2c,
+                0xf0, 0xc7, 0x3d, 0xdc, 0xd2, 0xed, 0xad, 0xd4, 0xc6, 0x77, 0xae, 0xaf, 0x7a, 0x14, 0x4e, 0xbf,
+                0x61, 0x1e, 0xbc, 0x16, 0x98, 0x38, 0x52, 0xfd, 0x1b, 0x8c, 0xef, 0x52, 0x72, 0x2a, 0x83, 0x18,
+                0xda, 0xe7, 0x96, 0xe6, 0x01, 0x0d, 0xaf, 0xaa, 0xcc, 0xa2, 0x5a, 0x88, 0x05, 0x39, 0x97, 0xcb,
+                0x60, 0xf3, 0xc7, 0x2c, 0x08, 0x7a, 0x30, 0xb2, 0x48, 0xe9, 0x1e, 0x0e, 0x2f, 0xaf, 0x80, 0xb8,
+                0xc0, 0x07, 0x3b, 0x5e, 0xf0, 0xbb, 0x81, 0xa7, 0x59, 0xc4, 0x34, 0x72, 0x88, 0x86, 0x5a, 0x5c,
+                0x4c, 0x2b, 0x29, 0xa5, 0xd0, 0x53, 0x77, 0x55, 0x3c, 0x0f, 0x0d, 0xef, 0x3b, 0x6b, 0x4e, 0x9e,
+                0x6a, 0xda, 0x0a, 0x70, 0x69, 0x99, 0x7f, 0xb4, 0xee, 0x99, 0x16, 0x4e, 0x09, 0xcc, 0x8b, 0xad,
+                0xf6, 0x42, 0x58, 0x34, 0x1a, 0x99, 0x71, 0xba, 0xe2, 0xec, 0xad, 0xae, 0xc3, 0xae, 0x6d, 0x1d,
+                0x1f, 0xe6, 0xa6, 0xc6, 0xa4, 0x84, 0xbb, 0x79, 0xbe, 0x25, 0x74, 0xbc, 0x1d, 0xdc, 0xdd, 0x55,
+                0x18, 0x42, 0x23, 0x9f, 0xbc, 0xc1, 0xda, 0x72, 0x74, 0x91, 0x13, 0xea, 0xfc, 0x48, 0xd1, 0x17,
+                0x71, 0xfd, 0xa3, 0xc8, 0x5f, 0x08, 0xd2, 0xa1, 0x7c, 0xf8, 0x3c, 0xf4, 0xdc, 0xb1, 0x66, 0xd7,
+                0x93, 0xb8, 0x01, 0x33, 0x32, 0xb5, 0xd5, 0x3a, 0x73, 0xcf, 0x8e, 0xdc, 0xc8, 0xa7, 0x06, 0x15,
+                0xc4, 0xe3, 0x5e, 0x0e, 0x23, 0x1b, 0x5f, 0xcb, 0x1f, 0xac, 0xdd, 0x46, 0xb6, 0x8c, 0x04, 0x1f,
+                0x77, 0x1c, 0x4e, 0xb1, 0x89, 0xb4, 0x4b, 0x10, 0xe4, 0xc7, 0xd5, 0x1e, 0xfd, 0x38, 0xfe, 0x50,
+                0xf9, 0xbb, 0x38, 0xd3, 0xab, 0xdd, 0xc8, 0x81, 0xfe, 0x73, 0xdd, 0x96, 0xf0, 0x63, 0x97, 0x5e,
+                0xed, 0xf6, 0xfd, 0xe6, 0x76, 0xb6, 0xea, 0xd7, 0xe6, 0xf0, 0xed, 0xa0, 0xc8, 0xf6, 0xab, 0x22,
+                0x52, 0x4d, 0x9e, 0xdb, 0x91, 0x39, 0xdd, 0x5c, 0xf3, 0x46, 0x30, 0x32, 0x8c, 0x0c, 0xae, 0xe2,
+                0xfd, 0x1b, 0xea, 0x1b, 0x49, 0x3f, 0xf9, 0xf7, 0xbe, 0xf8, 0xa3, 0x6d, 0x7d, 0xa0, 0x77, 0xe8,
+                0xce, 0x4e, 0x07, 0xc0, 0x05, 0x07, 0x84, 0x04, 0x2b, 0xf9, 0x00, 0x8c, 0x8f, 0x1c, 0xbd, 0x7f,
+                0x21, 0x40, 0xcc, 0x85, 0x4f, 0x3e, 0xc0, 0x48, 0x3f, 0xc3, 0xa0, 0x51, 0x18, 0x74, 0x02, 0xb5,
+                0x86, 0x0e, 0x15, 0x88, 0xc3, 0xc7, 0xe1, 0xa3, 0xf1, 0x47, 0xe0, 0x24, 0xc7, 0x26, 0x12, 0x12,
+                0xf0, 0x84, 0xd8, 0x8f, 0x0e, 0xe1, 0xe3, 0x08, 0x78, 0xbc, 0x6d, 0x7f, 0x67, 0xdb, 0x7f, 0x08,
+                0x17, 0x2b, 0x69, 0x65, 0xa5, 0x0d, 0xff, 0x4f, 0xe8, 0x4c, 0x3d, 0x78, 0x1c, 0x12, 0xf6, 0x3a,
+                0x09, 0x05, 0x95, 0xa5, 0x0c, 0x26, 0xa5, 0x86, 0x0e, 0x98, 0x4c, 0x66, 0x4c, 0xd9, 0x97, 0xe5,
+                0xb5, 0x54, 0x4a, 0x15, 0x3d, 0xa6, 0xb2, 0xe6, 0xfc, 0x77, 0x2f, 0x92, 0xf7, 0x41, 0xa7, 0xcf,
+                0x1a, 0xc9, 0x67, 0x18, 0xf9, 0x14, 0x66, 0x58, 0x55, 0x4d, 0x65, 0x69, 0x59, 0x05, 0x3d, 0x8c,
+                0xd1, 0x50, 0x45, 0x0f, 0x2b, 0xab, 0x62, 0x50, 0x01, 0xa8, 0xef, 0xc3, 0x36, 0x7c, 0x3d, 0xab,
+                0x3f, 0x8d, 0x8a, 0x92, 0xe7, 0x28, 0x94, 0x59, 0x2b, 0xf9, 0xc0, 0x35, 0xc2, 0x27, 0x86, 0xea,
+                0x13, 0x14, 0x11, 0x74, 0xea, 0x66, 0xb0, 0x6b, 0x50, 0x18, 0x91, 0x75, 0x58, 0x48, 0x73, 0x8d,
+                0x18, 0x21, 0x87, 0x29, 0x0c, 0x5a, 0x99, 0x48, 0x29, 0x0a, 0x15, 0x79, 0x28, 0x58, 0x99, 0x77,
+                0x3f, 0x89, 0x01, 0x6b, 0x7b, 0x02, 0x19, 0x1b, 0x27, 0x12, 0xba, 0x61, 0x0a, 0x90, 0x95, 0x9e,
+                0x4d, 0xfc, 0xe5, 0x44, 0x71, 0xeb, 0x3f, 0x8e, 0x2d, 0x68, 0xab, 0xb5, 0x04, 0x00, 0x00,
+            };
+            const unsigned char asset_6[] = {
+                0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x75, 0x55, 0x79, 0x3c, 0xd3, 0x8f,
+                0x1b, 0xff, 0x68, 0x9a, 0xc9, 0x35, 0x57, 0x92, 0x6b, 0xcd, 0x91, 0xe4, 0x58, 0xa2, 0x7e, 0xf6,
+                0x75, 0x84, 0xc9, 0x72, 0x95, 0xab, 0xc9, 0xcd, 0x12, 0x1a, 0x36, 0x8c, 0x65, 0xcc, 0x95, 0x73,
+                0x96, 0xfb, 0xcc, 0x51, 0x94, 0xfb, 0xca, 0x99, 0x48, 0x48, 0x39, 0x72, 0x2c, 0x2a, 0x94, 0x6f,
+                0xa8, 0x25, 0x37, 0x89, 0x1a, 0xd1, 0xfc, 0xe6, 0xcf, 0xdf, 0x1f, 0xbf, 0xd7, 0x73, 0xbc, 0x5f,
+                0xaf, 0xf7, 0xf3, 0xbc, 0x9f, 0xe7, 0xbf, 0xe7, 0x49, 0xbc, 0x66, 0x61, 0xcc, 0x77, 0xec, 0xe4,
+                0x31, 0x00, 0x00, 0xf8, 0xae, 0xa0, 0x51, 0x56, 0x6c, 0x84, 0x1d, 0x06, 0x04, 0xcc, 0xce, 0x81,
+                0x64, 0xf2, 0x36, 0x1b, 0x38, 0x3d, 0xf5, 0xcd, 0xf5, 0x01, 0xa0, 0x21, 0x85, 0x67, 0xdf, 0xed,
+                0xe8, 0x61, 0x11, 0x8b, 0xb6, 0x32, 0x07, 0x00, 0xb2, 0x02, 0x00, 0x44, 0xc6, 0x00, 0xc0, 0x1f,
+                0x36, 0x15, 0xb9, 0x08, 0x00, 0x41, 0x08, 0x00, 0x58, 0x76, 0x05, 0x00, 0x64, 0x2e, 0x00, 0x88,
+                0x11, 0x0a, 0xda, 0x2d, 0xb5, 0xd9, 0x05, 0xb0, 0xbb, 0xa9, 0x31, 0x0a, 0x38, 0x38, 0xb4, 0x87,
+                0x9d, 0xe5, 0x19, 0x6c, 0x86, 0x9b, 0x80, 0xbe, 0x11, 0x08, 0x00, 0x47, 0x14, 0x0e, 0x83, 0xc3,
+                0xc7, 0xb6, 0x75, 0x95, 0x4d, 0x72, 0x11, 0xaf, 0x98, 0x1b, 0x71, 0x7d, 0xe3, 0xe6, 0x86, 0xaa,
+                0x0b, 0xa3, 0x36, 0xbd, 0xa0, 0x6c, 0xc6, 0xf9, 0x0a, 0x4a, 0xdf, 0xc6, 0xae, 0xb7, 0x33, 0x3b,
+                0xd4, 0xa7, 0xc8, 0x43, 0xbc, 0x2f, 0x82, 0xbe, 0xf5, 0x62, 0x83, 0xb4, 0x38, 0x59, 0x17, 0xdf,
+                0xe2, 0x74, 0x56, 0xc7, 0xe7, 0xf3, 0xf5, 0x29, 0x84, 0x4f, 0x8c, 0x54, 0xae, 0x84, 0xf0, 0xb5,
+                0xf3, 0x17, 0xe2, 0x14, 0xe3, 0xb9, 0x85, 0xca, 0x5f, 0x25, 0x24, 0x18, 0xb8, 0x97, 0xc8, 0xc1,
+                0x4f, 0x42, 0x12, 0x7b, 0xa0, 0xd7, 0x0e, 0x60, 0x86, 0x88, 0x00, 0x88, 0xdc, 0x50, 0x34, 0xd2,
+                0xd0, 0x95, 0x13, 0x62, 0xb9, 0x38, 0x55, 0x26, 0x91, 0xb0, 0x0e, 0xac, 0x98, 0x30, 0x5b, 0x5a,
+                0x1c, 0x8c, 0x27, 0x5b, 0x66, 0x37, 0x75, 0x74, 0x36, 0xd6, 0x64, 0x3e, 0x4f, 0xd6, 0x9f, 0x5d,
+                0x73, 0xe4, 0x7c, 0xce, 0x22, 0x0b, 0x30, 0xb7, 0xfe, 0x9d, 0x0c, 0x75, 0x9a, 0x0c, 0x5c, 0xb0,
+                0x35, 0x7b, 0x69, 0xea, 0xd4, 0xf1, 0x42, 0xe1, 0x0d, 0x59, 0xcf, 0x25, 0x03, 0xd9, 0xb6, 0xf4,
+                0x92, 0x87, 0xc2, 0x12, 0xb8, 0x56, 0x9a, 0x84, 0x61, 0xae, 0xd7, 0xd6, 0x51, 0xe5, 0x8d, 0x19,
+                0x0d, 0x27, 0x0c, 0x7b, 0x4f, 0x5b, 0xda, 0x4b, 0x61, 0x4c, 0xba, 0xf0, 0x06, 0x5b, 0xaa, 0x04,
+                0xe0, 0x75, 0x0f, 0xc2, 0xad, 0x8b, 0x32, 0xd2, 0xe8, 0x11, 0x7b, 0x35, 0x3d, 0xd2, 0xa9, 0x1d,
+                0x72, 0xec, 0x4b, 0x48, 0xb1, 0x47, 0x45, 0xe2, 0x3f, 0x5e, 0xa6, 0xe7, 0x9f, 0x86, 0x58, 0x58,
+                0x8f, 0xfe, 0xba, 0x1f, 0x17, 0x67, 0xac, 0xab, 0x67, 0xb9, 0x1a, 0xb7, 0x9e, 0x5c, 0xa7, 0x13,
+                0x7f, 0xad, 0xd1, 0xa5, 0xf8, 0x77, 0xd2, 0x00, 0x0b, 0x9d, 0x07, 0xc2, 0xd4, 0x3b, 0x17, 0xb2,
+                0xa6, 0x8e, 0x01, 0x92, 0xcb, 0x3a, 0xc8, 0xe5, 0x5d, 0xfd, 0x96, 0x85, 0x3d, 0xc8, 0x9b, 0x9d,
+                0x28, 0xb5, 0xdd, 0x68, 0xdc, 0x83, 0x5e, 0x5d, 0xf1, 0xb9, 0xc8, 0xee, 0xa1, 0x15, 0x4c, 0x7d,
+                0x98, 0xab, 0xf1, 0xe4, 0x7a, 0x87, 0xca, 0x7b, 0xdc, 0x8a, 0x6a, 0x07, 0x71, 0x56, 0x4b, 0x18,
+                0x5d, 0xfe, 0xae, 0xe5, 0xc5, 0xb8, 0xac, 0x35, 0x0f, 0x5c, 0x50, 0x5b, 0xaf, 0x9b, 0x49, 0x71,
+                0xd4, 0xeb, 0xde, 0xa2, 0x30, 0xf6, 0xa2, 0x62, 0xad, 0xde, 0xad, 0x2d, 0xac, 0x84, 0x35, 0x5a,
+                0x28, 0x51, 0xbb, 0x84, 0x5e, 0x93, 0x68, 0x76, 0x5b, 0x17, 0x9d, 0x5b, 0xf7, 0x41, 0x91, 0x62,
+                0x24, 0x96, 0xef, 0x52, 0x1c, 0x5d, 0x25, 0x02, 0x73, 0x46, 0xfe, 0x9d, 0xfd, 0x5c, 0xd2, 0x79,
+                0x01, 0x0f, 0x02, 0x45, 0x40, 0x90, 0xe0, 0x23, 0x31, 0xd4, 0xf8, 0xd6, 0x24, 0x8d, 0xd6, 0x8f,
+                0xee, 0xc3, 0xda, 0xa4, 0xe4, 0xd8, 0x17, 0x27, 0xfe, 0x00, 0xc9, 0xd0, 0x79, 0x08, 0x14, 0x19,
+                0xba, 0x00, 0xe4, 0x1e, 0x47, 0x82, 0xd1, 0x19, 0x26, 0xb8, 0x76, 0xb8, 0x33, 0xcd, 0x8b, 0x01,
+                0x55, 0x01, 0xeb, 0x4e, 0x6d, 0xf6, 0xad, 0x27, 0x41, 0x43, 0x58, 0x59, 0x4e, 0x1d, 0x17, 0x8e,
+                0x6c, 0x98, 0x9b, 0x02, 0xa2, 0x2a, 0xc0, 0x0e, 0xe1, 0x26, 0x2f, 0x5d, 0xe0, 0xcd, 0xd1, 0xec,
+                0x58, 0xac, 0xc3, 0x54, 0xeb, 0x3d, 0x5f, 0x07, 0x06, 0x73, 0x62, 0x87, 0xe2, 0x7e, 0xbd, 0xe0,
+                0xd3, 0x3b, 0x93, 0x13, 0xd8, 0x01, 0xd1, 0xcf, 0x18, 0x5d, 0x49, 0x71, 0x5f, 0xfe, 0x53, 0x21,
+                0xbf, 0xee, 0xdb, 0xce, 0x76, 0x5c, 0x45, 0x81, 0x6a, 0x5c, 0x42, 0x97, 0xf4, 0x9e, 0xfa, 0x4e,
+                0x07, 0xb3, 0xca, 0xcc, 0xf3, 0x87, 0x69, 0xc7, 0x89, 0xe5, 0x5c, 0xe1, 0x70, 0x93, 0xf0, 0xb1,
+                0x69, 0x3d, 0xf4, 0xfe, 0x7c, 0x4e, 0x42, 0x67, 0x67, 0xce, 0xaa, 0x14, 0x49, 0xd0, 0x16, 0x43,
+                0x5f, 0x7c, 0x80, 0x9d, 0x6e, 0xbe, 0x78, 0x51, 0x7d, 0x30, 0xf9, 0x45, 0xac, 0x6f, 0xed, 0xda,
+                0xf9, 0x0f, 0x4c, 0x26, 0xf3, 0xb4, 0x53, 0x5b, 0xb8, 0x1b, 0x6e, 0xa5, 0xa9, 0xd4, 0xb3, 0xdd,
+                0xcc, 0xe8, 0x7b, 0xfe, 0x5b, 0x58, 0x1f, 0x74, 0xba, 0x93, 0x47, 0x47, 0xdb, 0x2c, 0x8c, 0x5e,
+                0xd7, 0x04, 0x56, 0x84, 0x18, 0xaa, 0xef, 0x7e, 0xfd, 0x66, 0xec, 0x6b, 0xfc, 0x67, 0x4f, 0x6c,
+                0xd8, 0x66, 0x83, 0x4a, 0x3e, 0xf1, 0xa5, 0xd2, 0x10, 0x04, 0x6a, 0x2a, 0x3f, 0xd5, 0xad, 0xad,
+                0x06, 0x81, 0xd6, 0x0e, 0x7e, 0x0e, 0xe7, 0x4a, 0x47, 0xcf, 0x39, 0x87, 0xcb, 0x1f, 0xf0, 0x95,
+                0xf7, 0x35, 0x26, 0x64, 0x06, 0xca, 0xc3, 0x53, 0x78, 0xf9, 0xf8, 0x46, 0xb4, 0xc6, 0x67, 0x0f,
+                0xee, 0xca, 0x2e, 0x45, 0x8d, 0x70, 0x59, 0x14, 0x54, 0x14, 0x0c, 0xe4, 0xa5, 0x87, 0x8e, 0xdd,
+                0x5e, 0x2f, 0xc9, 0xce, 0xce, 0x00, 0xf0, 0xb5, 0xf6, 0xb6, 0x98, 0xd1, 0xc8, 0x27, 0x30, 0x48,
+                0xaf, 0xbf, 0xde, 0x82, 0x86, 0xe0, 0x87, 0x91, 0xcb, 0xf3, 0x81, 0xe8, 0x9a, 0xf5, 0x55, 0xa5,
+                0xdc, 0x54, 0xb3, 0xba, 0x4b, 0x41, 0xb6, 0x55, 0xdb, 0xf2, 0x93, 0xb4, 0x10, 0x16, 0x8f, 0x9b,
+                0xba, 0x7f, 0xad, 0xb5, 0xf2, 0x8c, 0x78, 0x60, 0xe7, 0xa3, 0xcf, 0x94, 0xbf, 0xd3, 0x46, 0xdb,
+                0x13, 0xa3, 0x13, 0x5b, 0xce, 0xa0, 0xcb, 0x33, 0x8e, 0x4d, 0x65, 0x13, 0xdc, 0xd1, 0x5c, 0x86,
+                0xb5, 0x11, 0x8f, 0x39, 0xda, 0x3b, 0x3a, 0x18, 0x97, 0x4c, 0xa1, 0x31, 0xc2, 0x12, 0xf9, 0x71,
+                0xe0, 0x1a, 0x6c, 0xff, 0x2d, 0x9f, 0x9a, 0xb0, 0x94, 0x9d, 0xba, 0xc2, 0x0a, 0xc7, 0x64, 0x81,
+                0xab, 0xf7, 0xd4, 0xd5, 0xb3, 0xf3, 0xe4, 0x14, 0x86, 0xa4, 0x26, 0x29, 0x4e, 0xd3, 0xbf, 0xb1,
+                0x69, 0xee, 0x20, 0x42, 0x2c, 0x9c, 0xcc, 0xef, 0xca, 0x7c, 0x93, 0x95, 0x54, 0x08, 0x9b, 0xaa,
+                0x44, 0xb1, 0x5a, 0x6e, 0x2d, 0x8c, 0xd6, 0x80, 0x11, 0xa2, 0xa2, 0x81, 0x1c, 0x6b, 0x47, 0xe7,
+                0xb7, 0x8d, 0x7f, 0xf1, 0xd9, 0x19, 0xf6, 0x7b, 0xca, 0xcd, 0x49, 0x6a, 0xa3, 0x5f, 0x6f, 0x4d,
+                0x57, 0x3c, 0xdb, 0x70, 0x5e, 0x65, 0xe9, 0x5e, 0xee, 0x6b, 0xe4, 0xe5, 0x4b, 0x81, 0x66, 0xad,
+                0x42, 0x55, 0x53, 0xdf, 0xae, 0x06, 0x77, 0xbf, 0x6e, 0x50, 0x13, 0x2d, 0x2d, 0xba, 0x83, 0xfb,
+                0x50, 0x55, 0x5d, 0x60, 0xaa, 0xfa, 0x51, 0xcc, 0xa1, 0x01, 0x9e, 0xe6, 0x87, 0x9f, 0x55, 0x4f,
+                0xe3, 0x38, 0x4d, 0xfd, 0x9e, 0x12, 0x5f, 0x15, 0x66, 0x62, 0x46, 0x01, 0x4d, 0x34, 0xf4, 0x78,
+                0xe7, 0xaf, 0xb8, 0x47, 0xdd, 0x99, 0x74, 0x31, 0x2d, 0xc3, 0x32, 0x25, 0x39, 0x60, 0x0e, 0x8a,
+                0xea, 0x77, 0xdc, 0x4f, 0x9c, 0xd7, 0x15, 0x86, 0x7a, 0x5d, 0x78, 0xe9, 0x92, 0x29, 0x13, 0x54,
+                0xd4, 0xfe, 0xa5, 0x9d, 0x82, 0xa4, 0xb2, 0x1e, 0x5b, 0x9f, 0xe9, 0x5a, 0xee, 0x27, 0xd1, 0x9d,
+                0xfe, 0xfc, 0x90, 0x15, 0xa0, 0x26, 0x34, 0x5e, 0x15, 0x0b, 0x46, 0x59, 0x6a, 0x34, 0x40, 0x61,
+                0xb7, 0xbd, 0x2e, 0x91, 0x3a, 0x37, 0xc7, 0xd4, 0x22, 0x36, 0xa0, 0x95, 0xb5, 0xf4, 0xa8, 0x73,
+                0xb9, 0x7f, 0xc8, 0x35, 0x69, 0x82, 0xcf, 0x5b, 0x72, 0xae, 0x3e, 0x27, 0xe9, 0x3c, 0x88, 0x2a,
+                0xce, 0x08, 0x2b, 0x6b, 0xe0, 0xef, 0x6f, 0xe5, 0xb8, 0x9d, 0x14, 0xc1, 0xea, 0xc5, 0x95, 0xd8,
+                0x48, 0x4e, 0x31, 0xd6, 0x66, 0x23, 0xb0, 0x26, 0x6d, 0x33, 0x8d, 0xef, 0xf9, 0x4b, 0x33, 0x33,
+                0x0d, 0xda, 0x5c, 0x1b, 0xf7, 0xe5, 0x8f, 0xae, 0x32, 0xfa, 0x61, 0xd4, 0x4b, 0x38, 0x44, 0x1c,
+                0x55, 0xac, 0x55, 0x78, 0x83, 0x2c, 0x8c, 0x1f, 0xf1, 0x10, 0x99, 0xf4, 0xed, 0xd6, 0x0a, 0xc8,
+                0x7d, 0x6f, 0xdd, 0xc5, 0x35, 0x1b, 0x8f, 0x2a, 0x91, 0x1c, 0x46, 0xcc, 0x7d, 0x5b, 0x3c, 0x61,
+                0xde, 0xb4, 0x32, 0xa0, 0xb7, 0x2b, 0xb7, 0x9e, 0x9c, 0x23, 0x74, 0xdd, 0x7c, 0xe4, 0xf7, 0x72,
+                0xbc, 0x34, 0xb9, 0x79, 0xab, 0x24, 0x09, 0xec, 0x85, 0xff, 0x6b, 0x5e, 0x39, 0xa1, 0x4b, 0x21,
+                0x22, 0x15, 0xb8, 0xa0, 0x97, 0xaa, 0xaa, 0x52, 0xed, 0x78, 0x75, 0xb4, 0x69, 0x8d, 0x1a, 0x95,
+                0x9e, 0x0f, 0xc0, 0x7a, 0xb0, 0xbd, 0xbf, 0x1d, 0x90, 0x85, 0x20, 0x5a, 0xb5, 0xcd, 0xb9, 0xa2,
+                0xb0, 0xc2, 0x11, 0x57, 0x05, 0x41, 0x40, 0xf1, 0xb8, 0xe3, 0xcf, 0xe9, 0x88, 0xf8, 0xbd, 0xe5,
+                0x6a, 0x39, 0x3c, 0x0b, 0x59, 0x89, 0xeb, 0x6a, 0xd7, 0x1c, 0x5f, 0x1e, 0x8a, 0x07, 0x83, 0x67,
+                0xce, 0x48, 0xf5, 0x72, 0x1f, 0x79, 0xf8, 0x3d, 0x27, 0xd9, 0x35, 0x2f, 0x0a, 0xb6, 0xf9, 0x9f,
+                0x2c, 0x87, 0x07, 0x86, 0x0f, 0x4e, 0xf6, 0x38, 0x34, 0x08, 0x31, 0x93, 0x56, 0xa0, 0xfd, 0x67,
+                0x72, 0xe4, 0x32, 0x18, 0xd5, 0x4d, 0x37, 0xbc, 0xbc, 0x94, 0xeb, 0xf9, 0x0c, 0xd3, 0xe9, 0xda,
+                0x89, 0xa4, 0xe6, 0x9c, 0x1b, 0xcc, 0x7d, 0x11, 0xcf, 0x41, 0x21, 0x94, 0x7f, 0x94, 0xd0, 0x07,
+                0x9c, 0x71, 0x80, 0x0c, 0x61, 0x01, 0x55, 0x74, 0x33, 0xcc, 0x99, 0x74, 0x87, 0x95, 0xc7, 0xb9,
+                0x5a, 0x24, 0xbb, 0x38, 0x66, 0x59, 0xb3, 0x6d, 0xf9, 0x33, 0xdf, 0xaf, 0xac, 0x2d, 0x9c, 0x21,
+                0x3e, 0xd2, 0xcf, 0x6d, 0x63, 0xa6, 0x78, 0x2d, 0x3a, 0xc0, 0xa9, 0x4a, 0x7a, 0x36, 0x5a, 0x5a,
+                0xfa, 0xf2, 0xfa, 0xae, 0xf8, 0x68, 0xba, 0x7c, 0x79, 0xd2, 0x07, 0x78, 0xe6, 0x73, 0x50, 0x18,
+                0x93, 0xe0, 0x32, 0xfb, 0x29, 0x51, 0x37, 0x9e, 0x0b, 0x7c, 0x5f, 0x53, 0xae, 0x4c, 0xc9, 0xd5,
+                0xde, 0x7e, 0x33, 0xa7, 0xbe, 0xfb, 0xfd, 0x45, 0xa8, 0xb2, 0xbd, 0xf6, 0x9a, 0xb7, 0xe2, 0xd9,
+                0x54, 0x89, 0xd3, 0xe9, 0xf4, 0x34, 0xf2, 0xd7, 0xa7, 0xe8, 0x20, 0xcd, 0x67, 0xf8, 0xd9, 0xcb,
+                0x35, 0x8d, 0xd4, 0xf1, 0x61, 0xd1, 0x9b, 0x69, 0xf3, 0x7b, 0x1b, 0x28, 0x8b, 0xe1, 0xeb, 0x15,
+                0x93, 0x02, 0x4c, 0x3e, 0xed, 0x5c, 0x2d, 0xff, 0xfd, 0x70, 0x87, 0xc4, 0x61, 0x31, 0x0e, 0x61,
+                0x23, 0x4f, 0xbf, 0x22, 0x74, 0x6a, 0xd7, 0xd2, 0xf1, 0x51, 0x70, 0x62, 0xbf, 0x3e, 0x8e, 0x18,
+                0xcc, 0xab, 0x83, 0x34, 0x99, 0x67, 0x38, 0xfc, 0xc8, 0x71, 0xa6, 0xed, 0x95, 0x06, 0x3d, 0x14,
+                0x09, 0x9f, 0xc3, 0xd2, 0x7a, 0x1a, 0x95, 0x45, 0x88, 0xc1, 0x44, 0xe2, 0x37, 0xf2, 0xf8, 0x5d,
+                0x9c, 0x41, 0x7c, 0x46, 0x53, 0xe6, 0xf2, 0x86, 0x63, 0xab, 0xf2, 0x93, 0xac, 0x45, 0x85, 0x4c,
+                0xc4, 0xc6, 0x73, 0x05, 0x47, 0x3a, 0x56, 0x19, 0x03, 0xc3, 0x28, 0x06, 0xa8, 0xbe, 0xcd, 0xe3,
+                0xb5, 0x3b, 0xde, 0x40, 0x09, 0xf5, 0x9f, 0xf9, 0xcb, 0xb5, 0x6e, 0x8b, 0x61, 0xa8, 0x75, 0xb6,
+                0x99, 0x41, 0x07, 0x3a, 0xa4, 0x9b, 0xac, 0x44, 0x81, 0xc4, 0xa2, 0x17, 0x11, 0xb3, 0x70, 0x64,
+                0x55, 0x33, 0x2f, 0x0f, 0x15, 0x1e, 0xc1, 0xd9, 0xbe, 0xfd, 0xf2, 0x77, 0xb6, 0xaf, 0x7d, 0xf5,
+                0x96, 0xe8, 0x32, 0x8b, 0x8a, 0xfa, 0xe9, 0x65, 0x4d, 0x91, 0x92, 0x52, 0x19, 0xd1, 0x78, 0xff,
+                0x01, 0x9a, 0xa2, 0xe5, 0x29, 0x0f, 0xdd, 0xdb, 0x93, 0x86, 0x1c, 0xd9, 0xae, 0xb4, 0x46, 0x69,
+                0xb6, 0x78, 0x6a, 0xa8, 0x15, 0xcf, 0xb5, 0x7b, 0x18, 0x98, 0x14, 0x81, 0x7f, 0x29, 0x56, 0xe4,
+                0x07, 0x89, 0xac, 0xc5, 0x9e, 0x39, 0x88, 0x81, 0x97, 0x74, 0xec, 0x81, 0xeb, 0x6d, 0x90, 0x9f,
+                0x68, 0x04, 0xa9, 0x54, 0x25, 0xb2, 0x6e, 0x9e, 0x63, 0x91, 0xe3, 0x98, 0x51, 0xd9, 0xd4, 0xe3,
+                0x00, 0xad, 0x2a, 0x19, 0x96, 0xbc, 0x9b, 0xa1, 0xec, 0xee, 0xc8, 0x53, 0x78, 0x56, 0x96, 0xcc,
+                0x29, 0xd7, 0x1b, 0xc7, 0x9b, 0xaa, 0x3d, 0xbf, 0xc4, 0x73, 0xb4, 0xb6, 0x56, 0xe4, 0xd9, 0x26,
+                0xc2, 0xf4, 0x36, 0x7c, 0x70, 0xa1, 0x73, 0xb2, 0x9c, 0x0a, 0x8f, 0xca, 0xcb, 0xcb, 0xed, 0x57,
+                0x77, 0x5a, 0x2a, 0x16, 0x25, 0xa2, 0xff, 0x44, 0x27, 0x54, 0x44, 0xaf, 0xa4, 0x8f, 0x88, 0x0d,
+                0x8a, 0x3a, 0x29, 0x8e, 0xec, 0x8f, 0x3f, 0x44, 0x72, 0x35, 0x6b, 0x68, 0xa6, 0x27, 0x68, 0x69,
+                0xb9, 0x8c, 0x1d, 0xde, 0x97, 0x81, 0x1b, 0xdc, 0x66, 0x7d, 0x7b, 0x9d, 0x77, 0xc5, 0xbc, 0x7c,
+                0xfd, 0x0c, 0xfc, 0xcf, 0xbe, 0xbd, 0x45, 0x3b, 0x85, 0x51, 0x4c, 0x1f, 0x14, 0xcd, 0x45, 0xea,
+                0x7b, 0x1a, 0x28, 0xe5, 0x3d, 0x7e, 0x56, 0xcc, 0x9f, 0xea, 0xa2, 0xe6, 0x83, 0xdb, 0xfb, 0x12,
+                0x43, 0x5d, 0x68, 0x26, 0x93, 0x93, 0xfc, 0x80, 0xf4, 0x22, 0x99, 0xd4, 0x41, 0xd1, 0x81, 0xe3,
+                0xc7, 0x50, 0xd6, 0xca, 0xf7, 0xff, 0x7d, 0x5c, 0xfa, 0x2c, 0xad, 0x8d, 0xb1, 0xe3, 0xa5, 0x19,
+                0xe1, 0x66, 0x3a, 0xd4, 0x7d, 0x80, 0x72, 0x55, 0x27, 0x87, 0x86, 0xe2, 0x68, 0xc1, 0x17, 0x12,
+                0xa9, 0x17, 0xee, 0xda, 0xab, 0xc0, 0xbf, 0x25, 0xa9, 0xe6, 0x85, 0x45, 0x95, 0xac, 0x14, 0x6e,
+                0xe6, 0xd8, 0xdc, 0xb0, 0xd4, 0xb7, 0xa6, 0xa8, 0xc0, 0xe8, 0xca, 0xec, 0x79, 0xdf, 0x6d, 0x02,
+                0x64, 0x24, 0x3e, 0x2f, 0x6d, 0xbb, 0x37, 0xcf, 0xd0, 0x2a, 0xf0, 0x51, 0xc3, 0xdc, 0xf7, 0x4e,
+                0xe5, 0xab, 0xb1, 0xe7, 0x42, 0x68, 0xc5, 0xb5, 0x95, 0x69, 0xb9, 0x58, 0x63, 0xa1, 0x3c, 0x7a,
+                0xf0, 0x68, 0x61, 0xe8, 0xa2, 0xf0, 0x69, 0xc4, 0x20, 0xbc, 0xba, 0x03, 0xff, 0xe3, 0x58, 0xe9,
+                0xa3, 0x69, 0xe8, 0x0b, 0x38, 0x3c, 0x59, 0x26, 0xe6, 0x15, 0x96, 0xdf, 0x64, 0xf3, 0x6b, 0xf4,
+                0xc4, 0xc4, 0xbd, 0x77, 0x1f, 0xb7, 0x2a, 0x61, 0x85, 0x16, 0x93, 0x60, 0xbb, 0x8b, 0xd4, 0xec,
+                0x69, 0x41, 0xd5, 0xe4, 0xd4, 0x96, 0x85, 0xa7, 0x2d, 0x9d, 0xbb, 0xde, 0xbf, 0xfe, 0xc9, 0x57,
+                0xaa, 0x2a, 0xaf, 0xc7, 0x7f, 0x34, 0xdb, 0x38, 0x00, 0xf1, 0xf6, 0x44, 0x57, 0xfa, 0x70, 0xee,
+                0xeb, 0xb1, 0x9f, 0xaf, 0x3c, 0xd1, 0xc8, 0x8e, 0x78, 0xd3, 0x8d, 0xe8, 0x81, 0xc4, 0x06, 0x78,
+                0xb0, 0x01, 0x50, 0x47, 0xa8, 0x23, 0x54, 0x10, 0x5a, 0x6c, 0xb7, 0x39, 0x77, 0x01, 0xa9, 0x89,
+                0x40, 0x9e, 0xd3, 0x3a, 0x8b, 0x50, 0x47, 0x22, 0x10, 0x4f, 0xe0, 0xcb, 0x33, 0xff, 0x23, 0xf0,
+                0xc5, 0xdf, 0xf4, 0xbe, 0x15, 0xf2, 0xff, 0x05, 0x3d, 0x11, 0x56, 0xee, 0x6c, 0x81, 0xf8, 0xa1,
+                0xc0, 0x1a, 0x7f, 0x8b, 0x48, 0x72, 0x0b, 0xf0, 0x00, 0x48, 0x24, 0x92, 0xaa, 0xb7, 0x1f, 0x2e,
+                0x10, 0xeb, 0x46, 0xf0, 0x50, 0xc5, 0x07, 0x78, 0xe6, 0xaf, 0x6b, 0x9f, 0x64, 0x37, 0x61, 0xc8,
+                0x36, 0x76, 0x44, 0x2b, 0x37, 0x12, 0x8c, 0x10, 0x80, 0xbf, 0xe5, 0xed, 0xe3, 0x01, 0x23, 0x86,
+                0x10, 0x3c, 0x60, 0xde, 0x04, 0x22, 0x16, 0x00, 0xee, 0x14, 0x30, 0x7e, 0xf2, 0x42, 0xfc, 0xaf,
+                0x2b, 0x2a, 0xbe, 0xb9, 0x3a, 0x34, 0x7c, 0x65, 0xde, 0x0a, 0x00, 0xc9, 0xf2, 0xa8, 0x62, 0x79,
+                0x84, 0x65, 0x85, 0x4d, 0x33, 0x44, 0x40, 0xc2, 0x30, 0x54, 0xa4, 0x46, 0xef, 0x4d, 0x90, 0x6c,
+                0x93, 0x0d, 0x6c, 0x68, 0xea, 0xfd, 0xc0, 0xab, 0xe1, 0x57, 0x92, 0xaf, 0xb8, 0x86, 0x22, 0xd1,
+                0x0f, 0x4d, 0x54, 0x81, 0x65, 0x31, 0x41, 0xe2, 0x4f, 0x03, 0xcd, 0x2c, 0xf6, 0x0a, 0xe0, 0x8a,
+                0x91, 0x05, 0xaa, 0xce, 0xc0, 0x35, 0xfa, 0xbf, 0x16, 0xbe, 0xbd, 0x10, 0xf7, 0x08, 0x00, 0x00,
+            };
+        } // namespace
+
+        const Asset ASSETS[] = {
+            {"index.html", "text/html", "\"dc8924ed72f34b84d2c1d891ccc7c3ac\"", asset_0, sizeof(asset_0), 12418},
+            {"httpgd.js", "application/javascript", "\"c6cf88cfb5f1c53c984d9f6c4388c76d\"", asset_1, sizeof(asset_1), 30592},
+            {"style.css", "text/css", "\"8574462d52db4bfedec9522c5f014dce\"", asset_2, sizeof(asset_2), 4534},
+            {"plot-none.svg", "image/svg+xml", "\"fee580c13c7dc1620e7cc1007d82408b\"", asset_3, sizeof(asset_3), 303},
+            {"favicon.ico", "image/x-icon", "\"8a7729ae01e5b6620fa791dfb0e1bdd1\"", asset_4, sizeof(asset_4), 15086},
+            {"favicon-16x16.png", "image/png", "\"7b9961abac6039995274e33983f4300e\"", asset_5, sizeof(asset_5), 1205},
+            {"favicon-32x32.png", "image/png", "\"7f26ff616f47fdb1436f6e019bd5751c\"", asset_6, sizeof(asset_6), 2295},
+        };
+        const std::size_t ASSETS_COUNT = sizeof(ASSETS) / sizeof(ASSETS[0]);
+    } // namespace web
+} // namespace httpgd
@@ -1,6 +1,9 @@
 //#include <Rcpp.h>
 #include "HttpgdWebServer.h"
-#include <fstream>
+#include "HttpgdTrace.h"
+#include "HttpgdWebAssets.h"
+#include <cmath>
+#include <limits>
 #include <thread>
 #include <sstream>
 #include <fmt/ostream.h>
@@ -10,18 +13,6 @@ namespace httpgd
 {
     namespace web
     {
-        boost::optional<std::string> read_txt(const std::string &filepath)
-        {
-            std::ifstream t(filepath);
-            if (t.fail())
-            {
-                return boost::none;
-            }
-            std::stringstream buffer;
-            buffer << t.rdbuf();
-            return buffer.str();
-        }
-
         inline boost::optional<std::string> param_str(OB::Belle::Request::Params params, std::string name)
         {
             auto it = params.find(name);
@@ -83,6 +74,82 @@ namespace httpgd
             }
         }
 
+        // Pagination cursors are opaque to clients, they encode the last plot ID.
+        inline std::string cursor_make(int32_t t_id)
+        {
+            return fmt::format("c{:x}", t_id);
+        }
+        inline boost::optional<int32_t> param_cursor(OB::Belle::Request::Params params, std::string name)
+        {
+            auto it = params.find(name);
+            if (it == params.end() || it->second.size() < 2 || it->second[0] != 'c')
+            {
+                return boost::none;
+            }
+            try
+            {
+                std::size_t pos;
+                long val = std::stol(it->second.substr(1), &pos, 16);
+                if (pos != it->second.size() - 1 || val < 0 || val > std::numeric_limits<int32_t>::max())
+                {
+                    return boost::none;
+                }
+                return static_cast<int32_t>(val);
+            }
+            catch (const std::exception &e)
+            {
+                return boost::none;
+            }
+        }
+
+        // "x,y,width,height" with positive width and height
+        inline boost::optional<rect<double>> param_rect(OB::Belle::Request::Params params, std::string name)
+        {
+            auto it = params.find(name);
+            if (it == params.end())
+            {
+                return boost::none;
+            }
+            double v[4];
+            std::stringstream ss(it->second);
+            std::string item;
+            for (int i = 0; i < 4; ++i)
+            {
+                if (!std::getline(ss, item, ','))
+                {
+                    return boost::none;
+                }
+                try
+                {
+                    std::size_t pos;
+                    v[i] = std::stod(item, &pos);
+                    if (pos != item.size() || !std::isfinite(v[i]))
+                    {
+                        return boost::none;
+                    }
+                }
+                catch (const std::exception &e)
+                {
+                    return boost::none;
+                }
+            }
+            if (std::getline(ss, item) || v[2] <= 0 || v[3] <= 0)
+            {
+                return boost::none;
+            }
+            return rect<double>{v[0], v[1], v[2], v[3]};
+        }
+
+        inline void json_write_ids(std::ostream &buf, const std::vector<int32_t> &ids)
+        {
+            buf << "[";
+            for (std::size_t i = 0; i != ids.size(); ++i)
+            {
+                fmt::print(buf, i == 0 ? "{{ \"id\": \"{}\" }}" : ", {{ \"id\": \"{}\" }}", ids[i]);
+            }
+            buf << "]";
+        }
+
         inline void json_write_state(std::ostream &buf, const HttpgdState &state)
         {
             fmt::print(buf, "{{ \"upid\": {}, \"hsize\": {}, \"active\": {} }}", state.upid, state.hsize, state.active);
@@ -95,9 +162,52 @@ namespace httpgd
             return buf.str();
         }
 
-        inline bool authorized(std::shared_ptr<httpgd::HttpgdServerConfig> &m_conf, OB::Belle::Server::Http_Ctx &ctx)
+        // Responds with an embedded web client file. It is sent as is (gzip
+        // encoded) unless the client does not accept it.
+        inline void serve_asset(const Asset &t_asset, OB::Belle::Server::Http_Ctx &ctx)
+        {
+            ctx.res.set("content-type", t_asset.content_type);
+            ctx.res.set("etag", t_asset.etag);
+            ctx.res.set(OB::Belle::Header::cache_control, "no-cache");
+            ctx.res.set("vary", "accept-encoding");
+
+            auto if_none_match = ctx.req.find("if-none-match");
+            if (if_none_match != ctx.req.end() && if_none_match->value() == t_asset.etag)
+            {
+                ctx.res.result(OB::Belle::Status::not_modified);
+                return;
+            }
+
+            ctx.res.result(OB::Belle::Status::ok);
+            auto accept_encoding = ctx.req.find("accept-encoding");
+            if (accept_encoding != ctx.req.end() && accept_encoding->value().find("gzip") != accept_encoding->value().npos)
+            {
+                ctx.res.set("content-encoding", "gzip");
+                ctx.res.body().assign(reinterpret_cast<const char *>(t_asset.gzip), t_asset.gzip_size);
+            }
+            else
+            {
+                ctx.res.body() = gunzip(t_asset);
+            }
+        }
+
+        // Pages with more draw calls (~1 MB of SVG) are streamed in chunks
+        constexpr std::size_t SVG_STREAM_MIN_DRAW_CALLS = 10000;
+        constexpr std::size_t SVG_STREAM_CHUNK_SIZE = 64 * 1024;
+
+        // Hit testing: radius in pixels and number of hits. Large radii
+        // would test most of the page.
+        constexpr double HIT_RADIUS_DEFAULT = 5;
+        constexpr double HIT_RADIUS_MAX = 100;
+        constexpr int HIT_LIMIT_DEFAULT = 10;
+
+        // Separates the documents of a batch response
+        const char *MULTIPART_BOUNDARY = "httpgd-svg-batch-boundary";
+
+        inline bool authorized(const std::shared_ptr<httpgd::HttpgdServerConfig> &m_conf, OB::Belle::Server::Http_Ctx &ctx)
         {
-            if (!m_conf->use_token)
+            // unix domain sockets are protected by file permissions
+            if (!m_conf->use_token || ctx.local)
             {
                 return true;
             }
@@ -117,30 +227,280 @@ namespace httpgd
             return false;
         }
 
-        WebServer::WebServer(std::shared_ptr<HttpgdApiAsync> t_watcher)
-            : m_watcher(t_watcher),
-              m_conf(t_watcher->api_server_config()),
+        ServedDevice::ServedDevice(int t_id, std::shared_ptr<HttpgdApiAsync> t_api, net::io_context &t_io)
+            : id(t_id),
+              api(t_api),
+              conf(t_api->api_server_config()),
+              metrics(t_api->metrics()),
+              broadcast_timer(t_io)
+        {
+        }
+
+        WebServer::WebServer(std::shared_ptr<HttpgdServerConfig> t_conf)
+            : m_conf(t_conf),
               m_app()
         {
         }
 
+        std::shared_ptr<WebServer> WebServer::shared(std::shared_ptr<HttpgdServerConfig> t_conf)
+        {
+            // only accessed from the R main thread
+            static std::weak_ptr<WebServer> instance;
+            auto server = instance.lock();
+            if (!server)
+            {
+                server = std::make_shared<WebServer>(t_conf);
+                instance = server;
+            }
+            return server;
+        }
+
+        bool WebServer::attach(int t_id, std::shared_ptr<HttpgdApiAsync> t_api, bool t_default)
+        {
+            auto device = std::make_shared<ServedDevice>(t_id, t_api, m_app.io());
+            {
+                const std::lock_guard<std::mutex> lock(m_devices_mutex);
+                m_devices[t_id] = device;
+                if (t_default)
+                {
+                    m_default_device = t_id;
+                }
+            }
+
+            if (!m_running)
+            {
+                m_running = start();
+                if (!m_running)
+                {
+                    const std::lock_guard<std::mutex> lock(m_devices_mutex);
+                    m_devices.erase(t_id);
+                    m_default_device = -1;
+                    return false;
+                }
+            }
+
+            // plot changes and revalidated stale SVGs
+            std::weak_ptr<ServedDevice> weak_device = device;
+            t_api->broadcast_notify_change = [this, weak_device]() {
+                if (auto d = weak_device.lock())
+                {
+                    broadcast_state_current(d);
+                }
+            };
+            return true;
+        }
+
+        void WebServer::detach(int t_id)
+        {
+            std::shared_ptr<ServedDevice> device;
+            bool last;
+            {
+                const std::lock_guard<std::mutex> lock(m_devices_mutex);
+                auto it = m_devices.find(t_id);
+                if (it == m_devices.end())
+                {
+                    return;
+                }
+                device = it->second;
+                m_devices.erase(it);
+                if (m_default_device == t_id)
+                {
+                    m_default_device = -1;
+                }
+                last = m_devices.empty();
+            }
+
+            device->api->broadcast_notify_change = nullptr;
+            if (last)
+            {
+                stop();
+                return;
+            }
+            net::post(m_app.io(), [device]() {
+                device->broadcast_timer.cancel();
+            });
+        }
+
+        std::shared_ptr<ServedDevice> WebServer::find_device(OB::Belle::Server::Http_Ctx &ctx)
+        {
+            // routes capture the id of /dev/{id}/... prefixes in path[1]
+            const auto &path = ctx.req.path();
+            int id;
+            const std::lock_guard<std::mutex> lock(m_devices_mutex);
+            if (path.size() > 1 && !path[1].empty())
+            {
+                try
+                {
+                    id = std::stoi(path[1]);
+                }
+                catch (const std::exception &e)
+                {
+                    return nullptr;
+                }
+            }
+            else
+            {
+                id = m_default_device;
+            }
+            auto it = m_devices.find(id);
+            return it == m_devices.end() ? nullptr : it->second;
+        }
+
+        bool WebServer::authorized_any(OB::Belle::Server::Http_Ctx &ctx)
+        {
+            const std::lock_guard<std::mutex> lock(m_devices_mutex);
+            for (auto &entry : m_devices)
+            {
+                if (authorized(entry.second->conf, ctx))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        OB::Belle::Server::fn_on_http WebServer::on_device(fn_on_device t_handler)
+        {
+            return [this, t_handler](OB::Belle::Server::Http_Ctx &ctx) {
+                auto device = find_device(ctx);
+                if (!device)
+                {
+                    throw OB::Belle::Status::not_found;
+                }
+                if (!authorized(device->conf, ctx))
+                {
+                    throw OB::Belle::Status::unauthorized;
+                }
+                t_handler(ctx, *device);
+            };
+        }
+
+        OB::Belle::Server::fn_on_http WebServer::metered(metrics::Route t_route, fn_on_device t_handler)
+        {
+            return on_device([t_route, t_handler](OB::Belle::Server::Http_Ctx &ctx, ServedDevice &device) {
+                metrics::Stopwatch sw;
+                try
+                {
+                    t_handler(ctx, device);
+                }
+                catch (...)
+                {
+                    device.metrics->request(t_route, sw.elapsed(), 0, true);
+                    throw;
+                }
+                if (ctx.stream)
+                {
+                    // recorded when the body is written
+                    auto metrics = device.metrics;
+                    ctx.stream = [t_route, sw, metrics, stream = std::move(ctx.stream)](const OB::Belle::Server::fn_write_chunk &write) {
+                        std::size_t bytes = 0;
+                        try
+                        {
+                            stream([&](const char *data, std::size_t size) {
+                                bytes += size;
+                                write(data, size);
+                            });
+                        }
+                        catch (...)
+                        {
+                            metrics->request(t_route, sw.elapsed(), bytes, true);
+                            throw;
+                        }
+                        metrics->request(t_route, sw.elapsed(), bytes, false);
+                    };
+                    return;
+                }
+                device.metrics->request(t_route, sw.elapsed(), ctx.res.body().size(), false);
+            });
+        }
+
+        std::size_t WebServer::websocket_clients(const ServedDevice &t_device, bool t_default)
+        {
+            auto &channels = m_app.channels();
+            std::size_t n = 0;
+            auto it = channels.find(fmt::format("/dev/{}", t_device.id));
+            if (it != channels.end())
+            {
+                n += it->second.size();
+            }
+            it = channels.find("/");
+            if (t_default && it != channels.end())
+            {
+                n += it->second.size();
+            }
+            return n;
+        }
+
+        std::vector<std::string> WebServer::conflicts(const HttpgdServerConfig &t_conf)
+        {
+            std::vector<std::string> names;
+            if (&t_conf == m_conf.get())
+            {
+                return names;
+            }
+            if (t_conf.host != m_conf->host)
+            {
+                names.emplace_back("host");
+            }
+            // port 0 takes any port
+            if ((t_conf.port < 0) != (m_conf->port < 0) ||
+                (t_conf.port > 0 && t_conf.port != port()))
+            {
+                names.emplace_back("port");
+            }
+            if (!t_conf.socket_path.empty() && t_conf.socket_path != m_conf->socket_path)
+            {
+                names.emplace_back("socket");
+            }
+            if (t_conf.cors != m_conf->cors)
+            {
+                names.emplace_back("cors");
+            }
+            return names;
+        }
+
         unsigned short WebServer::port()
         {
-            return m_app.port();
+            return m_app.tcp_listener() ? m_app.port() : 0;
+        }
+
+        const std::string &WebServer::host() const
+        {
+            return m_conf->host;
+        }
+
+        const std::string &WebServer::socket_path() const
+        {
+            return m_conf->socket_path;
         }
 
         bool WebServer::start()
         {
 
             m_app.address(m_conf->host);
-            m_app.port(m_conf->port);
+            m_app.port(m_conf->port < 0 ? 0 : m_conf->port);
+            m_app.tcp_listener(m_conf->port >= 0);
 
-            if (!m_app.available())
+            if (m_app.tcp_listener() && !m_app.available())
             {
                 // port blocked
                 return false;
             }
 
+            if (!m_conf->socket_path.empty())
+            {
+#ifdef OB_BELLE_CONFIG_LOCAL_ON
+                m_app.local_path(m_conf->socket_path);
+                if (!m_app.local_available())
+                {
+                    // socket in use or path not writable
+                    return false;
+                }
+#else
+                return false; // not supported on this platform
+#endif
+            }
+
             // set default http headers
             OB::Belle::Headers headers;
             headers.set(OB::Belle::Header::server, "httpgd 1.0");
@@ -150,10 +510,12 @@ namespace httpgd
                 headers.set(OB::Belle::Header::access_control_allow_origin, "*");
                 headers.set(OB::Belle::Header::access_control_allow_methods, "GET, POST, PATCH, PUT, DELETE, OPTIONS");
                 headers.set(OB::Belle::Header::access_control_allow_headers, "Origin, Content-Type, X-Auth-Token, X-HTTPGD-TOKEN");
+                headers.set("access-control-expose-headers", "X-HTTPGD-STALE");
             }
             m_app.http_headers(headers);
 
-            m_app.public_dir(m_conf->wwwpath);
+            // the web client is embedded, see serve_asset()
+            m_app.http_static(false);
 
             m_app.websocket(true);
             m_app.signals({SIGINT, SIGTERM});
@@ -167,8 +529,15 @@ namespace httpgd
             });
             m_app.channels()["/"] = OB::Belle::Server::Channel();
 
-            m_app.on_http("/", OB::Belle::Method::get, [&](OB::Belle::Server::Http_Ctx &ctx) {
-                if (!authorized(m_conf, ctx))
+            // The root page and the web client are served for the default
+            // device, or for any device of a shared server.
+            const auto authorized_root = [this](OB::Belle::Server::Http_Ctx &ctx) {
+                auto device = find_device(ctx);
+                return device ? authorized(device->conf, ctx) : authorized_any(ctx);
+            };
+
+            m_app.on_http("/", OB::Belle::Method::get, [=](OB::Belle::Server::Http_Ctx &ctx) {
+                if (!authorized_root(ctx))
                 {
                     throw 401;
                 }
@@ -183,92 +552,135 @@ namespace httpgd
                 ctx.res.result(OB::Belle::Status::ok);
             });
 
-            m_app.on_http("/live", OB::Belle::Method::get, [&](OB::Belle::Server::Http_Ctx &ctx) {
-                if (!authorized(m_conf, ctx))
+            m_app.on_http("/live", OB::Belle::Method::get, [=](OB::Belle::Server::Http_Ctx &ctx) {
+                if (!authorized_root(ctx))
                 {
                     throw 401;
                 }
 
-                ctx.res.set("content-type", "text/html");
-                ctx.res.result(OB::Belle::Status::ok);
-
-                std::string filepath = m_app.public_dir() + "/index.html";
-                ctx.res.body() = read_txt(filepath).get_value_or(
-                    fmt::format("<html><body><b>ERROR:</b> File not found ({}).<br>Please reload package.</body></html>", filepath));
+                serve_asset(*find_asset("index.html"), ctx);
             });
 
-            m_app.on_http("/state", OB::Belle::Method::get, [&](OB::Belle::Server::Http_Ctx &ctx) {
-                if (!authorized(m_conf, ctx))
+            for (std::size_t i = 0; i < ASSETS_COUNT; ++i)
+            {
+                const Asset &asset = ASSETS[i];
+                std::string route = "/";
+                for (const char *c = asset.name; *c; ++c)
                 {
-                    throw OB::Belle::Status::unauthorized;
+                    if (*c == '.')
+                    {
+                        route += '\\';
+                    }
+                    route += *c;
                 }
+                m_app.on_http(route, OB::Belle::Method::get, [&asset](OB::Belle::Server::Http_Ctx &ctx) {
+                    serve_asset(asset, ctx);
+                });
+            }
 
+            m_app.on_http("^(?:/dev/([0-9]+))?/state$", OB::Belle::Method::get, metered(metrics::Route::state, [&](OB::Belle::Server::Http_Ctx &ctx, ServedDevice &device) {
                 ctx.res.set("content-type", "application/json");
                 ctx.res.result(OB::Belle::Status::ok);
 
-                ctx.res.body() = json_make_state(m_watcher->api_state());
-            });
-
-            m_app.on_http("/plots", OB::Belle::Method::get, [&](OB::Belle::Server::Http_Ctx &ctx) {
-                if (!authorized(m_conf, ctx))
-                {
-                    throw OB::Belle::Status::unauthorized;
-                }
+                ctx.res.body() = json_make_state(device.api->api_state());
+            }));
 
+            m_app.on_http("^(?:/dev/([0-9]+))?/plots$", OB::Belle::Method::get, metered(metrics::Route::plots, [&](OB::Belle::Server::Http_Ctx &ctx, ServedDevice &device) {
                 HttpgdQueryResults qr;
 
                 auto qparams = ctx.req.params();
                 auto p_index = param_int(qparams, "index");
                 auto p_limit = param_int(qparams, "limit");
+                auto p_since = param_int(qparams, "since");
+                auto p_cursor = param_cursor(qparams, "cursor");
+
+                std::stringstream buf;
+                if (p_since)
+                {
+                    auto changes = device.api->api_query_changes(*p_since);
+                    buf << "{ \"state\": ";
+                    json_write_state(buf, changes.state);
+                    if (changes.reset)
+                    {
+                        buf << ", \"reset\": true, \"plots\": ";
+                        json_write_ids(buf, changes.ids);
+                    }
+                    else
+                    {
+                        buf << ", \"reset\": false, \"added\": ";
+                        json_write_ids(buf, changes.added);
+                        buf << ", \"removed\": ";
+                        json_write_ids(buf, changes.removed);
+                        buf << ", \"changed\": ";
+                        json_write_ids(buf, changes.changed);
+                    }
+                    buf << " }";
 
-                if (p_limit)
+                    ctx.res.set("content-type", "application/json");
+                    ctx.res.result(OB::Belle::Status::ok);
+                    ctx.res.body() = buf.str();
+                    return;
+                }
+
+                if (p_cursor || (p_limit && !p_index))
+                {
+                    qr = device.api->api_query_after(p_cursor.get_value_or(-1), p_limit.get_value_or(-1));
+                }
+                else if (p_limit)
                 {
-                    qr = m_watcher->api_query_range(p_index.get_value_or(0), *p_limit);
+                    qr = device.api->api_query_range(*p_index, *p_limit);
                 }
                 else if (p_index)
                 {
-                    qr = m_watcher->api_query_index(*p_index);
+                    qr = device.api->api_query_index(*p_index);
                 }
                 else
                 {
-                    qr = m_watcher->api_query_all();
+                    qr = device.api->api_query_all();
                 }
 
-                std::stringstream buf;
                 buf << "{ \"state\": ";
                 json_write_state(buf, qr.state);
-                buf << ", \"plots\": [";
-
-                for (const auto &id : qr.ids)
+                buf << ", \"plots\": ";
+                json_write_ids(buf, qr.ids);
+                if (qr.more && !qr.ids.empty())
                 {
-                    if (&id != &qr.ids[0])
-                    {
-                        buf << ", ";
-                    }
-                    fmt::print(buf, "{{ \"id\": \"{}\" }}", id);
+                    fmt::print(buf, ", \"next\": \"{}\"", cursor_make(qr.ids.back()));
                 }
-                buf << "] }";
+                buf << " }";
 
                 ctx.res.set("content-type", "application/json");
                 ctx.res.result(OB::Belle::Status::ok);
                 ctx.res.body() = buf.str();
-            });
+            }));
 
-            m_app.on_http("/svg", OB::Belle::Method::get, [&](OB::Belle::Server::Http_Ctx &ctx) {
-                if (!authorized(m_conf, ctx))
-                {
-                    throw OB::Belle::Status::unauthorized;
-                }
+            m_app.on_http("^(?:/dev/([0-9]+))?/svg$", OB::Belle::Method::get, metered(metrics::Route::svg, [&](OB::Belle::Server::Http_Ctx &ctx, ServedDevice &device) {
+                trace::Request trace_request("/svg", device.id);
 
                 auto qparams = ctx.req.params();
                 auto p_width = param_double(qparams, "width");
                 auto p_height = param_double(qparams, "height");
                 auto p_id = param_long(qparams, "id");
+                auto p_timeout = param_double(qparams, "timeout");
+                auto p_client = param_str(qparams, "client");
+                auto p_gen = param_long(qparams, "gen");
+                const bool binary = param_str(qparams, "format").get_value_or("svg") == "bin";
+                auto p_viewport = param_rect(qparams, "viewport");
+                if (!p_viewport && qparams.find("viewport") != qparams.end())
+                {
+                    throw OB::Belle::Status::bad_request;
+                }
+
+                boost::optional<RenderTicket> ticket;
+                if (p_client && p_gen && *p_gen >= 0)
+                {
+                    ticket = RenderTicket{*p_client, static_cast<uint64_t>(*p_gen)};
+                }
 
                 boost::optional<int> index;
                 if (p_id)
                 {
-                    index = m_watcher->api_index(*p_id);
+                    index = device.api->api_index(*p_id);
                 }
                 else
                 {
@@ -277,61 +689,197 @@ namespace httpgd
 
                 if (index)
                 {
-                    ctx.res.set("content-type", "image/svg+xml");
+                    bool stale = false;
+                    auto page = std::make_shared<PageSnapshot>(device.api->api_svg_page(*index, p_width.get_value_or(-1), p_height.get_value_or(-1),
+                                                                                       p_timeout.get_value_or(device.conf->stale_timeout), ticket, stale));
+                    page->viewport = p_viewport;
+                    ctx.res.set("content-type", binary ? "application/octet-stream" : "image/svg+xml");
                     ctx.res.result(OB::Belle::Status::ok);
-                    ctx.res.body() = m_watcher->api_svg(*index, p_width.get_value_or(-1), p_height.get_value_or(-1));
+                    if (stale)
+                    {
+                        ctx.res.set("X-HTTPGD-STALE", "1");
+                        ctx.res.set(OB::Belle::Header::cache_control, "no-store");
+                    }
+                    if (binary)
+                    {
+                        ctx.res.body() = page->bin();
+                    }
+                    else if (page->draw_calls() >= SVG_STREAM_MIN_DRAW_CALLS)
+                    {
+                        // large pages are written while they are serialized
+                        // (by the stream pool, which continues the trace)
+                        ctx.stream = [page, trace_context = trace::current()](const OB::Belle::Server::fn_write_chunk &write) {
+                            trace::Scope scope(trace_context);
+                            page->svg(SVG_STREAM_CHUNK_SIZE, [&](fmt::memory_buffer &buf) {
+                                write(buf.data(), buf.size());
+                            });
+                        };
+                    }
+                    else
+                    {
+                        ctx.res.body() = page->svg();
+                    }
                 }
                 else
                 {
                     throw OB::Belle::Status::not_found;
                 }
-            });
+            }));
 
-            m_app.on_http("/remove", OB::Belle::Method::get, [&](OB::Belle::Server::Http_Ctx &ctx) {
-                if (!authorized(m_conf, ctx))
+            m_app.on_http("^(?:/dev/([0-9]+))?/svg/batch$", OB::Belle::Method::get, metered(metrics::Route::svg_batch, [&](OB::Belle::Server::Http_Ctx &ctx, ServedDevice &device) {
+                auto qparams = ctx.req.params();
+                auto p_width = param_double(qparams, "width");
+                auto p_height = param_double(qparams, "height");
+                auto p_ids = param_str(qparams, "ids");
+
+                std::vector<page_id_t> ids;
+                if (p_ids)
                 {
-                    throw OB::Belle::Status::unauthorized;
+                    std::stringstream ss(*p_ids);
+                    std::string item;
+                    while (std::getline(ss, item, ','))
+                    {
+                        page_id_t id;
+                        try
+                        {
+                            id = std::stol(item);
+                        }
+                        catch (const std::exception &e)
+                        {
+                            throw OB::Belle::Status::bad_request;
+                        }
+                        if (!device.api->api_index(id))
+                        {
+                            throw OB::Belle::Status::not_found;
+                        }
+                        ids.push_back(id);
+                    }
+                }
+                else
+                {
+                    ids = device.api->api_query_all().ids;
                 }
 
+                // plots removed before they are serialized are empty
+                auto pages = std::make_shared<std::vector<PageSnapshot>>(device.api->api_svg_batch_pages(ids, p_width.get_value_or(-1), p_height.get_value_or(-1)));
+
+                // one part per page, only one page is serialized at a time
+                ctx.res.set("content-type", fmt::format("multipart/mixed; boundary={}", MULTIPART_BOUNDARY));
+                ctx.res.result(OB::Belle::Status::ok);
+                ctx.stream = [pages, ids](const OB::Belle::Server::fn_write_chunk &write) {
+                    fmt::memory_buffer head;
+                    for (std::size_t i = 0; i < pages->size(); ++i)
+                    {
+                        head.clear();
+                        fmt::format_to(head, "--{}\r\nContent-Type: image/svg+xml\r\nContent-ID: <{}>\r\n\r\n", MULTIPART_BOUNDARY, ids[i]);
+                        write(head.data(), head.size());
+                        (*pages)[i].svg(SVG_STREAM_CHUNK_SIZE, [&](fmt::memory_buffer &buf) {
+                            write(buf.data(), buf.size());
+                        });
+                        write("\r\n", 2);
+                    }
+                    head.clear();
+                    fmt::format_to(head, "--{}--\r\n", MULTIPART_BOUNDARY);
+                    write(head.data(), head.size());
+                };
+            }));
+
+            m_app.on_http("^(?:/dev/([0-9]+))?/remove$", OB::Belle::Method::get, metered(metrics::Route::remove, [&](OB::Belle::Server::Http_Ctx &ctx, ServedDevice &device) {
                 auto qparams = ctx.req.params();
                 auto p_id = param_long(qparams, "id");
 
                 boost::optional<int> index;
                 if (p_id)
                 {
-                    index = m_watcher->api_index(*p_id);
+                    index = device.api->api_index(*p_id);
                 }
                 else
                 {
                     index = param_int(qparams, "index").get_value_or(-1);
                 }
 
-                if (index && m_watcher->api_remove(*index))
+                if (index && device.api->api_remove(*index))
                 {
                     ctx.res.set("content-type", "application/json");
                     ctx.res.result(OB::Belle::Status::ok);
 
-                    ctx.res.body() = json_make_state(m_watcher->api_state());
+                    ctx.res.body() = json_make_state(device.api->api_state());
                 }
                 else
                 {
                     throw OB::Belle::Status::not_found;
                 }
-            });
+            }));
+
+            m_app.on_http("^(?:/dev/([0-9]+))?/clear$", OB::Belle::Method::get, metered(metrics::Route::clear, [&](OB::Belle::Server::Http_Ctx &ctx, ServedDevice &device) {
+                device.api->api_clear();
 
-            m_app.on_http("/clear", OB::Belle::Method::get, [&](OB::Belle::Server::Http_Ctx &ctx) {
-                if (!authorized(m_conf, ctx))
+                ctx.res.set("content-type", "application/json");
+                ctx.res.result(OB::Belle::Status::ok);
+
+                ctx.res.body() = json_make_state(device.api->api_state());
+            }));
+
+            m_app.on_http("^(?:/dev/([0-9]+))?/hit$", OB::Belle::Method::get, metered(metrics::Route::hit, [&](OB::Belle::Server::Http_Ctx &ctx, ServedDevice &device) {
+                auto qparams = ctx.req.params();
+                auto p_x = param_double(qparams, "x");
+                auto p_y = param_double(qparams, "y");
+                const double radius = param_double(qparams, "r").get_value_or(HIT_RADIUS_DEFAULT);
+                const int limit = param_int(qparams, "limit").get_value_or(HIT_LIMIT_DEFAULT);
+                auto p_id = param_long(qparams, "id");
+                if (!p_x || !p_y || !std::isfinite(*p_x) || !std::isfinite(*p_y) || !(radius >= 0) || limit < 1)
                 {
-                    throw OB::Belle::Status::unauthorized;
+                    throw OB::Belle::Status::bad_request;
                 }
 
-                m_watcher->api_clear();
+                boost::optional<int> index;
+                if (p_id)
+                {
+                    index = device.api->api_index(*p_id);
+                }
+                else
+                {
+                    index = param_int(qparams, "index").get_value_or(-1);
+                }
 
+                // no render: the plot as the client last got it
+                const auto hits = index ? device.api->api_hit(*index, param_double(qparams, "width").get_value_or(-1), param_double(qparams, "height").get_value_or(-1),
+                                                              {*p_x, *p_y}, std::min(radius, HIT_RADIUS_MAX), static_cast<std::size_t>(limit))
+                                        : boost::none;
+                if (!hits)
+                {
+                    throw OB::Belle::Status::not_found;
+                }
                 ctx.res.set("content-type", "application/json");
                 ctx.res.result(OB::Belle::Status::ok);
+                ctx.res.body() = *hits;
+            }));
 
-                ctx.res.body() = json_make_state(m_watcher->api_state());
-            });
+            m_app.on_http("^(?:/dev/([0-9]+))?/metrics$", OB::Belle::Method::get, on_device([&](OB::Belle::Server::Http_Ctx &ctx, ServedDevice &device) {
+                bool is_default;
+                {
+                    const std::lock_guard<std::mutex> lock(m_devices_mutex);
+                    is_default = device.id == m_default_device;
+                }
+
+                fmt::memory_buffer buf;
+                device.metrics->write(buf, websocket_clients(device, is_default));
+
+                ctx.res.set("content-type", "text/plain; version=0.0.4");
+                ctx.res.result(OB::Belle::Status::ok);
+                ctx.res.body() = fmt::to_string(buf);
+            }));
+
+            // tracing is process wide, clients only get the traces of the
+            // requests to their device
+            m_app.on_http("^(?:/dev/([0-9]+))?/trace$", OB::Belle::Method::get, on_device([&](OB::Belle::Server::Http_Ctx &ctx, ServedDevice &device) {
+                fmt::memory_buffer buf;
+                trace::write_json(buf, device.id);
+
+                ctx.res.set("content-type", "application/json");
+                ctx.res.result(OB::Belle::Status::ok);
+                ctx.res.body() = fmt::to_string(buf);
+            }));
 
             // set custom error callback
             m_app.on_http_error([](OB::Belle::Server::Http_Ctx &ctx) {
@@ -348,8 +896,9 @@ namespace httpgd
                 ctx.res.body() = res.str();
             });
 
-            // handle ws connections to index room '/'
-            m_app.on_websocket("/",
+            // handle ws connections to the rooms '/' (default device) and
+            // '/dev/{id}'
+            m_app.on_websocket("^/(?:dev/[0-9]+)?$",
                                // on data: called after every websocket read
                                [](OB::Belle::Server::Websocket_Ctx &ctx) {
                                    // register the route
@@ -376,22 +925,74 @@ namespace httpgd
             {
                 m_server_thread.join();
             }
+            m_running = false;
         }
 
-        void WebServer::broadcast_state(const HttpgdState &state)
+        void WebServer::broadcast_state(ServedDevice &t_device, const HttpgdState &state)
         {
-            if (state.upid != m_last_upid || state.active != m_last_active)
+            if (state.upid == t_device.last_upid && state.active == t_device.last_active)
             {
-                m_app.channels().at("/").broadcast(json_make_state(state));
-                m_last_upid = state.upid;
-                m_last_active = state.active;
+                return;
             }
+            t_device.last_upid = state.upid;
+            t_device.last_active = state.active;
+
+            bool is_default;
+            {
+                const std::lock_guard<std::mutex> lock(m_devices_mutex);
+                is_default = t_device.id == m_default_device;
+            }
+
+            const std::string msg = json_make_state(state);
+            auto &channels = m_app.channels();
+            auto it = channels.find(fmt::format("/dev/{}", t_device.id));
+            if (it != channels.end())
+            {
+                it->second.broadcast(std::string(msg));
+            }
+            it = channels.find("/");
+            if (is_default && it != channels.end())
+            {
+                it->second.broadcast(std::string(msg));
+            }
+        }
+
+        void WebServer::broadcast_state_current(const std::shared_ptr<ServedDevice> &t_device)
+        {
+            if (t_device->broadcast_pending.exchange(true))
+            {
+                return; // will be picked up by the scheduled broadcast
+            }
+            net::post(m_app.io(), [this, t_device]() {
+                broadcast_schedule(t_device);
+            });
+        }
+
+        void WebServer::broadcast_schedule(const std::shared_ptr<ServedDevice> &t_device)
+        {
+            const auto next = t_device->last_broadcast + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                                             std::chrono::duration<double>(t_device->conf->broadcast_interval));
+            if (std::chrono::steady_clock::now() >= next)
+            {
+                broadcast_flush(*t_device);
+                return;
+            }
+            t_device->broadcast_timer.expires_at(next);
+            t_device->broadcast_timer.async_wait([this, t_device](const boost::system::error_code &ec) {
+                if (!ec)
+                {
+                    broadcast_flush(*t_device);
+                }
+            });
         }
 
-        void WebServer::broadcast_state_current()
+        void WebServer::broadcast_flush(ServedDevice &t_device)
         {
-            HttpgdState state = m_watcher->api_state();
-            broadcast_state(state);
+            // reset before reading the state, so that later changes get
+            // scheduled again and the final state is always delivered
+            t_device.broadcast_pending = false;
+            t_device.last_broadcast = std::chrono::steady_clock::now();
+            broadcast_state(t_device, t_device.api->api_state());
         }
 
     } // namespace web
@@ -4,7 +4,13 @@
 #include <memory>
 #include <belle.h>
 #include "HttpgdApiAsync.h"
+#include "HttpgdMetrics.h"
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
 #include <thread>
+#include <vector>
 
 namespace httpgd
 {
@@ -12,29 +18,76 @@ namespace httpgd
     {
         namespace net = boost::asio; // from <boost/asio.hpp>
 
+        // A device that is served by a web server.
+        struct ServedDevice
+        {
+            ServedDevice(int t_id, std::shared_ptr<HttpgdApiAsync> t_api, net::io_context &t_io);
+
+            const int id;
+            const std::shared_ptr<HttpgdApiAsync> api;
+            const std::shared_ptr<HttpgdServerConfig> conf;
+            const std::shared_ptr<metrics::Metrics> metrics;
+
+            // Websocket state broadcasts (only used in the server thread,
+            // except for broadcast_pending)
+            std::atomic<bool> broadcast_pending{false};
+            net::steady_timer broadcast_timer;
+            std::chrono::steady_clock::time_point last_broadcast;
+            int last_upid = -1;
+            bool last_active = true;
+        };
+
         class WebServer
         {
         public:
+            // Host, port, CORS and www path are taken from t_conf.
+            explicit WebServer(std::shared_ptr<HttpgdServerConfig> t_conf);
 
-            WebServer(std::shared_ptr<HttpgdApiAsync> t_watcher);
+            // Process wide server shared by devices, created with t_conf on
+            // first use and stopped when the last device detaches.
+            static std::shared_ptr<WebServer> shared(std::shared_ptr<HttpgdServerConfig> t_conf);
 
-            bool start();
-            void stop();
+            // Devices are served at /dev/{id}/..., the default device also
+            // without prefix. Starts the server with the first device.
+            bool attach(int t_id, std::shared_ptr<HttpgdApiAsync> t_api, bool t_default);
+            void detach(int t_id);
+            // Names of the server settings in t_conf (host, port, socket,
+            // cors) that differ from the ones the server runs with.
+            std::vector<std::string> conflicts(const HttpgdServerConfig &t_conf);
             unsigned short port();
-            void broadcast_state(const HttpgdState &state);
-            void broadcast_state_current();
+            const std::string &host() const;
+            const std::string &socket_path() const;
 
         private:
-            std::shared_ptr<HttpgdApiAsync> m_watcher;
+            using fn_on_device = std::function<void(OB::Belle::Server::Http_Ctx &, ServedDevice &)>;
+
             std::shared_ptr<HttpgdServerConfig> m_conf;
             OB::Belle::Server m_app;
-            int m_last_upid = -1;
-            bool m_last_active = true;
             std::thread m_server_thread;
+            bool m_running = false;
+
+            std::mutex m_devices_mutex;
+            std::map<int, std::shared_ptr<ServedDevice>> m_devices;
+            int m_default_device = -1;
 
+            bool start();
+            void stop();
             void run();
+
+            std::shared_ptr<ServedDevice> find_device(OB::Belle::Server::Http_Ctx &ctx);
+            bool authorized_any(OB::Belle::Server::Http_Ctx &ctx);
+            OB::Belle::Server::fn_on_http on_device(fn_on_device t_handler);
+            OB::Belle::Server::fn_on_http metered(metrics::Route t_route, fn_on_device t_handler);
+            std::size_t websocket_clients(const ServedDevice &t_device, bool t_default);
+
+            // Thread safe. State changes are coalesced and broadcasted from
+            // the server thread at most once per broadcast interval.
+            void broadcast_state_current(const std::shared_ptr<ServedDevice> &t_device);
+            void broadcast_schedule(const std::shared_ptr<ServedDevice> &t_device);
+            void broadcast_flush(ServedDevice &t_device);
+            void broadcast_state(ServedDevice &t_device, const HttpgdState &state);
         };
     } // namespace web
 } // namespace httpgd
 
-#endif
\ No newline at end of file
+#endif
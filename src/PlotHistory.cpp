@@ -8,6 +8,7 @@
 #include <string>
 
 #include "PlotHistory.h"
+#include "HttpgdTrace.h"
 
 #include "DebugPrint.h"
 
@@ -18,6 +19,7 @@ namespace httpgd
         pGEDevDesc gdd = desc2GEDesc(dd);
         if (gdd->dirty)
         { // avoid trying to replay list if there has been no drawing
+            trace::Span span("replay");
             try
             {
                 cpp11::safe[GEplayDisplayList](gdd);
@@ -74,6 +76,7 @@ namespace httpgd
         SEXP snap = R_NilValue;
         if (get(t_index, &snap))
         {
+            trace::Span span("replay");
             try
             {
                 cpp11::safe[GEplaySnapshot](snap, desc2GEDesc(dd));
@@ -5,10 +5,10 @@
 #include "cpp11/declarations.hpp"
 
 // Httpgd.cpp
-bool httpgd_(std::string host, int port, std::string bg, double width, double height, double pointsize, cpp11::list aliases, bool cors, std::string token, bool webserver, bool silent, bool fix_text_width, std::string extra_css);
-extern "C" SEXP _httpgd_httpgd_(SEXP host, SEXP port, SEXP bg, SEXP width, SEXP height, SEXP pointsize, SEXP aliases, SEXP cors, SEXP token, SEXP webserver, SEXP silent, SEXP fix_text_width, SEXP extra_css) {
+bool httpgd_(std::string host, int port, std::string socket_path, std::string bg, double width, double height, double pointsize, cpp11::list aliases, bool cors, std::string token, bool webserver, bool silent, bool fix_text_width, std::string extra_css, double stale_timeout, double broadcast_interval, bool shared_server);
+extern "C" SEXP _httpgd_httpgd_(SEXP host, SEXP port, SEXP socket_path, SEXP bg, SEXP width, SEXP height, SEXP pointsize, SEXP aliases, SEXP cors, SEXP token, SEXP webserver, SEXP silent, SEXP fix_text_width, SEXP extra_css, SEXP stale_timeout, SEXP broadcast_interval, SEXP shared_server) {
   BEGIN_CPP11
-    return cpp11::as_sexp(httpgd_(cpp11::as_cpp<cpp11::decay_t<std::string>>(host), cpp11::as_cpp<cpp11::decay_t<int>>(port), cpp11::as_cpp<cpp11::decay_t<std::string>>(bg), cpp11::as_cpp<cpp11::decay_t<double>>(width), cpp11::as_cpp<cpp11::decay_t<double>>(height), cpp11::as_cpp<cpp11::decay_t<double>>(pointsize), cpp11::as_cpp<cpp11::decay_t<cpp11::list>>(aliases), cpp11::as_cpp<cpp11::decay_t<bool>>(cors), cpp11::as_cpp<cpp11::decay_t<std::string>>(token), cpp11::as_cpp<cpp11::decay_t<bool>>(webserver), cpp11::as_cpp<cpp11::decay_t<bool>>(silent), cpp11::as_cpp<cpp11::decay_t<bool>>(fix_text_width), cpp11::as_cpp<cpp11::decay_t<std::string>>(extra_css)));
+    return cpp11::as_sexp(httpgd_(cpp11::as_cpp<cpp11::decay_t<std::string>>(host), cpp11::as_cpp<cpp11::decay_t<int>>(port), cpp11::as_cpp<cpp11::decay_t<std::string>>(socket_path), cpp11::as_cpp<cpp11::decay_t<std::string>>(bg), cpp11::as_cpp<cpp11::decay_t<double>>(width), cpp11::as_cpp<cpp11::decay_t<double>>(height), cpp11::as_cpp<cpp11::decay_t<double>>(pointsize), cpp11::as_cpp<cpp11::decay_t<cpp11::list>>(aliases), cpp11::as_cpp<cpp11::decay_t<bool>>(cors), cpp11::as_cpp<cpp11::decay_t<std::string>>(token), cpp11::as_cpp<cpp11::decay_t<bool>>(webserver), cpp11::as_cpp<cpp11::decay_t<bool>>(silent), cpp11::as_cpp<cpp11::decay_t<bool>>(fix_text_width), cpp11::as_cpp<cpp11::decay_t<std::string>>(extra_css), cpp11::as_cpp<cpp11::decay_t<double>>(stale_timeout), cpp11::as_cpp<cpp11::decay_t<double>>(broadcast_interval), cpp11::as_cpp<cpp11::decay_t<bool>>(shared_server)));
   END_CPP11
 }
 // Httpgd.cpp
@@ -40,6 +40,27 @@ extern "C" SEXP _httpgd_httpgd_svg_id_(SEXP devnum, SEXP id, SEXP width, SEXP he
   END_CPP11
 }
 // Httpgd.cpp
+bool httpgd_svg_file_(int devnum, int page, std::string id, double width, double height, std::string file, bool compress);
+extern "C" SEXP _httpgd_httpgd_svg_file_(SEXP devnum, SEXP page, SEXP id, SEXP width, SEXP height, SEXP file, SEXP compress) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(httpgd_svg_file_(cpp11::as_cpp<cpp11::decay_t<int>>(devnum), cpp11::as_cpp<cpp11::decay_t<int>>(page), cpp11::as_cpp<cpp11::decay_t<std::string>>(id), cpp11::as_cpp<cpp11::decay_t<double>>(width), cpp11::as_cpp<cpp11::decay_t<double>>(height), cpp11::as_cpp<cpp11::decay_t<std::string>>(file), cpp11::as_cpp<cpp11::decay_t<bool>>(compress)));
+  END_CPP11
+}
+// Httpgd.cpp
+cpp11::writable::strings httpgd_svg_batch_(int devnum, cpp11::integers pages, cpp11::strings ids, double width, double height);
+extern "C" SEXP _httpgd_httpgd_svg_batch_(SEXP devnum, SEXP pages, SEXP ids, SEXP width, SEXP height) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(httpgd_svg_batch_(cpp11::as_cpp<cpp11::decay_t<int>>(devnum), cpp11::as_cpp<cpp11::decay_t<cpp11::integers>>(pages), cpp11::as_cpp<cpp11::decay_t<cpp11::strings>>(ids), cpp11::as_cpp<cpp11::decay_t<double>>(width), cpp11::as_cpp<cpp11::decay_t<double>>(height)));
+  END_CPP11
+}
+// Httpgd.cpp
+cpp11::writable::strings httpgd_svg_batch_files_(int devnum, cpp11::integers pages, cpp11::strings ids, double width, double height, std::string dir);
+extern "C" SEXP _httpgd_httpgd_svg_batch_files_(SEXP devnum, SEXP pages, SEXP ids, SEXP width, SEXP height, SEXP dir) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(httpgd_svg_batch_files_(cpp11::as_cpp<cpp11::decay_t<int>>(devnum), cpp11::as_cpp<cpp11::decay_t<cpp11::integers>>(pages), cpp11::as_cpp<cpp11::decay_t<cpp11::strings>>(ids), cpp11::as_cpp<cpp11::decay_t<double>>(width), cpp11::as_cpp<cpp11::decay_t<double>>(height), cpp11::as_cpp<cpp11::decay_t<std::string>>(dir)));
+  END_CPP11
+}
+// Httpgd.cpp
 bool httpgd_remove_(int devnum, int page);
 extern "C" SEXP _httpgd_httpgd_remove_(SEXP devnum, SEXP page) {
   BEGIN_CPP11
@@ -61,35 +82,68 @@ extern "C" SEXP _httpgd_httpgd_id_(SEXP devnum, SEXP page, SEXP limit) {
   END_CPP11
 }
 // Httpgd.cpp
+cpp11::writable::list httpgd_id_vector_(int devnum, int page, int limit);
+extern "C" SEXP _httpgd_httpgd_id_vector_(SEXP devnum, SEXP page, SEXP limit) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(httpgd_id_vector_(cpp11::as_cpp<cpp11::decay_t<int>>(devnum), cpp11::as_cpp<cpp11::decay_t<int>>(page), cpp11::as_cpp<cpp11::decay_t<int>>(limit)));
+  END_CPP11
+}
+// Httpgd.cpp
 bool httpgd_clear_(int devnum);
 extern "C" SEXP _httpgd_httpgd_clear_(SEXP devnum) {
   BEGIN_CPP11
     return cpp11::as_sexp(httpgd_clear_(cpp11::as_cpp<cpp11::decay_t<int>>(devnum)));
   END_CPP11
 }
+// Httpgd.cpp
+bool httpgd_trace_(bool enable);
+extern "C" SEXP _httpgd_httpgd_trace_(SEXP enable) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(httpgd_trace_(cpp11::as_cpp<cpp11::decay_t<bool>>(enable)));
+  END_CPP11
+}
+// Httpgd.cpp
+std::string httpgd_trace_json_(bool clear);
+extern "C" SEXP _httpgd_httpgd_trace_json_(SEXP clear) {
+  BEGIN_CPP11
+    return cpp11::as_sexp(httpgd_trace_json_(cpp11::as_cpp<cpp11::decay_t<bool>>(clear)));
+  END_CPP11
+}
 
 extern "C" {
 /* .Call calls */
-extern SEXP _httpgd_httpgd_(SEXP, SEXP, SEXP, SEXP, SEXP, SEXP, SEXP, SEXP, SEXP, SEXP, SEXP, SEXP, SEXP);
+extern SEXP _httpgd_httpgd_(SEXP, SEXP, SEXP, SEXP, SEXP, SEXP, SEXP, SEXP, SEXP, SEXP, SEXP, SEXP, SEXP, SEXP, SEXP, SEXP, SEXP);
 extern SEXP _httpgd_httpgd_clear_(SEXP);
 extern SEXP _httpgd_httpgd_id_(SEXP, SEXP, SEXP);
+extern SEXP _httpgd_httpgd_id_vector_(SEXP, SEXP, SEXP);
 extern SEXP _httpgd_httpgd_random_token_(SEXP);
 extern SEXP _httpgd_httpgd_remove_(SEXP, SEXP);
 extern SEXP _httpgd_httpgd_remove_id_(SEXP, SEXP);
 extern SEXP _httpgd_httpgd_state_(SEXP);
 extern SEXP _httpgd_httpgd_svg_(SEXP, SEXP, SEXP, SEXP);
+extern SEXP _httpgd_httpgd_svg_batch_(SEXP, SEXP, SEXP, SEXP, SEXP);
+extern SEXP _httpgd_httpgd_svg_batch_files_(SEXP, SEXP, SEXP, SEXP, SEXP, SEXP);
+extern SEXP _httpgd_httpgd_svg_file_(SEXP, SEXP, SEXP, SEXP, SEXP, SEXP, SEXP);
 extern SEXP _httpgd_httpgd_svg_id_(SEXP, SEXP, SEXP, SEXP);
+extern SEXP _httpgd_httpgd_trace_(SEXP);
+extern SEXP _httpgd_httpgd_trace_json_(SEXP);
 
 static const R_CallMethodDef CallEntries[] = {
-    {"_httpgd_httpgd_",              (DL_FUNC) &_httpgd_httpgd_,              13},
-    {"_httpgd_httpgd_clear_",        (DL_FUNC) &_httpgd_httpgd_clear_,         1},
-    {"_httpgd_httpgd_id_",           (DL_FUNC) &_httpgd_httpgd_id_,            3},
-    {"_httpgd_httpgd_random_token_", (DL_FUNC) &_httpgd_httpgd_random_token_,  1},
-    {"_httpgd_httpgd_remove_",       (DL_FUNC) &_httpgd_httpgd_remove_,        2},
-    {"_httpgd_httpgd_remove_id_",    (DL_FUNC) &_httpgd_httpgd_remove_id_,     2},
-    {"_httpgd_httpgd_state_",        (DL_FUNC) &_httpgd_httpgd_state_,         1},
-    {"_httpgd_httpgd_svg_",          (DL_FUNC) &_httpgd_httpgd_svg_,           4},
-    {"_httpgd_httpgd_svg_id_",       (DL_FUNC) &_httpgd_httpgd_svg_id_,        4},
+    {"_httpgd_httpgd_",                 (DL_FUNC) &_httpgd_httpgd_,                 17},
+    {"_httpgd_httpgd_clear_",           (DL_FUNC) &_httpgd_httpgd_clear_,            1},
+    {"_httpgd_httpgd_id_",              (DL_FUNC) &_httpgd_httpgd_id_,               3},
+    {"_httpgd_httpgd_id_vector_",       (DL_FUNC) &_httpgd_httpgd_id_vector_,        3},
+    {"_httpgd_httpgd_random_token_",    (DL_FUNC) &_httpgd_httpgd_random_token_,     1},
+    {"_httpgd_httpgd_remove_",          (DL_FUNC) &_httpgd_httpgd_remove_,           2},
+    {"_httpgd_httpgd_remove_id_",       (DL_FUNC) &_httpgd_httpgd_remove_id_,        2},
+    {"_httpgd_httpgd_state_",           (DL_FUNC) &_httpgd_httpgd_state_,            1},
+    {"_httpgd_httpgd_svg_",             (DL_FUNC) &_httpgd_httpgd_svg_,              4},
+    {"_httpgd_httpgd_svg_batch_",       (DL_FUNC) &_httpgd_httpgd_svg_batch_,        5},
+    {"_httpgd_httpgd_svg_batch_files_", (DL_FUNC) &_httpgd_httpgd_svg_batch_files_,  6},
+    {"_httpgd_httpgd_svg_file_",        (DL_FUNC) &_httpgd_httpgd_svg_file_,         7},
+    {"_httpgd_httpgd_svg_id_",          (DL_FUNC) &_httpgd_httpgd_svg_id_,           4},
+    {"_httpgd_httpgd_trace_",           (DL_FUNC) &_httpgd_httpgd_trace_,            1},
+    {"_httpgd_httpgd_trace_json_",      (DL_FUNC) &_httpgd_httpgd_trace_json_,       1},
     {NULL, NULL, 0}
 };
 }
@@ -115,6 +115,14 @@ SOFTWARE.
 
 #include <boost/config.hpp>
 
+// unix domain socket support
+#if defined(BOOST_ASIO_HAS_LOCAL_SOCKETS) && !defined(_WIN32) && !defined(OB_BELLE_CONFIG_LOCAL_OFF)
+#define OB_BELLE_CONFIG_LOCAL_ON
+#include <boost/asio/local/stream_protocol.hpp>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #include <cstdio>
 #include <cctype>
 #include <cstdlib>
@@ -142,6 +150,9 @@ SOFTWARE.
 #include <limits>
 #include <type_traits>
 #include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
 
 namespace OB::Belle
 {
@@ -1031,12 +1042,22 @@ public:
   // NOTE Channels implementation is NOT thread safe
   using Channels = std::unordered_map<std::string, Channel>;
 
+  // writes a chunk of a streamed response body, throws on socket errors
+  using fn_write_chunk = std::function<void(char const*, std::size_t)>;
+
   template<typename Body>
   struct Http_Ctx_Basic
   {
     Request req {};
     http::response<Body> res {};
     std::shared_ptr<void> data {nullptr};
+
+    // when set by the user function, the response body is written by it
+    // in chunks (chunked transfer encoding) after the headers of res
+    std::function<void(fn_write_chunk const&)> stream {};
+
+    // request was received over the unix domain socket
+    bool local {false};
   }; // class Http_Ctx_Basic
 
   using Http_Ctx = Http_Ctx_Basic<http::string_body>;
@@ -1106,6 +1127,101 @@ public:
 
 private:
 
+  // runs the producers of streamed response bodies on at most max_threads
+  // threads, which are started on demand, further producers are queued
+  class Stream_Pool
+  {
+  public:
+
+    ~Stream_Pool()
+    {
+      stop();
+    }
+
+    void max_threads(unsigned int max_)
+    {
+      std::lock_guard<std::mutex> lock {_mutex};
+      _max = std::max<unsigned int>(1, max_);
+    }
+
+    unsigned int max_threads()
+    {
+      std::lock_guard<std::mutex> lock {_mutex};
+      return _max;
+    }
+
+    // set while stop() waits for the producers, they should give up
+    bool stopping() const
+    {
+      return _stopping;
+    }
+
+    // fn_ must not throw
+    void post(std::function<void()> fn_)
+    {
+      std::lock_guard<std::mutex> lock {_mutex};
+      _tasks.emplace_back(std::move(fn_));
+      if (_tasks.size() > _idle && _threads.size() < _max)
+      {
+        _threads.emplace_back([this]() { run(); });
+        return;
+      }
+      _cv.notify_one();
+    }
+
+    // runs the queued producers (which see stopping()) and joins the
+    // threads, called when the io context has stopped
+    void stop()
+    {
+      std::vector<std::thread> threads;
+      {
+        std::lock_guard<std::mutex> lock {_mutex};
+        _stopping = true;
+        threads.swap(_threads);
+      }
+      _cv.notify_all();
+      for (auto& t : threads)
+      {
+        t.join();
+      }
+      _stopping = false;
+    }
+
+  private:
+
+    void run()
+    {
+      std::unique_lock<std::mutex> lock {_mutex};
+      while (true)
+      {
+        if (_tasks.empty())
+        {
+          if (_stopping)
+          {
+            return;
+          }
+          ++_idle;
+          _cv.wait(lock);
+          --_idle;
+          continue;
+        }
+        auto fn = std::move(_tasks.front());
+        _tasks.pop_front();
+        lock.unlock();
+        fn();
+        lock.lock();
+      }
+    }
+
+    std::mutex _mutex {};
+    std::condition_variable _cv {};
+    std::deque<std::function<void()>> _tasks {};
+    std::vector<std::thread> _threads {};
+    std::size_t _idle {0};
+    unsigned int _max {4};
+    std::atomic<bool> _stopping {false};
+  }; // class Stream_Pool
+
   struct Attr
   {
 #ifdef OB_BELLE_CONFIG_SSL_ON
@@ -1155,6 +1271,9 @@ private:
 
     // websocket channels
     Channels channels {};
+
+    // producers of streamed response bodies
+    Stream_Pool streams {};
   }; // struct Attr
 
   template<typename Derived>
@@ -1425,26 +1544,27 @@ private:
     std::deque<std::shared_ptr<std::string const>> _que {};
   }; // class Websocket_Base
 
-  class Websocket :
-    public Websocket_Base<Websocket>,
-    public std::enable_shared_from_this<Websocket>
+  template<typename Socket>
+  class Basic_Websocket :
+    public Websocket_Base<Basic_Websocket<Socket>>,
+    public std::enable_shared_from_this<Basic_Websocket<Socket>>
   {
   public:
 
-    Websocket(tcp::socket&& socket_, std::shared_ptr<Attr> const attr_,
+    Basic_Websocket(Socket&& socket_, std::shared_ptr<Attr> const attr_,
       Request&& req_, fns_on_websocket const& on_websocket_) :
-      Websocket_Base<Websocket> {
+      Websocket_Base<Basic_Websocket<Socket>> {
         static_cast<net::io_context&>(socket_.get_executor().context()), 
         attr_, std::move(req_), on_websocket_},
       _socket {std::move(socket_)}
     {
     }
 
-    ~Websocket()
+    ~Basic_Websocket()
     {
     }
 
-    websocket::stream<tcp::socket>& socket()
+    websocket::stream<Socket>& socket()
     {
       return _socket;
     }
@@ -1482,8 +1602,10 @@ private:
 
   private:
 
-    websocket::stream<tcp::socket> _socket;
-  }; // class Websocket
+    websocket::stream<Socket> _socket;
+  }; // class Basic_Websocket
+
+  using Websocket = Basic_Websocket<tcp::socket>;
 
 #ifdef OB_BELLE_CONFIG_SSL_ON
   class Websockets :
@@ -1709,6 +1831,12 @@ private:
               // run user function
               user_func(_ctx);
 
+              if (_ctx.stream)
+              {
+                send_stream();
+                return 0;
+              }
+
               _ctx.res.content_length(_ctx.res.body().size());
               send(derived().shared_from_this(), std::move(_ctx.res));
               return 0;
@@ -1740,6 +1868,219 @@ private:
       return 404;
     }
 
+    // write the body of a streamed response
+    void send_stream()
+    {
+      auto stream = std::move(_ctx.stream);
+
+      // chunked transfer encoding requires http/1.1
+      if (_ctx.req.version() < 11)
+      {
+        try
+        {
+          stream([this](char const* data_, std::size_t size_)
+          {
+            _ctx.res.body().append(data_, size_);
+          });
+        }
+        catch (...)
+        {
+          serve_error(500);
+          return;
+        }
+
+        _ctx.res.content_length(_ctx.res.body().size());
+        send(derived().shared_from_this(), std::move(_ctx.res));
+        return;
+      }
+
+      // the body is produced by the stream pool, the chunks are written
+      // asynchronously so that a slow client does not block the others
+      auto state = std::make_shared<Stream_State>();
+      state->res.base() = _ctx.res.base();
+      state->res.keep_alive(_ctx.req.keep_alive());
+      state->res.chunked(true);
+      _stream = state;
+
+      // the pool outlives its producers, it joins them when the server stops
+      auto* const pool = &_attr->streams;
+      pool->post([state, pool, stream = std::move(stream),
+        weak = std::weak_ptr<Derived>(derived().shared_from_this())]()
+      {
+        bool failed {false};
+        try
+        {
+          if (pool->stopping())
+          {
+            throw std::runtime_error("server stopped");
+          }
+          stream([&state, &weak, pool](char const* data_, std::size_t size_)
+          {
+            if (size_ == 0)
+            {
+              return;
+            }
+            std::unique_lock<std::mutex> lock {state->mutex};
+            if (pool->stopping())
+            {
+              state->cancelled = true;
+            }
+            // wait for the session to catch up, stop if it went away or the
+            // server stops
+            while (! state->cancelled && state->chunks.size() >= Stream_State::max_chunks)
+            {
+              if (state->cv.wait_for(lock, std::chrono::milliseconds(100)) == std::cv_status::timeout &&
+                (weak.expired() || pool->stopping()))
+              {
+                state->cancelled = true;
+              }
+            }
+            if (state->cancelled)
+            {
+              throw std::runtime_error("stream cancelled");
+            }
+            state->chunks.emplace_back(data_, size_);
+            stream_wake(state, lock);
+          });
+        }
+        catch (...)
+        {
+          failed = true;
+        }
+        std::unique_lock<std::mutex> lock {state->mutex};
+        state->done = true;
+        state->failed = failed;
+        stream_wake(state, lock);
+      });
+
+      http::async_write_header(derived().socket(), state->sr,
+        net::bind_executor(_strand,
+          [self = derived().shared_from_this()](error_code ec, std::size_t bytes)
+          {
+            boost::ignore_unused(bytes);
+            self->on_stream_write(ec);
+          }
+        )
+      );
+    }
+
+    // streamed response body: the chunks are produced by the stream pool
+    // and written by the session, at most max_chunks are queued
+    struct Stream_State
+    {
+      static constexpr std::size_t max_chunks {4};
+
+      http::response<http::empty_body> res {};
+      http::response_serializer<http::empty_body> sr {res};
+      std::mutex mutex {};
+      std::condition_variable cv {};
+      std::deque<std::string> chunks {};
+      // the chunk that is being written
+      std::string chunk {};
+      bool done {false};
+      bool failed {false};
+      bool cancelled {false};
+      // set while the session waits for a chunk, keeps it alive
+      std::shared_ptr<Derived> waiting {nullptr};
+    };
+
+    // called by the producer with the lock held, resumes a waiting session
+    static void stream_wake(std::shared_ptr<Stream_State> const& state_,
+      std::unique_lock<std::mutex>& lock_)
+    {
+      auto self = std::move(state_->waiting);
+      lock_.unlock();
+      if (self)
+      {
+        net::post(self->_strand, [self]()
+        {
+          self->do_stream_write();
+        });
+      }
+    }
+
+    void do_stream_write()
+    {
+      auto state = _stream;
+      std::unique_lock<std::mutex> lock {state->mutex};
+
+      if (state->chunks.empty())
+      {
+        if (! state->done)
+        {
+          state->waiting = derived().shared_from_this();
+          return;
+        }
+        lock.unlock();
+
+        if (state->failed)
+        {
+          // the response is incomplete
+          _stream = nullptr;
+          derived().do_shutdown();
+          return;
+        }
+
+        net::async_write(derived().socket(), http::make_chunk_last(),
+          net::bind_executor(_strand,
+            [self = derived().shared_from_this()](error_code ec, std::size_t bytes)
+            {
+              boost::ignore_unused(bytes);
+              self->on_stream_end(ec);
+            }
+          )
+        );
+        return;
+      }
+
+      state->chunk = std::move(state->chunks.front());
+      state->chunks.pop_front();
+      lock.unlock();
+      state->cv.notify_one();
+
+      net::async_write(derived().socket(), http::make_chunk(net::buffer(state->chunk)),
+        net::bind_executor(_strand,
+          [self = derived().shared_from_this()](error_code ec, std::size_t bytes)
+          {
+            boost::ignore_unused(bytes);
+            self->on_stream_write(ec);
+          }
+        )
+      );
+    }
+
+    void on_stream_write(error_code ec_)
+    {
+      if (ec_)
+      {
+        {
+          std::lock_guard<std::mutex> lock {_stream->mutex};
+          _stream->cancelled = true;
+        }
+        _stream->cv.notify_one();
+        _stream = nullptr;
+        derived().do_shutdown();
+        return;
+      }
+
+      do_stream_write();
+    }
+
+    void on_stream_end(error_code ec_)
+    {
+      bool const keep_alive {_stream->res.keep_alive()};
+      _stream = nullptr;
+
+      if (ec_ || ! keep_alive)
+      {
+        derived().do_shutdown();
+        return;
+      }
+
+      // read another request
+      this->do_read();
+    }
+
     void serve_error(int err)
     {
       _ctx.res.result(static_cast<unsigned int>(err));
@@ -1914,6 +2255,7 @@ private:
       _res = nullptr;
       _ctx = {};
       _ctx.res.base() = http::response_header<>(_attr->http_headers);
+      _ctx.local = Derived::local;
 
       http::async_read(derived().socket(), _buf, _ctx.req,
         net::bind_executor(_strand,
@@ -2029,32 +2371,36 @@ private:
     std::shared_ptr<Attr> const _attr;
     Http_Ctx _ctx {};
     std::shared_ptr<void> _res {nullptr};
+    std::shared_ptr<Stream_State> _stream {nullptr};
     bool _close {false};
   }; // class Http_Base
 
-  class Http :
-    public Http_Base<Http, Websocket>,
-    public std::enable_shared_from_this<Http>
+  template<typename Socket, bool Local>
+  class Basic_Http :
+    public Http_Base<Basic_Http<Socket, Local>, Basic_Websocket<Socket>>,
+    public std::enable_shared_from_this<Basic_Http<Socket, Local>>
   {
   public:
 
-    Http(tcp::socket socket_, std::shared_ptr<Attr> const attr_) :
-      Http_Base<Http, Websocket> {
+    static constexpr bool local = Local;
+
+    Basic_Http(Socket socket_, std::shared_ptr<Attr> const attr_) :
+      Http_Base<Basic_Http<Socket, Local>, Basic_Websocket<Socket>> {
         static_cast<net::io_context&>(socket_.get_executor().context()), attr_},
       _socket {std::move(socket_)}
     {
     }
 
-    ~Http()
+    ~Basic_Http()
     {
     }
 
-    tcp::socket& socket()
+    Socket& socket()
     {
       return _socket;
     }
 
-    tcp::socket&& socket_move()
+    Socket&& socket_move()
     {
       return std::move(_socket);
     }
@@ -2075,7 +2421,7 @@ private:
       error_code ec;
 
       // send a tcp shutdown
-      _socket.shutdown(tcp::socket::shutdown_send, ec);
+      _socket.shutdown(Socket::shutdown_send, ec);
 
       this->cancel_timer();
 
@@ -2088,8 +2434,14 @@ private:
 
   private:
 
-    tcp::socket _socket;
-  }; // class Http
+    Socket _socket;
+  }; // class Basic_Http
+
+  using Http = Basic_Http<tcp::socket, false>;
+
+#ifdef OB_BELLE_CONFIG_LOCAL_ON
+  using Local_Http = Basic_Http<net::local::stream_protocol::socket, true>;
+#endif // OB_BELLE_CONFIG_LOCAL_ON
 
 #ifdef OB_BELLE_CONFIG_SSL_ON
   class Https :
@@ -2213,13 +2565,13 @@ private:
   }; // class Https
 #endif // OB_BELLE_CONFIG_SSL_ON
 
-  template<typename Session>
-  class Listener : public std::enable_shared_from_this<Listener<Session>>
+  template<typename Session, typename Protocol = tcp>
+  class Listener : public std::enable_shared_from_this<Listener<Session, Protocol>>
   {
   public:
   unsigned short port = 0;
 
-    Listener(net::io_context& io_, tcp::endpoint endpoint_, std::shared_ptr<Attr> const attr_) :
+    Listener(net::io_context& io_, typename Protocol::endpoint endpoint_, std::shared_ptr<Attr> const attr_) :
       _acceptor {io_},
       _socket {io_},
       _attr {attr_}
@@ -2234,23 +2586,38 @@ private:
         return;
       }
 
-      // allow address reuse
-      _acceptor.set_option(net::socket_base::reuse_address(true), ec);
-      if (ec)
+      if constexpr (std::is_same_v<Protocol, tcp>)
       {
-        // TODO log here
-        return;
+        // allow address reuse
+        _acceptor.set_option(net::socket_base::reuse_address(true), ec);
+        if (ec)
+        {
+          // TODO log here
+          return;
+        }
       }
 
       // bind to the server address
       _acceptor.bind(endpoint_, ec);
-      port = _acceptor.local_endpoint().port();
       if (ec)
       {
         // TODO log here
         return;
       }
 
+      if constexpr (std::is_same_v<Protocol, tcp>)
+      {
+        port = _acceptor.local_endpoint().port();
+      }
+#ifdef OB_BELLE_CONFIG_LOCAL_ON
+      else
+      {
+        // the socket file permissions are the access control,
+        // restrict them before accepting connections
+        ::chmod(endpoint_.path().c_str(), S_IRUSR | S_IWUSR);
+      }
+#endif // OB_BELLE_CONFIG_LOCAL_ON
+
       // start listening for connections
       _acceptor.listen(net::socket_base::max_listen_connections, ec);
 
@@ -2302,8 +2669,8 @@ private:
 
   private:
 
-    tcp::acceptor _acceptor;
-    tcp::socket _socket;
+    typename Protocol::acceptor _acceptor;
+    typename Protocol::socket _socket;
     std::shared_ptr<Attr> const _attr;
   }; // class Listener
 
@@ -2364,6 +2731,86 @@ public:
     return _port;
   }
 
+  // enable or disable the tcp listener
+  Server& tcp_listener(bool tcp_listener_)
+  {
+    _tcp_listener = tcp_listener_;
+
+    return *this;
+  }
+
+  // get whether the tcp listener is enabled
+  bool tcp_listener()
+  {
+    return _tcp_listener;
+  }
+
+#ifdef OB_BELLE_CONFIG_LOCAL_ON
+  // set the unix domain socket path, empty to disable
+  Server& local_path(std::string local_path_)
+  {
+    _local_path = local_path_;
+
+    return *this;
+  }
+
+  // get the unix domain socket path
+  std::string local_path()
+  {
+    return _local_path;
+  }
+
+  // check if the unix domain socket path can be used,
+  // a socket file without listener is removed
+  bool local_available()
+  {
+    struct stat st;
+    if (::stat(_local_path.c_str(), &st) == 0)
+    {
+      if (! S_ISSOCK(st.st_mode))
+      {
+        return false;
+      }
+
+      error_code ec;
+      net::io_context io;
+      net::local::stream_protocol::socket socket(io);
+      socket.connect(net::local::stream_protocol::endpoint(_local_path), ec);
+
+      if (! ec)
+      {
+        // in use
+        return false;
+      }
+
+      ::unlink(_local_path.c_str());
+    }
+
+    error_code ec;
+    net::io_context io;
+    net::local::stream_protocol::acceptor acceptor(io);
+    auto endpoint = net::local::stream_protocol::endpoint(_local_path);
+
+    acceptor.open(endpoint.protocol(), ec);
+
+    if (ec)
+    {
+      return false;
+    }
+
+    acceptor.bind(endpoint, ec);
+    acceptor.close();
+    ::unlink(_local_path.c_str());
+
+    if (ec)
+    {
+      return false;
+    }
+
+    return true;
+  }
+#endif // OB_BELLE_CONFIG_LOCAL_ON
+
   // set the public directory for serving static files
   Server& public_dir(std::string public_dir_)
   {
@@ -2423,6 +2870,20 @@ public:
     return _threads;
   }
 
+  // set the number of threads producing streamed response bodies
+  Server& stream_threads(unsigned int threads_)
+  {
+    _attr->streams.max_threads(threads_);
+
+    return *this;
+  }
+
+  // get the number of threads producing streamed response bodies
+  unsigned int stream_threads()
+  {
+    return _attr->streams.max_threads();
+  }
+
 #ifdef OB_BELLE_CONFIG_SSL_ON
   // set ssl
   Server& ssl(bool ssl_)
@@ -2801,12 +3262,22 @@ public:
     }
     else
 #endif // OB_BELLE_CONFIG_SSL_ON
+    if (_tcp_listener)
     {
       // use http
       std::make_shared<Listener<Http>>
         (_io, tcp::endpoint(net::ip::make_address(_address), _port), _attr)->run();
     }
 
+#ifdef OB_BELLE_CONFIG_LOCAL_ON
+    if (! _local_path.empty())
+    {
+      // use http over the unix domain socket
+      std::make_shared<Listener<Local_Http, net::local::stream_protocol>>
+        (_io, net::local::stream_protocol::endpoint(_local_path), _attr)->run();
+    }
+#endif // OB_BELLE_CONFIG_LOCAL_ON
+
     // thread pool
     std::vector<std::thread> io_threads;
 
@@ -2835,6 +3306,17 @@ public:
     {
       t.join();
     }
+
+    // stop the producers of streamed responses before the io context
+    // (which they post to) can go away
+    _attr->streams.stop();
+
+#ifdef OB_BELLE_CONFIG_LOCAL_ON
+    if (! _local_path.empty())
+    {
+      ::unlink(_local_path.c_str());
+    }
+#endif // OB_BELLE_CONFIG_LOCAL_ON
   }
 
 private:
@@ -2848,6 +3330,14 @@ private:
   // the port to listen on
   unsigned short _port {8080};
 
+  // listen on tcp
+  bool _tcp_listener {true};
+
+#ifdef OB_BELLE_CONFIG_LOCAL_ON
+  // the unix domain socket path to listen on
+  std::string _local_path {};
+#endif // OB_BELLE_CONFIG_LOCAL_ON
+
   // the number of threads to run on
   unsigned int _threads {1};
 
@@ -0,0 +1,82 @@
+#ifndef HTTPGD_TEST_ALLOC_COUNTER_H
+#define HTTPGD_TEST_ALLOC_COUNTER_H
+
+// Replaces the global allocation functions to count heap allocations.
+// Include in exactly one translation unit of a test binary.
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace httpgd::test
+{
+    inline std::atomic<std::size_t> g_allocations{0};
+    inline std::atomic<std::size_t> g_allocated_bytes{0};
+
+    // Counts allocations made during the lifetime of the object.
+    class AllocCounter
+    {
+    public:
+        AllocCounter()
+            : m_allocations(g_allocations.load()), m_bytes(g_allocated_bytes.load())
+        {
+        }
+        [[nodiscard]] std::size_t allocations() const
+        {
+            return g_allocations.load() - m_allocations;
+        }
+        [[nodiscard]] std::size_t bytes() const
+        {
+            return g_allocated_bytes.load() - m_bytes;
+        }
+
+    private:
+        std::size_t m_allocations;
+        std::size_t m_bytes;
+    };
+} // namespace httpgd::test
+
+// The replacements pair malloc with free, which GCC reports once they are
+// inlined into callers that use new and delete.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void *operator new(std::size_t t_size)
+{
+    httpgd::test::g_allocations++;
+    httpgd::test::g_allocated_bytes += t_size;
+    if (void *p = std::malloc(t_size == 0 ? 1 : t_size))
+    {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+void *operator new[](std::size_t t_size)
+{
+    return operator new(t_size);
+}
+void operator delete(void *t_ptr) noexcept
+{
+    std::free(t_ptr);
+}
+void operator delete[](void *t_ptr) noexcept
+{
+    std::free(t_ptr);
+}
+void operator delete(void *t_ptr, std::size_t) noexcept
+{
+    std::free(t_ptr);
+}
+void operator delete[](void *t_ptr, std::size_t) noexcept
+{
+    std::free(t_ptr);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif // HTTPGD_TEST_ALLOC_COUNTER_H
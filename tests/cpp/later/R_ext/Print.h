@@ -0,0 +1,26 @@
+// Stand-in for R's console output: REprintf counts the messages and writes
+// them to stderr.
+
+#ifndef HTTPGD_TEST_R_EXT_PRINT_H
+#define HTTPGD_TEST_R_EXT_PRINT_H
+
+#include <atomic>
+#include <cstdarg>
+#include <cstdio>
+
+inline std::atomic<int> &reprintf_calls()
+{
+    static std::atomic<int> n{0};
+    return n;
+}
+
+inline void REprintf(const char *format, ...)
+{
+    reprintf_calls()++;
+    va_list args;
+    va_start(args, format);
+    std::vfprintf(stderr, format, args);
+    va_end(args);
+}
+
+#endif // HTTPGD_TEST_R_EXT_PRINT_H
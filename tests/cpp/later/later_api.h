@@ -0,0 +1,54 @@
+// Stand-in for the later package: callbacks are queued and run by the
+// thread that calls later::run_now(), which plays the R main thread.
+
+#ifndef HTTPGD_TEST_LATER_API_H
+#define HTTPGD_TEST_LATER_API_H
+
+#include <deque>
+#include <mutex>
+
+namespace later
+{
+    struct Callback
+    {
+        void (*func)(void *);
+        void *data;
+    };
+
+    inline std::mutex &queue_mutex()
+    {
+        static std::mutex m;
+        return m;
+    }
+
+    inline std::deque<Callback> &queue()
+    {
+        static std::deque<Callback> q;
+        return q;
+    }
+
+    inline void later(void (*func)(void *), void *data, double /*secs*/)
+    {
+        const std::lock_guard<std::mutex> lock(queue_mutex());
+        queue().push_back({func, data});
+    }
+
+    // Runs one callback, returns false if there was none.
+    inline bool run_now()
+    {
+        Callback cb;
+        {
+            const std::lock_guard<std::mutex> lock(queue_mutex());
+            if (queue().empty())
+            {
+                return false;
+            }
+            cb = queue().front();
+            queue().pop_front();
+        }
+        cb.func(cb.data);
+        return true;
+    }
+} // namespace later
+
+#endif // HTTPGD_TEST_LATER_API_H
@@ -0,0 +1,235 @@
+// Cross thread call queue: many producers, calls run in order on the
+// consumer ("R") thread, futures report completion and exceptions.
+// Functions passed to after_calls run once the calls run together are done
+// and no further call arrived within their linger time, errors in them are
+// reported.
+// Requests waiting on R return when the device is closed.
+
+#include <later_api.h>
+#include <R_ext/Print.h>
+
+#include "AsyncLater.h"
+#include "HttpgdApiAsync.h"
+
+#include <atomic>
+#include <cstdio>
+#include <future>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace httpgd;
+
+namespace
+{
+    int g_failures = 0;
+
+    void expect(const char *t_name, bool t_ok)
+    {
+        std::printf("%s %s\n", t_ok ? "ok  " : "FAIL", t_name);
+        if (!t_ok)
+        {
+            g_failures++;
+        }
+    }
+
+    // counts the calls that reach the R device
+    class FakeDevice : public HttpgdApi
+    {
+    public:
+        std::atomic<int> renders{0};
+
+        void api_render(int, double, double) override { renders++; }
+        void api_render_batch(const std::vector<int32_t> &, double, double) override { renders++; }
+        bool api_remove(int) override { return true; }
+        bool api_clear() override { return true; }
+        std::string api_svg(int, double, double) override { return ""; }
+        std::vector<std::string> api_svg_batch(const std::vector<int32_t> &, double, double) override { return {}; }
+        boost::optional<int> api_index(int32_t) override { return boost::none; }
+        HttpgdState api_state() override { return {}; }
+        HttpgdQueryResults api_query_all() override { return {}; }
+        HttpgdQueryResults api_query_index(int) override { return {}; }
+        HttpgdQueryResults api_query_range(int, int) override { return {}; }
+        HttpgdQueryResults api_query_after(int32_t, int) override { return {}; }
+        HttpgdChanges api_query_changes(int) override { return {}; }
+        std::shared_ptr<HttpgdServerConfig> api_server_config() override { return nullptr; }
+    };
+
+    constexpr int PRODUCERS = 8;
+    constexpr int CALLS = 10000;
+
+} // namespace
+
+int main()
+{
+    // no R thread yet, this thread plays it
+    bool direct = false;
+    asynclater::after_calls([&]() { direct = true; }, 1.0);
+    expect("after_calls runs right away outside of calls", direct);
+
+    std::atomic<bool> stop{false};
+    std::atomic<bool> hold{false};
+    std::atomic<bool> held{false};
+    std::thread r_thread([&]() {
+        while (!stop)
+        {
+            held = hold.load();
+            if (held || !later::run_now())
+            {
+                std::this_thread::yield();
+            }
+        }
+        while (later::run_now())
+        {
+        }
+    });
+
+    // only modified in the R thread
+    long calls = 0;
+    std::vector<int> last_seen(PRODUCERS, -1);
+    bool in_order = true;
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < PRODUCERS; ++p)
+    {
+        producers.emplace_back([&, p]() {
+            for (int i = 0; i < CALLS; ++i)
+            {
+                auto done = asynclater::later([&, p, i]() {
+                    calls++;
+                    in_order = in_order && (last_seen[p] == i - 1);
+                    last_seen[p] = i;
+                });
+                if (i % 100 == 0)
+                {
+                    done.wait();
+                }
+            }
+        });
+    }
+    for (auto &t : producers)
+    {
+        t.join();
+    }
+    asynclater::later([]() {}).wait();
+
+    expect("all calls ran", calls == static_cast<long>(PRODUCERS) * CALLS);
+    expect("calls of one producer run in order", in_order);
+
+    auto failing = asynclater::later([]() { throw std::runtime_error("error"); });
+    bool rethrown = false;
+    try
+    {
+        failing.get();
+    }
+    catch (const std::runtime_error &)
+    {
+        rethrown = true;
+    }
+    expect("exception is passed to the future", rethrown);
+    expect("queue works after an exception", asynclater::later([]() {}).wait_for(std::chrono::seconds(5)) == std::future_status::ready);
+
+    // only modified in the R thread, like a device that restores its
+    // open page after rendering old pages
+    std::vector<std::string> log;
+    bool restore_pending = false;
+    std::atomic<int> restores{0};
+    const auto wait_restores = [&](int t_n) {
+        while (restores < t_n)
+        {
+            std::this_thread::yield();
+        }
+    };
+    const auto render = [&](const std::string &t_name, double t_linger) {
+        return asynclater::later([&, t_name, t_linger]() {
+            log.push_back(t_name);
+            if (!restore_pending)
+            {
+                restore_pending = true;
+                asynclater::after_calls([&]() {
+                    restore_pending = false;
+                    log.push_back("restore");
+                    restores++;
+                }, t_linger);
+            }
+        });
+    };
+
+    // calls that are queued together share one after_calls function
+    hold = true;
+    while (!held)
+    {
+        std::this_thread::yield();
+    }
+    auto a = render("a", 0);
+    auto b = render("b", 0);
+    auto c = render("c", 0);
+    hold = false;
+    wait_restores(1);
+    expect("after_calls runs once after calls run together", log == std::vector<std::string>{"a", "b", "c", "restore"});
+
+    // one call at a time (sequential navigation)
+    log.clear();
+    render("a", 0).wait();
+    wait_restores(2);
+    render("b", 0).wait();
+    wait_restores(3);
+    expect("after_calls runs after each call run alone", log == std::vector<std::string>{"a", "restore", "b", "restore"});
+
+    // calls that arrive one at a time within the linger time (a client
+    // stepping through plots) share one after_calls function, the calls
+    // themselves do not wait for it
+    log.clear();
+    const auto start = std::chrono::steady_clock::now();
+    render("a", 2.0).wait();
+    const bool prompt = std::chrono::steady_clock::now() - start < std::chrono::seconds(1);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    render("b", 2.0).wait();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    render("c", 2.0).wait();
+    wait_restores(4);
+    expect("after_calls waits for calls within the linger time", log == std::vector<std::string>{"a", "b", "c", "restore"});
+    expect("calls do not wait for the linger time", prompt);
+
+    std::atomic<bool> after_error{false};
+    asynclater::later([&]() {
+        asynclater::after_calls([]() { throw std::runtime_error("error"); }, 0);
+        asynclater::after_calls([&]() { after_error = true; }, 0);
+    }).wait();
+    while (!after_error)
+    {
+        std::this_thread::yield();
+    }
+    expect("error in after_calls is reported", reprintf_calls() == 1);
+    expect("queue works after an error in after_calls", asynclater::later([]() {}).wait_for(std::chrono::seconds(5)) == std::future_status::ready);
+
+    // closing the device joins the server thread from the R thread, so a
+    // request waiting on R must not wait for the queued call
+    FakeDevice device;
+    auto api = std::make_shared<HttpgdApiAsync>(&device, nullptr, std::make_shared<HttpgdDataStore>());
+    hold = true;
+    while (!held)
+    {
+        std::this_thread::yield();
+    }
+    auto request = std::async(std::launch::async, [&]() { api->api_render(0, 100, 100); });
+    while (true)
+    {
+        const std::lock_guard<std::mutex> lock(later::queue_mutex());
+        if (!later::queue().empty())
+        {
+            break;
+        }
+    }
+    api->rdevice_destructing();
+    expect("request waiting on R returns when the device closes", request.wait_for(std::chrono::seconds(5)) == std::future_status::ready);
+    hold = false;
+    asynclater::later([]() {}).wait();
+    expect("queued call skips the closed device", device.renders == 0);
+
+    stop = true;
+    r_thread.join();
+
+    return g_failures == 0 ? 0 : 1;
+}
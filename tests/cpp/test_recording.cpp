@@ -0,0 +1,820 @@
+// Allocation budget of the draw call recording path.
+// A regression here means a hidden copy was introduced.
+
+#include "alloc_counter.h"
+
+#include "DrawData.h"
+#include "HttpgdDataStore.h"
+#include "HttpgdTrace.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+#include <zlib.h>
+
+using namespace httpgd;
+using test::AllocCounter;
+
+namespace
+{
+    int g_failures = 0;
+
+    void expect_allocations(const char *t_name, const AllocCounter &t_counter, std::size_t t_expected)
+    {
+        const auto actual = t_counter.allocations();
+        if (actual != t_expected)
+        {
+            std::printf("FAIL %s: %zu allocations (expected %zu)\n", t_name, actual, t_expected);
+            g_failures++;
+        }
+        else
+        {
+            std::printf("ok   %s: %zu allocations\n", t_name, actual);
+        }
+    }
+
+    std::size_t count_matches(const std::string &t_str, const char *t_sub)
+    {
+        std::size_t res = 0;
+        for (auto pos = t_str.find(t_sub); pos != std::string::npos; pos = t_str.find(t_sub, pos + 1))
+        {
+            res++;
+        }
+        return res;
+    }
+
+    dc::LineInfo line_info()
+    {
+        return {color::rgb(0, 0, 0), 1.0, 0, dc::LineInfo::GC_ROUND_CAP, dc::LineInfo::GC_ROUND_JOIN, 10.0};
+    }
+
+    std::vector<vertex<double>> points(std::size_t n)
+    {
+        return std::vector<vertex<double>>(n, {1.0, 2.0});
+    }
+
+    // Draw call objects: one allocation for std::make_shared, data is moved in.
+
+    void test_draw_calls()
+    {
+        {
+            auto p = points(1000);
+            AllocCounter c;
+            auto dc = std::make_shared<dc::Polyline>(line_info(), std::move(p));
+            expect_allocations("Polyline", c, 1);
+        }
+        {
+            auto p = points(1000);
+            AllocCounter c;
+            auto dc = std::make_shared<dc::Polygon>(line_info(), color::rgb(255, 0, 0), std::move(p));
+            expect_allocations("Polygon", c, 1);
+        }
+        {
+            auto p = points(1000);
+            std::vector<int> nper{500, 500};
+            AllocCounter c;
+            auto dc = std::make_shared<dc::Path>(line_info(), color::rgb(255, 0, 0), std::move(p), std::move(nper), true);
+            expect_allocations("Path", c, 1);
+        }
+        {
+            std::vector<unsigned int> raster(100 * 100, 0xFF0000FF);
+            AllocCounter c;
+            auto dc = std::make_shared<dc::Raster>(std::move(raster), vertex<int>{100, 100}, rect<double>{0, 0, 100, 100}, 0, false);
+            expect_allocations("Raster", c, 1);
+        }
+        {
+            // strings longer than the small string buffer
+            std::string str(100, 'x');
+            dc::TextInfo info{400, std::string(100, 'f'), std::string(100, 'n'), 12.0, false, -1.0};
+            AllocCounter c;
+            auto dc = std::make_shared<dc::Text>(color::rgb(0, 0, 0), vertex<double>{0, 0}, std::move(str), 0, 0, std::move(info));
+            expect_allocations("Text", c, 1);
+        }
+        {
+            AllocCounter c;
+            auto dc = std::make_shared<dc::Circle>(line_info(), color::rgb(255, 0, 0), vertex<double>{0, 0}, 1.0);
+            expect_allocations("Circle", c, 1);
+        }
+    }
+
+    // Storing a draw call does not copy it (or touch its reference count
+    // more than necessary). Growing the page's draw call vector is the only
+    // allowed allocation, so the page is warmed up first.
+
+    void test_store()
+    {
+        HttpgdDataStore store;
+        store.append({720, 576});
+        for (int i = 0; i < 100; ++i)
+        {
+            store.add_dc(0, std::make_shared<dc::Polyline>(line_info(), points(10)), true);
+        }
+        {
+            auto dc = std::make_shared<dc::Polyline>(line_info(), points(1000));
+            AllocCounter c;
+            store.add_dc(0, std::move(dc), true);
+            expect_allocations("HttpgdDataStore::add_dc", c, 0);
+        }
+        {
+            AllocCounter c;
+            store.remove_all();
+            expect_allocations("HttpgdDataStore::remove_all", c, 0);
+        }
+    }
+
+    void expect_ids(const char *t_name, const std::vector<int32_t> &t_actual, const std::vector<int32_t> &t_expected)
+    {
+        if (t_actual != t_expected)
+        {
+            std::printf("FAIL %s: %zu ids (expected %zu)\n", t_name, t_actual.size(), t_expected.size());
+            g_failures++;
+        }
+        else
+        {
+            std::printf("ok   %s\n", t_name);
+        }
+    }
+
+    // The changes feed lists plots by their latest change and resets when
+    // the bounded log does not reach back far enough.
+
+    void test_changes()
+    {
+        HttpgdDataStore store;
+        for (int i = 0; i < 3; ++i)
+        {
+            store.append({720, 576});
+            store.add_dc(i, std::make_shared<dc::Polyline>(line_info(), points(10)), false);
+        }
+        const int since = store.state().upid;
+        store.add_dc(1, std::make_shared<dc::Polyline>(line_info(), points(10)), false);
+        store.append({720, 576});
+        store.add_dc(3, std::make_shared<dc::Polyline>(line_info(), points(10)), false);
+        store.append({720, 576});
+        store.remove(4, false);
+        store.remove(0, false);
+
+        auto changes = store.query_changes(since);
+        expect_ids("query_changes added", changes.added, {3});
+        expect_ids("query_changes removed", changes.removed, {0});
+        expect_ids("query_changes changed", changes.changed, {1});
+        expect_ids("query_changes current", store.query_changes(store.state().upid).added, {});
+        if (changes.reset || !store.query_changes(since + 100).reset)
+        {
+            std::printf("FAIL query_changes reset\n");
+            g_failures++;
+        }
+
+        for (int i = 0; i < 2000; ++i)
+        {
+            store.append({720, 576});
+            store.add_dc(-1, std::make_shared<dc::Polyline>(line_info(), points(10)), false);
+        }
+        changes = store.query_changes(since);
+        if (!changes.reset || changes.ids.size() != store.state().hsize)
+        {
+            std::printf("FAIL query_changes reset after log overflow\n");
+            g_failures++;
+        }
+
+        const auto index = store.find_index(1500);
+        const auto missing = store.find_index(4);
+        if (!index || *index != 1498 || missing || store.query_index(*index).ids != std::vector<int32_t>{1500})
+        {
+            std::printf("FAIL find_index\n");
+            g_failures++;
+        }
+        else
+        {
+            std::printf("ok   find_index\n");
+        }
+
+        auto page = store.query_after(-1, 2);
+        expect_ids("query_after first", page.ids, {1, 2});
+        store.remove(1, false); // the cursor plot, id 2
+        page = store.query_after(2, 1);
+        expect_ids("query_after removed cursor", page.ids, {3});
+        if (!page.more || store.query_after(2, -1).more)
+        {
+            std::printf("FAIL query_after more\n");
+            g_failures++;
+        }
+
+        // removal leaves the later pages in their slots
+        const auto before = store.find_index(1);
+        store.remove(*store.find_index(1000), false);
+        store.remove(*store.find_index(10), false);
+        const auto after = store.find_index(1500);
+        const auto last = store.find_index(2004);
+        if (!before || *before != 0 || !after || store.query_index(*after).ids != std::vector<int32_t>{1500} ||
+            !last || *last != static_cast<int>(store.state().hsize) - 1 || store.find_index(1000) ||
+            store.query_index(*store.find_index(11)).ids != std::vector<int32_t>{11})
+        {
+            std::printf("FAIL find_index after remove\n");
+            g_failures++;
+        }
+        else
+        {
+            std::printf("ok   find_index after remove\n");
+        }
+    }
+
+    // Removal leaves an empty slot behind, indices and IDs are mapped
+    // through the slots until they are compacted. Checked against a plain
+    // list of IDs.
+
+    void test_remove()
+    {
+        HttpgdDataStore store;
+        std::vector<int32_t> ids;
+        int32_t next_id = 0;
+        unsigned seed = 1;
+        const auto random = [&](std::size_t t_n) {
+            seed = seed * 1103515245 + 12345;
+            return static_cast<std::size_t>((seed >> 8) % t_n);
+        };
+        bool ok = true;
+        for (int step = 0; step < 20000 && ok; ++step)
+        {
+            if (ids.empty() || random(3) == 0)
+            {
+                store.append({720, 576});
+                ids.push_back(next_id++);
+            }
+            else
+            {
+                // the last page is removed by dev.off() and hgd_remove() defaults
+                const std::size_t index = random(4) == 0 ? ids.size() - 1 : random(ids.size());
+                store.remove(static_cast<int>(index), false);
+                ids.erase(ids.begin() + index);
+            }
+            if (step % 97 != 0 || ids.empty())
+            {
+                continue;
+            }
+            const std::size_t index = random(ids.size());
+            const int32_t after = ids[index] - static_cast<int32_t>(random(2));
+            std::vector<int32_t> expected_after(std::upper_bound(ids.begin(), ids.end(), after), ids.end());
+            expected_after.resize(std::min<std::size_t>(expected_after.size(), 5));
+            const auto found = store.find_index(ids[index]);
+            ok = store.query_all().ids == ids && store.state().hsize == ids.size() &&
+                 found && *found == static_cast<int>(index) &&
+                 store.query_index(static_cast<int>(index)).ids == std::vector<int32_t>{ids[index]} &&
+                 store.query_index(-1).ids == std::vector<int32_t>{ids.back()} &&
+                 store.query_range(static_cast<int>(index), 3).ids ==
+                     std::vector<int32_t>(ids.begin() + index, ids.begin() + std::min(ids.size(), index + 3)) &&
+                 store.query_after(after, 5).ids == expected_after &&
+                 (index == 0 || !store.find_index(ids[index] - 1) || ids[index - 1] == ids[index] - 1);
+        }
+        if (!ok)
+        {
+            std::printf("FAIL HttpgdDataStore::remove: %zu pages\n", ids.size());
+            g_failures++;
+            return;
+        }
+
+        // removing from the front with lookups in between
+        HttpgdDataStore front;
+        for (int i = 0; i < 100000; ++i)
+        {
+            front.append({720, 576});
+        }
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < 50000; ++i)
+        {
+            front.remove(0, false);
+            ok = ok && front.find_index(99999) == 99999 - i - 1;
+        }
+        const auto ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        if (!ok || front.query_all().ids.front() != 50000)
+        {
+            std::printf("FAIL HttpgdDataStore::remove from the front\n");
+            g_failures++;
+        }
+        else
+        {
+            std::printf("ok   HttpgdDataStore::remove: %.1f ms for 50k removals from the front (100k pages)\n", ms);
+        }
+    }
+
+    // Serializing a small page allocates the output buffer and the result
+    // string only.
+
+    void test_serialize()
+    {
+        dc::Page page(0, {720, 576});
+        page.put(std::make_shared<dc::Polyline>(line_info(), points(10)));
+        const boost::optional<std::string> css(std::string(100, 'c'));
+        {
+            AllocCounter c;
+            page.svg(css);
+            expect_allocations("Page::svg", c, 2);
+        }
+    }
+
+    // Streaming a page in chunks produces the same document with a single
+    // buffer allocation, independent of the page size.
+
+    void test_stream()
+    {
+        HttpgdDataStore store;
+        store.append({720, 576});
+        for (int i = 0; i < 10000; ++i)
+        {
+            store.add_dc(0, std::make_shared<dc::Polyline>(line_info(), points(10)), true);
+        }
+        const auto page = store.snapshot(0, {-1, -1});
+        const std::string expected = page.svg();
+
+        std::string streamed;
+        streamed.reserve(expected.size());
+        std::size_t chunks = 0;
+        {
+            AllocCounter c;
+            page.svg(64 * 1024, [&](fmt::memory_buffer &buf) {
+                chunks++;
+                streamed.append(buf.data(), buf.size());
+            });
+            expect_allocations("PageSnapshot::svg (streamed)", c, 1);
+        }
+        if (streamed != expected || chunks < 2)
+        {
+            std::printf("FAIL PageSnapshot::svg (streamed): %zu chunks, output %s\n", chunks, streamed == expected ? "equal" : "differs");
+            g_failures++;
+        }
+        else
+        {
+            std::printf("ok   PageSnapshot::svg (streamed): %zu chunks\n", chunks);
+        }
+    }
+
+    std::string read_file(const std::string &t_path)
+    {
+        std::string res;
+        gzFile f = gzopen(t_path.c_str(), "rb"); // reads plain files as is
+        if (!f)
+        {
+            return res;
+        }
+        char buf[4096];
+        int n;
+        while ((n = gzread(f, buf, sizeof(buf))) > 0)
+        {
+            res.append(buf, n);
+        }
+        gzclose(f);
+        return res;
+    }
+
+    // Batches are serialized in parallel from copies of the pages, plots
+    // that were removed are empty.
+
+    void test_svg_batch()
+    {
+        HttpgdDataStore store;
+        for (int i = 0; i < 20; ++i)
+        {
+            store.append({720, 576});
+            for (int j = 0; j <= i; ++j)
+            {
+                store.add_dc(i, std::make_shared<dc::Polyline>(line_info(), points(10)), true);
+            }
+        }
+        store.remove(*store.find_index(5), true);
+
+        std::vector<int32_t> ids;
+        for (int32_t id = 19; id >= 0; --id)
+        {
+            ids.push_back(id);
+        }
+        const auto svgs = store.svg_batch(ids);
+        bool ok = svgs.size() == ids.size();
+        for (std::size_t i = 0; ok && i < ids.size(); ++i)
+        {
+            const auto index = store.find_index(ids[i]);
+            ok = svgs[i] == store.svg(index ? *index : 100);
+        }
+        if (!ok || svgs[14] != store.svg(100) || !store.svg_batch({}).empty())
+        {
+            std::printf("FAIL HttpgdDataStore::svg_batch\n");
+            g_failures++;
+        }
+        else
+        {
+            std::printf("ok   HttpgdDataStore::svg_batch\n");
+        }
+
+        std::vector<std::string> paths;
+        for (int32_t id : ids)
+        {
+            paths.push_back("test_svg_batch_" + std::to_string(id) + ".svg");
+        }
+        bool files_ok = store.svg_batch_files(ids, paths);
+        for (std::size_t i = 0; i < ids.size(); ++i)
+        {
+            files_ok = files_ok && read_file(paths[i]) == svgs[i];
+            std::remove(paths[i].c_str());
+        }
+        if (!files_ok || store.svg_batch_files({0}, {"missing/a.svg"}))
+        {
+            std::printf("FAIL HttpgdDataStore::svg_batch_files\n");
+            g_failures++;
+        }
+        else
+        {
+            std::printf("ok   HttpgdDataStore::svg_batch_files\n");
+        }
+    }
+
+    void test_file()
+    {
+        HttpgdDataStore store;
+        store.append({720, 576});
+        for (int i = 0; i < 10000; ++i)
+        {
+            store.add_dc(0, std::make_shared<dc::Polyline>(line_info(), points(10)), true);
+        }
+        const auto page = store.snapshot(0, {-1, -1});
+        const std::string expected = page.svg();
+
+        const std::string path = "test_recording.svg";
+        const std::string pathz = "test_recording.svgz";
+        const bool ok = page.svg_file(path, false) && page.svg_file(pathz, true) && !page.svg_file("missing/a.svg", false);
+        const bool equal = read_file(path) == expected && read_file(pathz) == expected;
+        std::remove(path.c_str());
+        std::remove(pathz.c_str());
+        if (!ok || !equal)
+        {
+            std::printf("FAIL PageSnapshot::svg_file: %s\n", ok ? "output differs" : "unexpected result");
+            g_failures++;
+        }
+        else
+        {
+            std::printf("ok   PageSnapshot::svg_file\n");
+        }
+    }
+
+    uint32_t read_u32(const std::string &t_buf, std::size_t t_offset)
+    {
+        const auto *b = reinterpret_cast<const unsigned char *>(t_buf.data() + t_offset);
+        return b[0] | (b[1] << 8) | (b[2] << 16) | (static_cast<uint32_t>(b[3]) << 24);
+    }
+
+    // The binary format shares one style record between draw calls with the
+    // same line style and is much smaller than the SVG.
+
+    void test_binary()
+    {
+        dc::Page page(0, {720, 576});
+        for (int i = 0; i < 1000; ++i)
+        {
+            page.put(std::make_shared<dc::Circle>(line_info(), color::rgb(255, 0, 0), vertex<double>{0.7 * i, 2.0}, 3.0));
+        }
+        page.put(std::make_shared<dc::Polyline>(line_info(), points(10)));
+        page.clip({10, 10, 100, 100});
+        dc::TextInfo info{400, "", "sans", 12.0, false, -1.0};
+        page.put(std::make_shared<dc::Text>(color::rgb(0, 0, 0), vertex<double>{20, 20}, "abc", 0, 0, std::move(info)));
+
+        const std::string bin = page.bin({720, 576});
+        const std::string svg = page.svg(boost::none);
+        const bool header = bin.compare(0, 4, "HGDB") == 0 && read_u32(bin, 4) == 1;
+        const uint32_t clips = read_u32(bin, 28), styles = read_u32(bin, 32), calls = read_u32(bin, 36);
+        const uint32_t coords = read_u32(bin, 40), ints = read_u32(bin, 44), strings = read_u32(bin, 48);
+        const std::size_t size = 52 + clips * 16 + styles * 20 + calls * 24 + (coords + ints) * 4 + strings;
+        if (!header || clips != 2 || styles != 1 || calls != 1002 || coords != 3000 + 20 + 6 ||
+            ints != 7 || strings != 7 || bin.size() != size)
+        {
+            std::printf("FAIL Page::bin: %u clips, %u styles, %u calls, %u coords, %u ints, %u string bytes\n",
+                        clips, styles, calls, coords, ints, strings);
+            g_failures++;
+        }
+        else
+        {
+            std::printf("ok   Page::bin: %zu bytes (SVG: %zu bytes)\n", bin.size(), svg.size());
+        }
+    }
+
+    // Viewport queries find the same draw calls as testing every bounding
+    // box, and the SVG of a viewport only contains those.
+
+    void test_viewport()
+    {
+        dc::Page page(0, {1000, 1000});
+        for (int i = 0; i < 10000; ++i)
+        {
+            page.put(std::make_shared<dc::Circle>(line_info(), color::rgb(255, 0, 0), vertex<double>{(i % 100) * 10.0, (i / 100) * 10.0}, 2.0));
+        }
+        // spans the page, tested on every query
+        page.put(std::make_shared<dc::Line>(line_info(), vertex<double>{0, 0}, vertex<double>{1000, 1000}));
+
+        int failed = 0;
+        const rect<double> regions[] = {{0, 0, 1000, 1000}, {95, 95, 30, 30}, {500, 0, 1, 1}, {-50, -50, 40, 40}, {2000, 2000, 10, 10}};
+        for (const auto &r : regions)
+        {
+            std::vector<std::size_t> expected;
+            const double x = r.x, y = r.y, x1 = r.x + r.width, y1 = r.y + r.height;
+            for (int k = 0; k < 10000; ++k)
+            {
+                const auto b = std::make_shared<dc::Circle>(line_info(), 0, vertex<double>{(k % 100) * 10.0, (k / 100) * 10.0}, 2.0)->bbox();
+                if (b.x <= x1 && x <= b.x + b.width && b.y <= y1 && y <= b.y + b.height)
+                {
+                    expected.push_back(k);
+                }
+            }
+            if (x <= 1000 && x1 >= 0 && y <= 1000 && y1 >= 0)
+            {
+                expected.push_back(10000);
+            }
+            if (page.query(r) != expected)
+            {
+                failed++;
+            }
+        }
+
+        // the circles are symbols
+        const std::string svg = page.svg(boost::none, {100, 100}, rect<double>{95, 95, 30, 30});
+        const std::size_t circles = count_matches(svg, "<use ");
+        if (failed || circles != page.query({95, 95, 30, 30}).size() - 1 ||
+            svg.find(R""(viewBox="95.00 95.00 30.00 30.00")"") == std::string::npos)
+        {
+            std::printf("FAIL Page::query: %d regions differ, %zu circles in viewport SVG\n", failed, circles);
+            g_failures++;
+        }
+        else
+        {
+            std::printf("ok   Page::query\n");
+        }
+    }
+
+    // Hit tests return the topmost shapes under the point and skip the
+    // inside of unfilled shapes.
+
+    void test_hit()
+    {
+        HttpgdDataStore store;
+        store.append({1000, 1000});
+        // plot frame
+        store.add_dc(0, std::make_shared<dc::Rect>(line_info(), color::rgba(0, 0, 0, 0), rect<double>{10, 10, 980, 980}), true);
+        for (int i = 0; i < 1000000; ++i)
+        {
+            store.add_dc(0, std::make_shared<dc::Circle>(line_info(), color::rgb(255, 0, 0), vertex<double>{(i % 1000) * 1.0, (i / 1000) * 1.0}, 0.3), true);
+        }
+        store.add_dc(0, std::make_shared<dc::Polyline>(line_info(), std::vector<vertex<double>>{{0, 500.2}, {1000, 500.2}}), true);
+        const auto page = store.snapshot(0, {-1, -1});
+
+        // the first query of the store builds the index outside of the lock
+        // and hands it to the page
+        const bool cold = store.hit(0, {-1, -1}, {0, 0}, 0, 1) && !page.page->indexed();
+        const bool adopted = store.snapshot(0, {-1, -1}).page->indexed();
+
+        const auto top = page.page->hit({300, 500}, 0, 3);
+        const auto frame = page.page->hit({10, 300}, 0, 1000);
+        const auto line = page.page->hit({700, 500}, 1, 1);
+        const std::string json = store.hit(0, {-1, -1}, {300, 300}, 0, 1).get_value_or("");
+        const std::string scaled = store.hit(0, {500, 500}, {150, 150}, 0, 1).get_value_or("");
+
+        // the path of the /hit endpoint, including the store lock
+        const auto start = std::chrono::steady_clock::now();
+        std::size_t hits = 0;
+        for (int i = 0; i < 1000; ++i)
+        {
+            hits += count_matches(store.hit(0, {-1, -1}, {i * 1.0, i * 1.0}, 5, 10).get_value_or(""), "\"index\"");
+        }
+        const auto us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / 1000;
+
+        if (!cold || !adopted || top != std::vector<std::size_t>{1000001, 500301} || frame.back() != 0 ||
+            line != std::vector<std::size_t>{1000001} || hits != 10000 || store.hit(1, {-1, -1}, {0, 0}, 0, 1) ||
+            scaled.find(R""("hits": [{ "index": 300301, "clip": 0, "type": "circle", "x": 300.00,)"") == std::string::npos ||
+            json.find(R""("hits": [{ "index": 300301, "clip": 0, "type": "circle", "x": 300.00, "y": 300.00, "r": 0.30)"") == std::string::npos)
+        {
+            std::printf("FAIL Page::hit: %d cold, %d adopted, %zu top, %zu frame, %zu line, %zu hits: %s\n", cold, adopted, top.size(), frame.size(),
+                        line.size(), hits, json.c_str());
+            g_failures++;
+        }
+        else
+        {
+            std::printf("ok   HttpgdDataStore::hit: %.1f us per query (1M draw calls)\n", us);
+        }
+    }
+
+    // Pages and their snapshots keep their own spatial index, queries that
+    // alternate between them do not rebuild it.
+
+    void test_index_cache()
+    {
+        dc::Page page(0, {1000, 1000});
+        for (int i = 0; i < 10000; ++i)
+        {
+            page.put(std::make_shared<dc::Circle>(line_info(), color::rgb(255, 0, 0), vertex<double>{(i % 100) * 10.0, (i / 100) * 10.0}, 1.0));
+        }
+        const rect<double> region{495, 495, 10, 10};
+        const auto before = page.query(region);
+        const dc::Page copy = page;
+        page.put(std::make_shared<dc::Circle>(line_info(), color::rgb(0, 0, 255), vertex<double>{500, 500}, 1.0));
+        (void)page.query(region);
+
+        std::size_t page_hits = 0, copy_hits = 0;
+        AllocCounter counter;
+        for (int i = 0; i < 10; ++i)
+        {
+            page_hits += page.query(region).size();
+            copy_hits += copy.query(region).size();
+        }
+        // an index of 10000 draw calls takes > 300 kB
+        if (page_hits != 10 * (before.size() + 1) || copy_hits != 10 * before.size() || counter.bytes() > 10000)
+        {
+            std::printf("FAIL Page::query (index cache): %zu, %zu hits, %zu bytes allocated\n", page_hits, copy_hits, counter.bytes());
+            g_failures++;
+        }
+        else
+        {
+            std::printf("ok   Page::query (index cache): %zu bytes allocated\n", counter.bytes());
+        }
+    }
+
+    // Draw calls completely outside of their clipping area are not
+    // recorded, partly visible ones are.
+
+    void test_cull()
+    {
+        dc::Page page(0, {720, 576});
+        page.clip({100, 100, 100, 100});
+        page.put(std::make_shared<dc::Circle>(line_info(), color::rgb(255, 0, 0), vertex<double>{50, 50}, 1.0));
+        page.put(std::make_shared<dc::Circle>(line_info(), color::rgb(255, 0, 0), vertex<double>{99, 150}, 2.0));
+        page.put(std::make_shared<dc::Line>(line_info(), vertex<double>{0, 0}, vertex<double>{720, 576}));
+        dc::TextInfo info{400, "", "sans", 12.0, false, 30.0};
+        page.put(std::make_shared<dc::Text>(color::rgb(0, 0, 0), vertex<double>{300, 150}, "abc", 0, 0, std::move(info)));
+        const std::size_t first = page.draw_calls();
+        // same position and size except y
+        page.clip({100, 300, 100, 100});
+        page.put(std::make_shared<dc::Circle>(line_info(), color::rgb(255, 0, 0), vertex<double>{150, 350}, 1.0));
+        page.put(std::make_shared<dc::Circle>(line_info(), color::rgb(255, 0, 0), vertex<double>{150, 150}, 1.0));
+
+        if (first != 2 || page.draw_calls() != 3)
+        {
+            std::printf("FAIL Page::put (culling): %zu, %zu draw calls\n", first, page.draw_calls());
+            g_failures++;
+        }
+        else
+        {
+            std::printf("ok   Page::put (culling)\n");
+        }
+    }
+
+    // Repeated markers are defined once and used at their positions,
+    // everything else is written as before.
+
+    void test_symbols()
+    {
+        dc::Page page(0, {720, 576});
+        for (int i = 0; i < 100; ++i)
+        {
+            page.put(std::make_shared<dc::Circle>(line_info(), color::rgb(255, 0, 0), vertex<double>{1.0 + i, 2.0 + i}, 3.0));
+            page.put(std::make_shared<dc::Polygon>(line_info(), color::rgb(0, 0, 255),
+                                                   std::vector<vertex<double>>{{10.0 + i, 10}, {20.0 + i, 10}, {15.0 + i, 5}}));
+        }
+        page.put(std::make_shared<dc::Circle>(line_info(), color::rgb(0, 255, 0), vertex<double>{1, 2}, 3.0));
+        page.put(std::make_shared<dc::Polyline>(line_info(), points(10)));
+
+        const std::string svg = page.svg(boost::none);
+        const std::size_t symbols = count_matches(svg, "<symbol "), uses = count_matches(svg, "<use ");
+        const std::size_t circles = count_matches(svg, "<circle "), polygons = count_matches(svg, "<polygon ");
+        if (symbols != 2 || uses != 200 || circles != 2 || polygons != 1 || count_matches(svg, "<polyline ") != 1 ||
+            svg.find(R""(<use xlink:href="#s1" x="19.00" y="10.00"/>)"") == std::string::npos ||
+            svg.find(R""(<polygon points="0.00,0.00 10.00,0.00 5.00,-5.00")"") == std::string::npos)
+        {
+            std::printf("FAIL Page::svg (symbols): %zu symbols, %zu uses, %zu circles, %zu polygons\n", symbols, uses, circles, polygons);
+            g_failures++;
+        }
+        else
+        {
+            std::printf("ok   Page::svg (symbols): %zu bytes\n", svg.size());
+        }
+    }
+
+    // Pages without repeated markers only count a bounded number of
+    // candidates, streaming them does not allocate the size of the SVG.
+
+    void test_symbols_unique()
+    {
+        dc::Page page(0, {720, 576});
+        for (int i = 0; i < 100000; ++i)
+        {
+            page.put(std::make_shared<dc::Circle>(line_info(), color::rgb(255, 0, 0), vertex<double>{1, 2}, 0.01 * i));
+        }
+        std::size_t size = 0;
+        std::size_t bytes = 0;
+        {
+            AllocCounter c;
+            fmt::memory_buffer os;
+            page.svg(os, boost::none, {720, 576}, boost::none, 64 * 1024, [&](fmt::memory_buffer &buf) {
+                size += buf.size();
+            });
+            bytes = c.bytes();
+        }
+        if (bytes > size / 10)
+        {
+            std::printf("FAIL Page::svg (unique symbols): %zu bytes allocated for %zu bytes\n", bytes, size);
+            g_failures++;
+        }
+        else
+        {
+            std::printf("ok   Page::svg (unique symbols): %zu bytes allocated for %zu bytes\n", bytes, size);
+        }
+    }
+
+    // Consecutive opaque solid lines of the same style and clip area are
+    // written as one path.
+
+    void test_join_lines()
+    {
+        dc::Page page(0, {720, 576});
+        for (int i = 0; i < 5; ++i)
+        {
+            page.put(std::make_shared<dc::Line>(line_info(), vertex<double>{10.0 * i, 0}, vertex<double>{10.0 * i, 100}));
+        }
+        page.put(std::make_shared<dc::Polyline>(line_info(), std::vector<vertex<double>>{{0, 0}, {1, 1}, {2, 0}}));
+        auto dashed = line_info();
+        dashed.lty = 0x44;
+        page.put(std::make_shared<dc::Line>(std::move(dashed), vertex<double>{0, 0}, vertex<double>{1, 1}));
+        page.put(std::make_shared<dc::Line>(line_info(), vertex<double>{0, 0}, vertex<double>{1, 1}));
+        page.clip({0, 0, 100, 100});
+        page.put(std::make_shared<dc::Line>(line_info(), vertex<double>{0, 0}, vertex<double>{1, 1}));
+        auto transparent = line_info();
+        transparent.col = color::rgba(0, 0, 0, 128);
+        page.put(std::make_shared<dc::Line>(dc::LineInfo(transparent), vertex<double>{0, 0}, vertex<double>{1, 1}));
+        page.put(std::make_shared<dc::Line>(dc::LineInfo(transparent), vertex<double>{0, 0}, vertex<double>{1, 1}));
+
+        const std::string svg = page.svg(boost::none);
+        const std::size_t paths = count_matches(svg, "<path "), lines = count_matches(svg, "<line ");
+        if (paths != 1 || lines != 5 || count_matches(svg, "<polyline ") != 0 ||
+            svg.find(R""(<path d="M0.00,0.00L0.00,100.00 M10.00,0.00L10.00,100.00 )"") == std::string::npos ||
+            svg.find(R""( M0.00,0.00L1.00,1.00 2.00,0.00" style=")"") == std::string::npos)
+        {
+            std::printf("FAIL Page::svg (joined lines): %zu paths, %zu lines\n", paths, lines);
+            g_failures++;
+        }
+        else
+        {
+            std::printf("ok   Page::svg (joined lines)\n");
+        }
+    }
+
+    // Traces are filtered by the device the request was sent to.
+
+    void test_trace_device()
+    {
+        trace::clear();
+        trace::enable(true);
+        {
+            trace::Request request("/svg", 1);
+        }
+        {
+            trace::Request request("/svg", 2);
+            trace::Span span("render");
+        }
+        trace::enable(false);
+
+        fmt::memory_buffer all, one, two;
+        trace::write_json(all, -1);
+        trace::write_json(one, 1);
+        trace::write_json(two, 2);
+        trace::clear();
+        const std::string s_all = fmt::to_string(all), s_one = fmt::to_string(one), s_two = fmt::to_string(two);
+        if (count_matches(s_all, "\"name\"") != 3 || count_matches(s_one, "\"name\"") != 1 ||
+            count_matches(s_two, "\"name\"") != 2 || s_two.find("\"device\": 1") != std::string::npos)
+        {
+            std::printf("FAIL trace::write_json (device)\n");
+            g_failures++;
+        }
+        else
+        {
+            std::printf("ok   trace::write_json (device)\n");
+        }
+    }
+} // namespace
+
+int main()
+{
+    test_draw_calls();
+    test_store();
+    test_changes();
+    test_remove();
+    test_serialize();
+    test_stream();
+    test_svg_batch();
+    test_file();
+    test_binary();
+    test_viewport();
+    test_hit();
+    test_index_cache();
+    test_cull();
+    test_symbols();
+    test_symbols_unique();
+    test_join_lines();
+    test_trace_device();
+    return g_failures == 0 ? 0 : 1;
+}